@@ -0,0 +1,1291 @@
+/**
+ * @file analyser.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  twirl-analyse - analyses a saved net from the command line (no GTK dependency)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "explorer.h"
+#include "kernel.h"
+#include "parallel.h"
+#include "reduction.h"
+#include "diagram.h"
+#include "symbolic.h"
+#include "coverability.h"
+#include "invariants.h"
+#include "siphons.h"
+#include "simulator.h"
+#include "timed.h"
+#include "replicator.h"
+#include "simplifier.h"
+#include "property.h"
+#include "checker.h"
+#include "loader.h"
+
+/**
+ * @brief the most reachable markings the kernels are benchmarked against
+ *
+ */
+#define BENCHMARK_MARKINGS (1 << 20)
+
+/**
+ * @brief the (marking, transition) pairs tested by each benchmark
+ *
+ */
+#define BENCHMARK_TESTS 50000000L
+
+/**
+ * @brief the invariants of each kind shown
+ *
+ */
+#define INVARIANTS_SHOWN 20
+
+/**
+ * @brief the siphons (or traps) shown
+ *
+ */
+#define SIPHONS_SHOWN 20
+
+/**
+ * @brief the number of dead markings shown by default
+ *
+ */
+#define DEFAULT_DEADLOCKS_SHOWN 10
+
+/**
+ * @brief private structure - the command line options
+ *
+ */
+typedef struct _OPTIONS
+{
+    int limit;
+    int deadlocks;
+    int threads;
+    int symbolic;
+    int coverability;
+    int invariants;
+    int siphons;
+    int kernel;
+    int benchmark;
+    long firings;
+    long long horizon;
+    long replications;
+    int stochastic;
+    const char *csv;
+    int simplify;
+    SIMPLIFIER *simplifier;
+    const char *property;
+    enum REDUCTION_MODE reduction;
+    char *observed;
+    const char *filename;
+
+} OPTIONS, *OPTIONS_P;
+
+/**
+ * @brief show the usage
+ *
+ */
+void analyser_usage(const char *program)
+{
+
+    fprintf(stderr, "usage: %s [options] net.xml\n", program);
+    fprintf(stderr, "  (at most one of -g, -t, -f, -c, -m, -i, -S, -b, -p or -s - the reachability graph otherwise)\n");
+    fprintf(stderr, "  -l <states>    stop exploring once <states> states are found (default no limit) - the nodes of\n");
+    fprintf(stderr, "                 the coverability tree or decision diagram, the rows held while computing\n");
+    fprintf(stderr, "                 invariants or the siphon problems searched\n");
+    fprintf(stderr, "  -d <count>     the number of dead markings shown (default %d)\n", DEFAULT_DEADLOCKS_SHOWN);
+    fprintf(stderr, "  -j <threads>   explore with <threads> work stealing threads (default 1)\n");
+    fprintf(stderr, "  -m             build the reachable markings symbolically (a decision diagram)\n");
+    fprintf(stderr, "  -c             build the coverability tree and report the unbounded places\n");
+    fprintf(stderr, "  -i             compute the minimal P- and T-invariants (semiflows)\n");
+    fprintf(stderr, "  -S             find the minimal siphons and traps and check each minimal siphon holds a\n");
+    fprintf(stderr, "                 marked trap (no dead marking if the arcs are unweighted, live if free choice)\n");
+    fprintf(stderr, "  -g <firings>   play the token game - fire up to <firings> transitions chosen at random and\n");
+    fprintf(stderr, "                 report the firings per second\n");
+    fprintf(stderr, "  -t <time>      simulate the timed net up to <time> and report each transition's throughput\n");
+    fprintf(stderr, "                 and utilisation (the transitions' durations are the time they take)\n");
+    fprintf(stderr, "  -x             draw the durations at random (geometric, mean is the duration) - with -t\n");
+    fprintf(stderr, "  -r <count>     run <count> independent replications of the timed simulation on the threads\n");
+    fprintf(stderr, "                 and report the mean and variance of the throughput and utilisation - with -t\n");
+    fprintf(stderr, "  -o <file.csv>  write each replication's results to <file.csv> - with -r\n");
+    fprintf(stderr, "  -k <kernel>    expand the states in batches with the kernel - scalar, sse2 or avx2 (default\n");
+    fprintf(stderr, "                 the widest supported), or none to expand one state at a time\n");
+    fprintf(stderr, "  -b             benchmark the kernels against expanding one state at a time\n");
+    fprintf(stderr, "  -f <property>  check a CTL or LTL property while the markings are generated, e.g.\n");
+    fprintf(stderr, "                 'AG (p + q <= 1)', 'EF dead', 'G (enabled(t) -> F q > 0)'\n");
+    fprintf(stderr, "  -R             reduce the net by structural rules first and analyse the reduced net\n");
+    fprintf(stderr, "                 (dead markings are shown as markings of the original net) - the rules\n");
+    fprintf(stderr, "                 preserve dead markings and boundedness only, so -R is for the\n");
+    fprintf(stderr, "                 reachability graph, -m, -p and -b (not -f, -s, -c, -i, -S, -g or -t)\n");
+    fprintf(stderr, "  -p             also explore with a deadlock preserving stubborn set reduction\n");
+    fprintf(stderr, "  -s <places>    also explore with a reduction preserving safety properties of the places\n");
+    fprintf(stderr, "                 (a comma separated list of place names)\n");
+}
+
+/**
+ * @brief the kernel named - -1 for none, -2 if the name is unknown
+ *
+ */
+int analyser_kernel_type(const char *name)
+{
+
+    if (strcmp(name, "none") == 0)
+    {
+        return -1;
+    }
+
+    for (int iType = 0; iType < END_KERNEL_TYPES; iType++)
+    {
+        if (strcmp(kernel_name(iType), name) == 0)
+        {
+            return iType;
+        }
+    }
+
+    return -2;
+}
+
+/**
+ * @brief parse the command line - returns false if the command line is invalid
+ *
+ */
+int analyser_parse(int argc, char *argv[], OPTIONS *options)
+{
+    int reductions = 0;
+    int modes = 0;
+
+    options->limit = 0;
+    options->deadlocks = DEFAULT_DEADLOCKS_SHOWN;
+    options->threads = 1;
+    options->symbolic = FALSE;
+    options->coverability = FALSE;
+    options->invariants = FALSE;
+    options->siphons = FALSE;
+    options->kernel = END_KERNEL_TYPES;
+    options->benchmark = FALSE;
+    options->firings = 0;
+    options->horizon = 0;
+    options->replications = 0;
+    options->stochastic = FALSE;
+    options->csv = NULL;
+    options->simplify = FALSE;
+    options->simplifier = NULL;
+    options->property = NULL;
+    options->reduction = END_REDUCTION_MODES;
+    options->observed = NULL;
+    options->filename = NULL;
+
+    for (int iArgument = 1; iArgument < argc; iArgument++)
+    {
+        if (strcmp(argv[iArgument], "-l") == 0 && iArgument + 1 < argc)
+        {
+            options->limit = atoi(argv[++iArgument]);
+        }
+        else if (strcmp(argv[iArgument], "-d") == 0 && iArgument + 1 < argc)
+        {
+            options->deadlocks = atoi(argv[++iArgument]);
+        }
+        else if (strcmp(argv[iArgument], "-j") == 0 && iArgument + 1 < argc)
+        {
+            options->threads = atoi(argv[++iArgument]);
+        }
+        else if (strcmp(argv[iArgument], "-m") == 0)
+        {
+            options->symbolic = TRUE;
+        }
+        else if (strcmp(argv[iArgument], "-c") == 0)
+        {
+            options->coverability = TRUE;
+        }
+        else if (strcmp(argv[iArgument], "-i") == 0)
+        {
+            options->invariants = TRUE;
+        }
+        else if (strcmp(argv[iArgument], "-S") == 0)
+        {
+            options->siphons = TRUE;
+        }
+        else if (strcmp(argv[iArgument], "-g") == 0 && iArgument + 1 < argc)
+        {
+            options->firings = atol(argv[++iArgument]);
+        }
+        else if (strcmp(argv[iArgument], "-t") == 0 && iArgument + 1 < argc)
+        {
+            options->horizon = atoll(argv[++iArgument]);
+        }
+        else if (strcmp(argv[iArgument], "-x") == 0)
+        {
+            options->stochastic = TRUE;
+        }
+        else if (strcmp(argv[iArgument], "-r") == 0 && iArgument + 1 < argc)
+        {
+            options->replications = atol(argv[++iArgument]);
+        }
+        else if (strcmp(argv[iArgument], "-o") == 0 && iArgument + 1 < argc)
+        {
+            options->csv = argv[++iArgument];
+        }
+        else if (strcmp(argv[iArgument], "-k") == 0 && iArgument + 1 < argc)
+        {
+            options->kernel = analyser_kernel_type(argv[++iArgument]);
+
+            if (options->kernel < -1)
+            {
+                return FALSE;
+            }
+        }
+        else if (strcmp(argv[iArgument], "-b") == 0)
+        {
+            options->benchmark = TRUE;
+        }
+        else if (strcmp(argv[iArgument], "-f") == 0 && iArgument + 1 < argc)
+        {
+            options->property = argv[++iArgument];
+        }
+        else if (strcmp(argv[iArgument], "-R") == 0)
+        {
+            options->simplify = TRUE;
+        }
+        else if (strcmp(argv[iArgument], "-p") == 0)
+        {
+            options->reduction = DEADLOCK_REDUCTION;
+            reductions++;
+        }
+        else if (strcmp(argv[iArgument], "-s") == 0 && iArgument + 1 < argc)
+        {
+            options->reduction = SAFETY_REDUCTION;
+            options->observed = argv[++iArgument];
+            reductions++;
+        }
+        else if (argv[iArgument][0] != '-' && options->filename == NULL)
+        {
+            options->filename = argv[iArgument];
+        }
+        else
+        {
+            return FALSE;
+        }
+    }
+
+    // the rules merge and remove places, so the places named by a property are not kept
+    if (options->simplify && (options->property != NULL || options->observed != NULL || options->coverability ||
+                              options->invariants || options->siphons || options->firings > 0 || options->horizon > 0))
+    {
+        fprintf(stderr, "%s: -R cannot be used with -f, -s, -c, -i, -S, -g or -t\n", argv[0]);
+
+        return FALSE;
+    }
+
+    // the modifiers of the timed simulation are only read by it
+    if ((options->replications > 0 || options->stochastic) && options->horizon <= 0)
+    {
+        fprintf(stderr, "%s: -r and -x need -t\n", argv[0]);
+
+        return FALSE;
+    }
+
+    if (options->csv != NULL && options->replications <= 0)
+    {
+        fprintf(stderr, "%s: -o needs -r\n", argv[0]);
+
+        return FALSE;
+    }
+
+    // main runs a single analysis, so a second one would be dropped
+    modes = (options->firings > 0) + (options->horizon > 0) + (options->property != NULL) + options->coverability +
+            options->symbolic + options->invariants + options->siphons + options->benchmark + reductions;
+
+    if (modes > 1)
+    {
+        fprintf(stderr, "%s: only one of -g, -t, -f, -c, -m, -i, -S, -b, -p or -s can be used\n", argv[0]);
+
+        return FALSE;
+    }
+
+    return options->filename != NULL;
+}
+
+/**
+ * @brief print a marking - only the marked places are shown
+ *
+ */
+void analyser_print_marking(MODEL *model, const unsigned int *marking)
+{
+    int shown = 0;
+
+    printf("[");
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        if (marking[iPlace] != 0)
+        {
+            printf("%s%s=%u", shown++ == 0 ? "" : " ", model->placeNames[iPlace], marking[iPlace]);
+        }
+    }
+
+    printf("]\n");
+}
+
+/**
+ * @brief print a dead marking - a marking of the reduced net is shown as the original's
+ *
+ */
+void analyser_print_deadlock(MODEL *model, OPTIONS *options, const unsigned int *marking)
+{
+    SIMPLIFIER *simplifier = options->simplifier;
+    unsigned int *original = NULL;
+
+    printf("  ");
+
+    if (simplifier == NULL || model != simplifier->reduced)
+    {
+        analyser_print_marking(model, marking);
+
+        return;
+    }
+
+    original = malloc(sizeof(unsigned int) * (simplifier->model->places + 1));
+
+    simplifier->restore(simplifier, marking, original);
+    analyser_print_marking(simplifier->model, original);
+
+    free(original);
+}
+
+/**
+ * @brief print the size of a packed marking and the memory held by the marking table
+ *
+ */
+void analyser_print_codec(MODEL *model, CODEC *codec, int widenings, size_t bytes)
+{
+
+    printf("marking: %d places packed into %d words (%d widenings)\n", model->places, codec->words, widenings);
+    printf("store: %.1fMB\n", bytes / (1024.0 * 1024.0));
+}
+
+/**
+ * @brief replace the explorer's kernel with the one requested (-1 for none) - returns false if the processor does not
+ *        support it
+ *
+ */
+int analyser_set_kernel(EXPLORER *explorer, int type)
+{
+
+    if (explorer->kernel != NULL)
+    {
+        explorer->kernel->release(explorer->kernel);
+    }
+
+    explorer->kernel = type >= 0 ? create_kernel(explorer->model, type) : NULL;
+
+    return type < 0 || explorer->kernel != NULL;
+}
+
+/**
+ * @brief explore the reachability graph and report the states, edges and deadlocks
+ *
+ */
+long analyser_explore(MODEL *model, OPTIONS *options, REDUCTION *reduction)
+{
+    EXPLORER *explorer = create_explorer(model);
+    long states = 0;
+
+    if (options->kernel != END_KERNEL_TYPES && !analyser_set_kernel(explorer, options->kernel))
+    {
+        fprintf(stderr, "the %s kernel is not supported - expanding one state at a time\n",
+                kernel_name(options->kernel));
+    }
+
+    explorer->reduction = reduction;
+    explorer->explore(explorer, options->limit);
+
+    if (reduction == NULL)
+    {
+        printf("kernel: %s\n", explorer->kernel != NULL ? explorer->kernel->name : "none");
+    }
+
+    printf("states: %d%s\n", explorer->store->count, explorer->complete ? "" : " (incomplete - limit reached)");
+    printf("edges: %ld\n", explorer->edges);
+    printf("deadlocks: %d\n", explorer->deadlockCount);
+
+    for (int iDeadlock = 0; iDeadlock < explorer->deadlockCount && iDeadlock < options->deadlocks; iDeadlock++)
+    {
+        analyser_print_deadlock(model, options, explorer->getMarking(explorer, explorer->deadlocks[iDeadlock]));
+    }
+
+    analyser_print_codec(model, explorer->codec, explorer->widenings, store_bytes(explorer->store));
+
+    printf("time: %.3fs\n", explorer->seconds);
+    printf("states/second: %.0f\n", explorer->seconds > 0 ? explorer->store->count / explorer->seconds : 0);
+
+    states = explorer->store->count;
+
+    explorer->release(explorer);
+
+    return states;
+}
+
+/**
+ * @brief explore the reachable markings with a pool of threads - the graph's edges are counted but not kept
+ *
+ */
+long analyser_explore_parallel(MODEL *model, OPTIONS *options, REDUCTION *reduction)
+{
+    PARALLEL_EXPLORER *explorer = create_parallel_explorer(model, options->threads);
+    size_t bytes = 0;
+    long states = 0;
+
+    explorer->reduction = reduction;
+    explorer->explore(explorer, options->limit);
+
+    printf("threads: %d\n", explorer->threads);
+    printf("states: %ld%s\n", explorer->states, explorer->complete ? "" : " (incomplete - limit reached)");
+    printf("edges: %ld\n", explorer->edges);
+    printf("deadlocks: %d\n", explorer->deadlockCount);
+
+    for (int iDeadlock = 0; iDeadlock < explorer->deadlockCount && iDeadlock < options->deadlocks; iDeadlock++)
+    {
+        analyser_print_deadlock(model, options, explorer->getMarking(explorer, explorer->deadlocks[iDeadlock]));
+    }
+
+    for (int iSegment = 0; iSegment < (1 << explorer->segmentBits); iSegment++)
+    {
+        bytes += store_bytes(explorer->segments[iSegment]);
+    }
+
+    analyser_print_codec(model, explorer->codec, explorer->widenings, bytes);
+
+    printf("time: %.3fs\n", explorer->seconds);
+    printf("states/second: %.0f\n", explorer->seconds > 0 ? explorer->states / explorer->seconds : 0);
+
+    states = explorer->states;
+
+    explorer->release(explorer);
+
+    return states;
+}
+
+/**
+ * @brief test (and fire) every transition in every reachable marking one marking at a time, as the explorer does
+ *        without a kernel - returns the number of enabled pairs found plus the tokens of the changed places
+ *
+ */
+unsigned long analyser_benchmark_markings(MODEL *model, const unsigned int *markings, int count,
+                                          unsigned int *successor)
+{
+    unsigned long checksum = 0;
+
+    for (int iMarking = 0; iMarking < count; iMarking++)
+    {
+        const unsigned int *marking = &markings[(size_t)iMarking * model->places];
+
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            if (!reduction_is_enabled(model, marking, iTransition))
+            {
+                continue;
+            }
+
+            memcpy(successor, marking, sizeof(unsigned int) * model->places);
+
+            checksum += 1;
+
+            for (int iChange = model->changeStart[iTransition]; iChange < model->changeStart[iTransition + 1];
+                 iChange++)
+            {
+                successor[model->changePlaces[iChange]] += model->changeValues[iChange];
+                checksum += successor[model->changePlaces[iChange]];
+            }
+        }
+    }
+
+    return checksum;
+}
+
+/**
+ * @brief test (and fire) every transition in every batch of reachable markings with a kernel - returns the same
+ *        checksum as analyser_benchmark_markings
+ *
+ */
+unsigned long analyser_benchmark_batches(KERNEL *kernel, unsigned int *batches, int count)
+{
+    MODEL *model = kernel->model;
+    unsigned long checksum = 0;
+
+    for (int iBatch = 0; iBatch * KERNEL_LANES < count; iBatch++)
+    {
+        unsigned int *batch = &batches[(size_t)iBatch * model->places * KERNEL_LANES];
+        int lanesUsed = count - iBatch * KERNEL_LANES < KERNEL_LANES ? count - iBatch * KERNEL_LANES : KERNEL_LANES;
+        unsigned int active = KERNEL_ALL_LANES >> (KERNEL_LANES - lanesUsed);
+
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            unsigned int lanes = kernel->enabled(kernel, batch, iTransition) & active;
+
+            if (lanes == 0)
+            {
+                continue;
+            }
+
+            kernel->fire(kernel, batch, iTransition, 1);
+
+            for (int iLane = 0; iLane < KERNEL_LANES; iLane++)
+            {
+                if ((lanes & (1u << iLane)) == 0)
+                {
+                    continue;
+                }
+
+                checksum += 1;
+
+                for (int iChange = model->changeStart[iTransition]; iChange < model->changeStart[iTransition + 1];
+                     iChange++)
+                {
+                    checksum += batch[model->changePlaces[iChange] * KERNEL_LANES + iLane];
+                }
+            }
+
+            kernel->fire(kernel, batch, iTransition, -1);
+        }
+    }
+
+    return checksum;
+}
+
+/**
+ * @brief benchmark the kernels - the enabling test and firing of every transition in the reachable markings (one
+ *        marking at a time, then a batch at a time with each kernel), then the exploration itself
+ *
+ */
+void analyser_benchmark(MODEL *model, OPTIONS *options)
+{
+    EXPLORER *explorer = create_explorer(model);
+    unsigned int *successor = malloc(sizeof(unsigned int) * (model->places + 1));
+    unsigned int *markings = NULL;
+    unsigned int *batches = NULL;
+    unsigned long expected = 0;
+    double seconds = 0;
+    double baseline = 0;
+    long rounds = 1;
+    int count = 0;
+
+    analyser_set_kernel(explorer, -1);
+    explorer->explore(explorer, options->limit);
+
+    count = explorer->store->count < BENCHMARK_MARKINGS ? explorer->store->count : BENCHMARK_MARKINGS;
+    rounds = BENCHMARK_TESTS / ((long)count * (model->transitions + 1)) + 1;
+
+    markings = malloc(sizeof(unsigned int) * ((size_t)count * model->places + 1));
+    batches = calloc((size_t)(count / KERNEL_LANES + 1) * model->places * KERNEL_LANES + 1, sizeof(unsigned int));
+
+    for (int iMarking = 0; iMarking < count; iMarking++)
+    {
+        memcpy(&markings[(size_t)iMarking * model->places], explorer->getMarking(explorer, iMarking),
+               sizeof(unsigned int) * model->places);
+
+        kernel_load(&batches[(size_t)(iMarking / KERNEL_LANES) * model->places * KERNEL_LANES], iMarking % KERNEL_LANES,
+                    &markings[(size_t)iMarking * model->places], model->places);
+    }
+
+    printf("markings: %d transitions: %d rounds: %ld\n", count, model->transitions, rounds);
+    printf("%-12s %12s %12s %10s\n", "kernel", "ns/test", "seconds", "speedup");
+
+    seconds = explorer_clock();
+
+    for (long iRound = 0; iRound < rounds; iRound++)
+    {
+        expected = analyser_benchmark_markings(model, markings, count, successor);
+    }
+
+    baseline = explorer_clock() - seconds;
+
+    printf("%-12s %12.2f %12.3f %10.2f\n", "none", baseline * 1e9 / ((double)rounds * count * model->transitions),
+           baseline, 1.0);
+
+    for (int iType = 0; iType < END_KERNEL_TYPES; iType++)
+    {
+        KERNEL *kernel = create_kernel(model, iType);
+        unsigned long checksum = 0;
+
+        if (kernel == NULL)
+        {
+            printf("%-12s %12s\n", kernel_name(iType), "unsupported");
+
+            continue;
+        }
+
+        seconds = explorer_clock();
+
+        for (long iRound = 0; iRound < rounds; iRound++)
+        {
+            checksum = analyser_benchmark_batches(kernel, batches, count);
+        }
+
+        seconds = explorer_clock() - seconds;
+
+        printf("%-12s %12.2f %12.3f %10.2f%s\n", kernel->name,
+               seconds * 1e9 / ((double)rounds * count * model->transitions), seconds,
+               seconds > 0 ? baseline / seconds : 0, checksum == expected ? "" : " (differs)");
+
+        kernel->release(kernel);
+    }
+
+    printf("%-12s %12s %12s %10s\n", "kernel", "states", "seconds", "speedup");
+
+    baseline = explorer->seconds;
+
+    printf("%-12s %12d %12.3f %10.2f\n", "none", explorer->store->count, baseline, 1.0);
+
+    for (int iType = 0; iType < END_KERNEL_TYPES; iType++)
+    {
+        EXPLORER *batched = create_explorer(model);
+
+        if (analyser_set_kernel(batched, iType))
+        {
+            batched->explore(batched, options->limit);
+
+            printf("%-12s %12d %12.3f %10.2f%s\n", batched->kernel->name, batched->store->count, batched->seconds,
+                   batched->seconds > 0 ? baseline / batched->seconds : 0,
+                   !batched->complete ||
+                           (batched->store->count == explorer->store->count && batched->edges == explorer->edges)
+                       ? ""
+                       : " (differs)");
+        }
+
+        batched->release(batched);
+    }
+
+    free(markings);
+    free(batches);
+    free(successor);
+
+    explorer->release(explorer);
+}
+
+/**
+ * @brief explore the reachable markings (with the threads requested) - returns the number of states
+ *
+ */
+long analyser_reachability(MODEL *model, OPTIONS *options, REDUCTION *reduction)
+{
+
+    return options->threads > 1 ? analyser_explore_parallel(model, options, reduction)
+                                : analyser_explore(model, options, reduction);
+}
+
+/**
+ * @brief find the observed places (by name) - returns the number found, -1 if a name is unknown
+ *
+ */
+int analyser_find_places(MODEL *model, char *names, int *places)
+{
+    int count = 0;
+
+    for (char *name = strtok(names, ","); name != NULL; name = strtok(NULL, ","))
+    {
+        int found = -1;
+
+        for (int iPlace = 0; iPlace < model->places && found < 0; iPlace++)
+        {
+            if (model->placeNames[iPlace] != NULL && strcmp(model->placeNames[iPlace], name) == 0)
+            {
+                found = iPlace;
+            }
+        }
+
+        if (found < 0)
+        {
+            fprintf(stderr, "unknown place '%s'\n", name);
+
+            return -1;
+        }
+
+        places[count++] = found;
+    }
+
+    return count;
+}
+
+/**
+ * @brief explore the full and the reduced state space and report the reduction ratio
+ *
+ */
+int analyser_reduce(MODEL *model, OPTIONS *options)
+{
+    REDUCTION *reduction = NULL;
+    int *observed = malloc(sizeof(int) * (model->places + 1));
+    int observedCount = 0;
+    long full = 0;
+    long reduced = 0;
+
+    if (options->reduction == SAFETY_REDUCTION &&
+        (observedCount = analyser_find_places(model, options->observed, observed)) < 0)
+    {
+        free(observed);
+
+        return FALSE;
+    }
+
+    reduction = create_reduction(model, options->reduction, observed, observedCount);
+
+    printf("full:\n");
+
+    full = analyser_reachability(model, options, NULL);
+
+    printf("reduced (%s preserving", options->reduction == SAFETY_REDUCTION ? "safety" : "deadlock");
+
+    if (options->reduction == SAFETY_REDUCTION)
+    {
+        printf(", %d visible transitions", reduction->visibleCount);
+    }
+
+    printf("):\n");
+
+    reduced = analyser_reachability(model, options, reduction);
+
+    printf("reduction: %ld of %ld states (ratio %.2f)\n", reduced, full, reduced > 0 ? (double)full / reduced : 0);
+
+    reduction->release(reduction);
+
+    free(observed);
+
+    return TRUE;
+}
+
+/**
+ * @brief build the reachable markings symbolically and report the state and node counts
+ *
+ */
+void analyser_symbolic(MODEL *model, OPTIONS *options)
+{
+    SYMBOLIC *symbolic = create_symbolic(model);
+
+    symbolic->explore(symbolic, options->limit);
+
+    printf("order: span %ld (%ld in the file's order)\n", symbolic->span, symbolic->fileSpan);
+    printf(symbolic->states < 1e15 ? "states: %.0f%s\n" : "states: %.6e%s\n", symbolic->states,
+           symbolic->unbounded >= 0 ? " (incomplete - unbounded)"
+           : symbolic->complete     ? ""
+                                    : " (incomplete - node limit reached)");
+
+    if (symbolic->unbounded >= 0)
+    {
+        printf("unbounded: %s exceeds %d tokens\n", model->placeNames[symbolic->unbounded], SYMBOLIC_MAXIMUM_BOUND);
+    }
+
+    printf("nodes: %d (peak %d)\n", symbolic->nodes, symbolic->peak);
+    printf("iterations: %d restarts: %d\n", symbolic->iterations, symbolic->restarts);
+    printf("time: %.3fs\n", symbolic->seconds);
+
+    symbolic->release(symbolic);
+}
+
+/**
+ * @brief build the coverability tree and report the unbounded places (with the transitions that pump each) and the
+ *        largest bound of the others
+ *
+ */
+void analyser_coverability(MODEL *model, OPTIONS *options)
+{
+    COVERABILITY *coverability = create_coverability(model);
+    int *sequence = NULL;
+    int largest = -1;
+
+    coverability->build(coverability, options->limit);
+
+    printf("nodes: %d%s (%d covered before being expanded, depth %d)\n", coverability->store->count,
+           coverability->complete ? "" : " (incomplete - limit reached)", coverability->skipped, coverability->depth);
+    printf("unbounded: %d places\n", coverability->unboundedCount);
+
+    sequence = malloc(sizeof(int) * (coverability->depth + 1));
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        if (coverability->unbounded[iPlace])
+        {
+            int count = coverability->trace(coverability, coverability->witnesses[iPlace], sequence);
+
+            printf("  %s after", model->placeNames[iPlace]);
+
+            for (int iStep = 0; iStep < count; iStep++)
+            {
+                printf(" %s", model->transitionNames[sequence[iStep]]);
+            }
+
+            printf("\n");
+        }
+        else if (largest < 0 || coverability->bounds[iPlace] > coverability->bounds[largest])
+        {
+            largest = iPlace;
+        }
+    }
+
+    if (largest >= 0)
+    {
+        printf("bounded: %d places (largest bound %u - %s)\n", model->places - coverability->unboundedCount,
+               coverability->bounds[largest], model->placeNames[largest]);
+    }
+
+    printf("time: %.3fs\n", coverability->seconds);
+
+    free(sequence);
+
+    coverability->release(coverability);
+}
+
+/**
+ * @brief compute the minimal invariants of a kind and show them as weighted sums of places (or transitions) - the
+ *        computation stops once the limit of rows is held
+ *
+ */
+void analyser_print_invariants(MODEL *model, OPTIONS *options, enum INVARIANT_KIND kind)
+{
+    INVARIANTS *invariants = create_invariants(model, kind);
+    char **names = kind == PLACE_INVARIANTS ? model->placeNames : model->transitionNames;
+    const char *label = kind == PLACE_INVARIANTS ? "P" : "T";
+
+    invariants->compute(invariants, options->limit);
+
+    printf("%s-invariants: %d%s%s (%d of %d %s covered, %ld rows at most, %.3fs)\n", label, invariants->count,
+           invariants->complete ? "" : " (incomplete)", invariants->overflow ? " (entries overflowed)" : "",
+           invariants->coveredCount, invariants->nodes, kind == PLACE_INVARIANTS ? "places" : "transitions",
+           invariants->rows, invariants->seconds);
+
+    for (int iInvariant = 0; iInvariant < invariants->count && iInvariant < INVARIANTS_SHOWN; iInvariant++)
+    {
+        printf(" ");
+
+        for (int iMember = invariants->start[iInvariant]; iMember < invariants->start[iInvariant + 1]; iMember++)
+        {
+            printf(" %s", iMember == invariants->start[iInvariant] ? "" : "+ ");
+
+            if (invariants->weights[iMember] != 1)
+            {
+                printf("%lld*", invariants->weights[iMember]);
+            }
+
+            printf("%s", names[invariants->members[iMember]]);
+        }
+
+        printf("\n");
+    }
+
+    if (invariants->count > INVARIANTS_SHOWN)
+    {
+        printf("  ... (%d more)\n", invariants->count - INVARIANTS_SHOWN);
+    }
+
+    if (kind == PLACE_INVARIANTS && invariants->complete && invariants->coveredCount == invariants->nodes)
+    {
+        printf("covered by P-invariants - the net is structurally bounded\n");
+    }
+
+    invariants->release(invariants);
+}
+
+/**
+ * @brief print a set of places
+ *
+ */
+void analyser_print_places(MODEL *model, const int *places, int count)
+{
+
+    printf("{");
+
+    for (int iPlace = 0; iPlace < count; iPlace++)
+    {
+        printf("%s%s", iPlace == 0 ? "" : ", ", model->placeNames[places[iPlace]]);
+    }
+
+    printf("}");
+}
+
+/**
+ * @brief find the minimal siphons (or traps) and show them - each siphon with the maximal trap it holds; for siphons
+ *        the siphon-trap property is reported, returns true if each minimal siphon holds a marked trap
+ *
+ */
+int analyser_print_siphons(MODEL *model, OPTIONS *options, enum SIPHON_KIND kind)
+{
+    SIPHONS *siphons = create_siphons(model, kind);
+    int property = FALSE;
+
+    siphons->compute(siphons, options->limit);
+
+    printf("%s: %d%s (%d unmarked, %ld problems searched, %.3fs)\n", kind == SIPHON_SETS ? "siphons" : "traps",
+           siphons->count, siphons->complete ? "" : " (incomplete)", siphons->unmarkedCount, siphons->problems,
+           siphons->seconds);
+
+    for (int iSet = 0; iSet < siphons->count && iSet < SIPHONS_SHOWN; iSet++)
+    {
+        printf("  ");
+
+        analyser_print_places(model, siphons->members + siphons->start[iSet],
+                              siphons->start[iSet + 1] - siphons->start[iSet]);
+
+        if (kind == SIPHON_SETS)
+        {
+            printf(" trap ");
+
+            analyser_print_places(model, siphons->traps + siphons->trapStart[iSet],
+                                  siphons->trapStart[iSet + 1] - siphons->trapStart[iSet]);
+        }
+
+        printf("%s\n", siphons->marked[iSet] ? " marked" : "");
+    }
+
+    if (siphons->count > SIPHONS_SHOWN)
+    {
+        printf("  ... (%d more)\n", siphons->count - SIPHONS_SHOWN);
+    }
+
+    property = siphons->complete && siphons->unmarkedCount == 0;
+
+    // the siphon-trap property only rules out dead markings if the arcs are unweighted
+    if (kind == SIPHON_SETS && property && !siphons->ordinary)
+    {
+        printf("each minimal siphon holds a marked trap (the arcs are weighted - no conclusion is drawn)\n");
+    }
+    else if (kind == SIPHON_SETS && property)
+    {
+        printf("each minimal siphon holds a marked trap - the net has no dead marking%s\n",
+               siphons->freeChoice ? " and is live (free choice)" : "");
+    }
+    else if (kind == SIPHON_SETS && siphons->unmarkedCount > 0)
+    {
+        printf("minimal siphons holding no marked trap: %d - %s\n", siphons->unmarkedCount,
+               siphons->ordinary && siphons->freeChoice ? "the net is not live (free choice)"
+                                                        : "each could be emptied (a dead marking may be reached)");
+    }
+
+    siphons->release(siphons);
+
+    return property;
+}
+
+/**
+ * @brief the marking reached from the initial marking by the first steps of a trace
+ *
+ */
+void analyser_replay(MODEL *model, const int *trace, int steps, unsigned int *marking)
+{
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        marking[iPlace] = model->marking[iPlace];
+    }
+
+    for (int iStep = 0; iStep < steps; iStep++)
+    {
+        int transition = trace[iStep];
+
+        if (transition == CHECKER_STUTTER)
+        {
+            continue;
+        }
+
+        for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+        {
+            marking[model->changePlaces[iChange]] += model->changeValues[iChange];
+        }
+    }
+}
+
+/**
+ * @brief check a property on the fly and report the result, the witness or counterexample (and the marking it
+ *        reaches) and the markings generated - returns false if the property could not be parsed
+ *
+ */
+int analyser_check(MODEL *model, OPTIONS *options)
+{
+    static const char *results[END_CHECKER_RESULTS] = {"holds", "fails", "unknown (limit reached)"};
+    PROPERTY *property = create_property(model, options->property);
+    unsigned int *marking = malloc(sizeof(unsigned int) * (model->places + 1));
+    CHECKER *checker = NULL;
+
+    if (property->root < 0)
+    {
+        fprintf(stderr, "property: %s (at column %d)\n", property->error, property->position + 1);
+
+        property->release(property);
+        free(marking);
+
+        return FALSE;
+    }
+
+    checker = create_checker(model, property);
+
+    if (checker->automaton != NULL && checker->automaton->overflow)
+    {
+        fprintf(stderr, "property: more than %d subformulas\n", AUTOMATON_MAXIMUM_FORMULAS);
+    }
+
+    checker->check(checker, options->limit);
+
+    printf("property: %s (%s)\n", options->property, property->logic == LTL_LOGIC ? "LTL" : "CTL");
+    printf("result: %s\n", results[checker->result]);
+
+    if (checker->traceCount > 0)
+    {
+        printf("%s:", checker->witness ? "witness" : "counterexample");
+
+        for (int iStep = 0; iStep < checker->traceCount; iStep++)
+        {
+            printf("%s %s", iStep == checker->loopStart ? " (repeating" : "",
+                   checker->trace[iStep] == CHECKER_STUTTER ? "(dead)" : model->transitionNames[checker->trace[iStep]]);
+        }
+
+        printf("%s\n", checker->loopStart >= 0 ? ")" : "");
+        printf("reaches: ");
+        analyser_replay(model, checker->trace, checker->loopStart >= 0 ? checker->loopStart : checker->traceCount,
+                        marking);
+        analyser_print_marking(model, marking);
+    }
+
+    printf("states: %d\n", checker->store->count);
+
+    if (checker->automaton != NULL)
+    {
+        printf("product states: %d (automaton states: %d)\n", checker->productStates, checker->automaton->states);
+    }
+
+    printf("time: %.3fs\n", checker->seconds);
+
+    checker->release(checker);
+    property->release(property);
+
+    free(marking);
+
+    return TRUE;
+}
+
+/**
+ * @brief play the token game - fire transitions chosen at random and report the firings per second
+ *
+ */
+void analyser_play(MODEL *model, OPTIONS *options)
+{
+    SIMULATOR *simulator = create_simulator(model);
+    double started = explorer_clock();
+    long fired = simulator->run(simulator, options->firings);
+    double seconds = explorer_clock() - started;
+
+    printf("fired: %ld%s\n", fired, fired < options->firings ? " (dead - nothing enabled)" : "");
+    printf("time: %.3fs\n", seconds);
+    printf("firings/second: %.0f\n", seconds > 0 ? fired / seconds : 0);
+
+    simulator->release(simulator);
+}
+
+/**
+ * @brief simulate the timed net and report the throughput and utilisation of each transition
+ *
+ */
+void analyser_timed(MODEL *model, OPTIONS *options)
+{
+    TIMED_SIMULATOR *simulator = create_timed_simulator(model);
+
+    simulator->stochastic = options->stochastic;
+    simulator->run(simulator, options->horizon, 0);
+
+    printf("time: %lld%s%s\n", simulator->now, simulator->dead ? " (dead - nothing enabled or in flight)" : "",
+           simulator->zeno ? " (zeno - the time stopped passing, transitions of duration zero fire forever)" : "");
+    printf("completions: %ld\n", simulator->events);
+    printf("%-24s %12s %12s %12s\n", "transition", "completions", "throughput", "utilisation");
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        printf("%-24s %12ld %12.6f %12.4f\n", model->transitionNames[iTransition],
+               simulator->completions[iTransition], simulator->throughput(simulator, iTransition),
+               simulator->utilisation(simulator, iTransition));
+    }
+
+    printf("elapsed: %.3fs\n", simulator->seconds);
+    printf("events/second: %.0f\n", simulator->seconds > 0 ? simulator->events / simulator->seconds : 0);
+
+    simulator->release(simulator);
+}
+
+/**
+ * @brief run the replications of the timed net and report the mean and variance of each transition's throughput and
+ *        utilisation, and a histogram of its utilisation
+ *
+ */
+void analyser_replicate(MODEL *model, OPTIONS *options)
+{
+    REPLICATOR *replicator = create_replicator(model, options->threads);
+    FILE *csv = NULL;
+
+    if (options->csv != NULL && (csv = fopen(options->csv, "w")) == NULL)
+    {
+        fprintf(stderr, "unable to write '%s'\n", options->csv);
+    }
+
+    replicator->stochastic = options->stochastic;
+    replicator->run(replicator, options->replications, options->horizon, csv);
+
+    if (csv != NULL)
+    {
+        fclose(csv);
+    }
+
+    printf("replications: %ld (%ld dead, %ld zeno) threads: %d\n", replicator->replications, replicator->dead,
+           replicator->zeno, replicator->threads);
+    printf("completions: %ld\n", replicator->events);
+    printf("%-24s %12s %12s %12s %12s  %s\n", "transition", "throughput", "variance", "utilisation", "variance",
+           "utilisation histogram (0 .. 1)");
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        printf("%-24s %12.6f %12.3e %12.4f %12.3e ", model->transitionNames[iTransition],
+               replicator->throughputMeans[iTransition], replicator->throughputVariances[iTransition],
+               replicator->utilisationMeans[iTransition], replicator->utilisationVariances[iTransition]);
+
+        for (int iBin = 0; iBin < REPLICATOR_BINS; iBin++)
+        {
+            printf(" %ld", replicator->histograms[iTransition * REPLICATOR_BINS + iBin]);
+        }
+
+        printf("\n");
+    }
+
+    printf("elapsed: %.3fs\n", replicator->seconds);
+    printf("events/second: %.0f\n", replicator->seconds > 0 ? replicator->events / replicator->seconds : 0);
+
+    replicator->release(replicator);
+}
+
+/**
+ * @brief reduce the net by the structural rules and report what each removed - returns the reduced net
+ *
+ */
+MODEL *analyser_simplify(MODEL *model, OPTIONS *options)
+{
+    static const char *rules[END_SIMPLIFIER_RULES] = {"dead transitions", "duplicate transitions",
+                                                      "constant places",  "duplicate places",
+                                                      "series places",    "series transitions"};
+    SIMPLIFIER *simplifier = create_simplifier(model);
+    MODEL *reduced = simplifier->simplify(simplifier);
+
+    printf("reduced: places: %d transitions: %d arcs: %d (%.3fs)\n", reduced->places, reduced->transitions,
+           reduced->inputStart[reduced->transitions] + reduced->outputStart[reduced->transitions], simplifier->seconds);
+
+    for (int iRule = 0; iRule < END_SIMPLIFIER_RULES; iRule++)
+    {
+        if (simplifier->applied[iRule] > 0)
+        {
+            printf("  %s: %d\n", rules[iRule], simplifier->applied[iRule]);
+        }
+    }
+
+    options->simplifier = simplifier;
+
+    return reduced;
+}
+
+/**
+ * @brief the main section
+ *
+ */
+int main(int argc, char *argv[])
+{
+    OPTIONS options;
+    MODEL *model = NULL;
+    MODEL *original = NULL;
+    int result = 0;
+
+    if (!analyser_parse(argc, argv, &options))
+    {
+        analyser_usage(argv[0]);
+
+        return 2;
+    }
+
+    model = create_model_from_file(options.filename);
+
+    if (model == NULL)
+    {
+        fprintf(stderr, "%s: unable to read '%s'\n", argv[0], options.filename);
+
+        return 1;
+    }
+
+    printf("net: %s\n", options.filename);
+    printf("places: %d transitions: %d arcs: %d\n", model->places, model->transitions,
+           model->inputStart[model->transitions] + model->outputStart[model->transitions]);
+
+    original = model;
+
+    if (options.simplify)
+    {
+        model = analyser_simplify(original, &options);
+    }
+
+    if (options.firings > 0)
+    {
+        analyser_play(model, &options);
+    }
+    else if (options.horizon > 0 && options.replications > 0)
+    {
+        analyser_replicate(model, &options);
+    }
+    else if (options.horizon > 0)
+    {
+        analyser_timed(model, &options);
+    }
+    else if (options.property != NULL)
+    {
+        result = analyser_check(model, &options) ? 0 : 1;
+    }
+    else if (options.coverability)
+    {
+        analyser_coverability(model, &options);
+    }
+    else if (options.symbolic)
+    {
+        analyser_symbolic(model, &options);
+    }
+    else if (options.invariants)
+    {
+        analyser_print_invariants(model, &options, PLACE_INVARIANTS);
+        analyser_print_invariants(model, &options, TRANSITION_INVARIANTS);
+    }
+    else if (options.siphons)
+    {
+        result = analyser_print_siphons(model, &options, SIPHON_SETS) ? 0 : 1;
+
+        analyser_print_siphons(model, &options, TRAP_SETS);
+    }
+    else if (options.benchmark)
+    {
+        analyser_benchmark(model, &options);
+    }
+    else if (options.reduction != END_REDUCTION_MODES)
+    {
+        result = analyser_reduce(model, &options) ? 0 : 1;
+    }
+    else
+    {
+        analyser_reachability(model, &options, NULL);
+    }
+
+    if (options.simplifier != NULL)
+    {
+        options.simplifier->release(options.simplifier);
+    }
+
+    original->release(original);
+
+    return result;
+}
@@ -36,6 +36,7 @@
 #include "editor.h"
 #include "controller.h"
 #include "net.h"
+#include "pool.h"
 
 typedef struct _PATH
 {
@@ -146,7 +147,13 @@ void arc_set_vertex(ARC *arc, POINT *point)
 
     if (located)
     {
-        g_ptr_array_insert(arc->vertices, iVertex, create_vertex(CONTROL_POSITION, point));
+        VERTEX *vertex = create_vertex(CONTROL_POSITION, point, arc->net);
+
+        vertex->arc = arc;
+
+        g_ptr_array_insert(arc->vertices, iVertex, vertex);
+
+        arc->net->reshape(arc->net, arc, vertex, NULL);
     }
 }
 
@@ -157,6 +164,8 @@ void arc_set_vertex(ARC *arc, POINT *point)
 void arc_add_vertex(ARC *arc, VERTEX * vertex)
 {
 
+    vertex->arc = arc;
+
     g_ptr_array_add(arc->vertices, vertex);
  
 }
@@ -209,9 +218,31 @@ void arc_editor(ARC *arc, EDITOR *editor)
  */
 void release_arc(ARC *arc)
 {
-    g_free(arc);
+
+    for (int iVertex = 0; iVertex < arc->vertices->len; iVertex++)
+    {
+        VERTEX *vertex = g_ptr_array_index(arc->vertices, iVertex);
+
+        vertex->operations->release(vertex);
+    }
+
+    g_ptr_array_unref(arc->vertices);
+
+    arc->net->arcPool->free(arc->net->arcPool, arc);
 }
 
+/**
+ * @brief the arc operations
+ *
+ */
+const ARC_OPERATIONS arc_operations = {
+    .release = release_arc,
+    .getPathBounds = arc_get_path_bounds,
+    .isArcAtPoint = is_arc_at_point,
+    .getVertex = arc_get_vertex,
+    .setVertex = arc_set_vertex,
+    .addVertex = arc_add_vertex,
+    .edit = arc_editor};
 
 /**
  * @brief arc constructor
@@ -219,7 +250,7 @@ void release_arc(ARC *arc)
  */
 ARC *new_arc(NET *net)
 {
-    ARC *arc = g_malloc(sizeof(ARC));
+    ARC *arc = net->arcPool->allocate(net->arcPool);
     
     arc->net = net;
 
@@ -231,15 +262,11 @@ ARC *new_arc(NET *net)
 
     arc->weight = 1;
 
+    arc->slot = NO_SLOT;
+
     arc->vertices = g_ptr_array_new();
 
-    arc->release = release_arc;
-    arc->isArcAtPoint = is_arc_at_point;
-    arc->getPathBounds = arc_get_path_bounds;
-    arc->setVertex = arc_set_vertex;
-    arc->getVertex = arc_get_vertex;
-    arc->addVertex = arc_add_vertex;
-    arc->edit = arc_editor;
+    arc->operations = &arc_operations;
 
     return arc;
 
@@ -256,8 +283,8 @@ ARC *create_arc(NET *net, NODE *source, NODE *target)
     arc->source = source;
     arc->target = target;
 
-    g_ptr_array_add(arc->vertices, create_vertex(SOURCE_POSITION, &source->position));
-    g_ptr_array_add(arc->vertices, create_vertex(TARGET_POSITION, &target->position));
+    arc_add_vertex(arc, create_vertex(SOURCE_POSITION, &source->position, net));
+    arc_add_vertex(arc, create_vertex(TARGET_POSITION, &target->position, net));
 
     return arc;
 }
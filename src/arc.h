@@ -20,11 +20,12 @@
  */
 #define TO_ARC(arc) ((ARC*)(arc))
 
-typedef struct _ARC
- {
-     struct _ARTIFACT artifact;
-
-    struct _PAINTER painter;
+/**
+ * @brief the operations of an arc (one constant table shared by all the arcs)
+ * 
+ */
+typedef struct _ARC_OPERATIONS
+{
 
     void (*release)(struct _ARC * arc);
     POINT * (*getPathBounds)(struct _ARC * arc,  POINT * point);
@@ -34,16 +35,24 @@ typedef struct _ARC
     void (*addVertex)(struct _ARC * arc, VERTEX * vertex);
 
     /**
-     * @brief draw the arc
+     * @brief edit the arc's properties and attributes
      * 
      */
-    void (*draw)(struct _ARC * arc, cairo_t * cr);
+    void (*edit)(struct _ARC * arc,  EDITOR * editor);
+
+} ARC_OPERATIONS, *ARC_OPERATIONS_P;
+
+typedef struct _ARC
+ {
+     struct _ARTIFACT artifact;
+
+    struct _PAINTER painter;
 
     /**
-     * @brief edit the arc's properties and attributes
+     * @brief the arc's operations (shared by all the arcs)
      * 
      */
-    void (*edit)(struct _ARC * arc,  EDITOR * editor);
+    const struct _ARC_OPERATIONS * operations;
 
     struct _NET * net;
 
@@ -54,6 +63,12 @@ typedef struct _ARC
 
     int weight;
 
+    /**
+     * @brief the arc's index within the net's arcs (NO_SLOT if not held by the net)
+     * 
+     */
+    int slot;
+
 } ARC, * ARC_P;
 
 
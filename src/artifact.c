@@ -21,4 +21,5 @@ ARTIFACT *setup_artifact(ARTIFACT *artifact, int enabled, enum STATE state, int
     artifact->enabled = enabled;
     artifact->state = state;
     artifact->selected = selected;
+    artifact->highlighted = FALSE;
 }
\ No newline at end of file
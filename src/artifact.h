@@ -18,6 +18,12 @@
  */
 #define TO_ARTIFACT(artifact) ((ARTIFACT *)(artifact))
 
+/**
+ * @brief the slot of an artifact that is not held by a net
+ *
+ */
+#define NO_SLOT (-1)
+
 /**
  * @brief enable states
  * 
@@ -53,6 +59,13 @@ typedef struct _ARTIFACT
      */
     int state;
 
+    /**
+     * @brief '1' the artifact is highlighted by an analysis (e.g. an unbounded place, an invariant's support or a
+     *        siphon), '0' not highlighted
+     *
+     */
+    int highlighted;
+
 } ARTIFACT, *ARTIFACT_P;
 
 extern ARTIFACT * setup_artifact(struct _ARTIFACT *artifact, int enabled, enum STATE state, int selected);
@@ -0,0 +1,543 @@
+/**
+ * @file automaton.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  builds the Buchi automaton of a negated LTL property by expanding its tableau
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "property.h"
+#include "automaton.h"
+
+/**
+ * @brief the bit of a subformula in a set
+ *
+ */
+#define AUTOMATON_BIT(formula) (1ULL << (formula))
+
+/**
+ * @brief the incoming state of the initial states
+ *
+ */
+#define AUTOMATON_INITIAL -1
+
+/**
+ * @brief private structure - a state being expanded: the subformulas still to be expanded, those expanded (which
+ *        must hold now) and those that must hold next, and the state it was reached from
+ *
+ */
+typedef struct _AUTOMATON_PENDING
+{
+    int incoming;
+    unsigned long long fresh;
+    unsigned long long now;
+    unsigned long long next;
+
+} AUTOMATON_PENDING, *AUTOMATON_PENDING_P;
+
+/**
+ * @brief private structure - the states expanded so far (each with the states it is reached from) and the states
+ *        still being expanded
+ *
+ */
+typedef struct _AUTOMATON_TABLEAU
+{
+    unsigned long long *now;
+    unsigned long long *next;
+    int **incoming;
+    int *incomingCount;
+    int *incomingCapacity;
+    int count;
+    int capacity;
+
+    AUTOMATON_PENDING *pending;
+    int pendingCount;
+    int pendingCapacity;
+
+} AUTOMATON_TABLEAU, *AUTOMATON_TABLEAU_P;
+
+/**
+ * @brief add a subformula (an equal subformula is shared) - returns its index, -1 if there are too many
+ *
+ */
+int automaton_formula(AUTOMATON *automaton, enum PROPERTY_OPERATOR operator, int left, int right, int atom,
+                      int negated)
+{
+
+    for (int iFormula = 0; iFormula < automaton->formulas; iFormula++)
+    {
+        if (automaton->operators[iFormula] == (int)operator && automaton->lefts[iFormula] == left &&
+            automaton->rights[iFormula] == right && automaton->atoms[iFormula] == atom &&
+            automaton->negated[iFormula] == negated)
+        {
+            return iFormula;
+        }
+    }
+
+    if (automaton->formulas == AUTOMATON_MAXIMUM_FORMULAS || (left == -1 && operator >= AND_OPERATOR))
+    {
+        return -1;
+    }
+
+    automaton->operators[automaton->formulas] = operator;
+    automaton->lefts[automaton->formulas] = left;
+    automaton->rights[automaton->formulas] = right;
+    automaton->atoms[automaton->formulas] = atom;
+    automaton->negated[automaton->formulas] = negated;
+
+    return automaton->formulas++;
+}
+
+/**
+ * @brief the negation normal form of a property's node (negated if asked) - negations are pushed down to the atoms
+ *        (!(f U g) is !f R !g, !X f is X !f), returns -1 if there are too many subformulas
+ *
+ */
+int automaton_normal(AUTOMATON *automaton, int node, int negated)
+{
+    PROPERTY_NODE *formula = &automaton->property->nodes[node];
+    int left = -1;
+    int right = -1;
+
+    switch (formula->operator)
+    {
+    case TRUE_OPERATOR:
+    case FALSE_OPERATOR:
+        return automaton_formula(automaton, (formula->operator == TRUE_OPERATOR) != negated ? TRUE_OPERATOR
+                                                                                             : FALSE_OPERATOR,
+                                 -1, -1, -1, FALSE);
+    case COMPARE_OPERATOR:
+    case ENABLED_OPERATOR:
+    case DEAD_OPERATOR:
+        return automaton_formula(automaton, COMPARE_OPERATOR, -1, -1, node, negated);
+    case NOT_OPERATOR:
+        return automaton_normal(automaton, formula->left, !negated);
+    case AND_OPERATOR:
+    case OR_OPERATOR:
+        left = automaton_normal(automaton, formula->left, negated);
+        right = automaton_normal(automaton, formula->right, negated);
+
+        return right < 0 ? -1
+                         : automaton_formula(automaton,
+                                             (formula->operator == AND_OPERATOR) != negated ? AND_OPERATOR
+                                                                                            : OR_OPERATOR,
+                                             left, right, -1, FALSE);
+    case NEXT_OPERATOR:
+        return automaton_formula(automaton, NEXT_OPERATOR, automaton_normal(automaton, formula->left, negated), -1, -1,
+                                 FALSE);
+    case UNTIL_OPERATOR:
+    case RELEASE_OPERATOR:
+        left = automaton_normal(automaton, formula->left, negated);
+        right = automaton_normal(automaton, formula->right, negated);
+
+        return right < 0 ? -1
+                         : automaton_formula(automaton,
+                                             (formula->operator == UNTIL_OPERATOR) != negated ? UNTIL_OPERATOR
+                                                                                              : RELEASE_OPERATOR,
+                                             left, right, -1, FALSE);
+    default:
+        return -1;
+    }
+}
+
+/**
+ * @brief push a state to be expanded
+ *
+ */
+void automaton_push(AUTOMATON_TABLEAU *tableau, int incoming, unsigned long long fresh, unsigned long long now,
+                    unsigned long long next)
+{
+    AUTOMATON_PENDING *pending = NULL;
+
+    if (tableau->pendingCount == tableau->pendingCapacity)
+    {
+        tableau->pendingCapacity *= 2;
+        tableau->pending = realloc(tableau->pending, sizeof(AUTOMATON_PENDING) * tableau->pendingCapacity);
+    }
+
+    pending = &tableau->pending[tableau->pendingCount++];
+
+    pending->incoming = incoming;
+    pending->fresh = fresh;
+    pending->now = now;
+    pending->next = next;
+}
+
+/**
+ * @brief add an incoming state to a state (once)
+ *
+ */
+void automaton_add_incoming(AUTOMATON_TABLEAU *tableau, int state, int incoming)
+{
+
+    for (int iIncoming = 0; iIncoming < tableau->incomingCount[state]; iIncoming++)
+    {
+        if (tableau->incoming[state][iIncoming] == incoming)
+        {
+            return;
+        }
+    }
+
+    if (tableau->incomingCount[state] == tableau->incomingCapacity[state])
+    {
+        tableau->incomingCapacity[state] *= 2;
+        tableau->incoming[state] =
+            realloc(tableau->incoming[state], sizeof(int) * tableau->incomingCapacity[state]);
+    }
+
+    tableau->incoming[state][tableau->incomingCount[state]++] = incoming;
+}
+
+/**
+ * @brief a fully expanded state - merged with the state holding the same subformulas now and next, otherwise added
+ *        and its successor (the subformulas to hold next) is expanded
+ *
+ */
+void automaton_close(AUTOMATON_TABLEAU *tableau, AUTOMATON_PENDING *pending)
+{
+    int state = tableau->count;
+
+    for (int iState = 0; iState < tableau->count; iState++)
+    {
+        if (tableau->now[iState] == pending->now && tableau->next[iState] == pending->next)
+        {
+            automaton_add_incoming(tableau, iState, pending->incoming);
+
+            return;
+        }
+    }
+
+    if (tableau->count == tableau->capacity)
+    {
+        tableau->capacity *= 2;
+        tableau->now = realloc(tableau->now, sizeof(unsigned long long) * tableau->capacity);
+        tableau->next = realloc(tableau->next, sizeof(unsigned long long) * tableau->capacity);
+        tableau->incoming = realloc(tableau->incoming, sizeof(int *) * tableau->capacity);
+        tableau->incomingCount = realloc(tableau->incomingCount, sizeof(int) * tableau->capacity);
+        tableau->incomingCapacity = realloc(tableau->incomingCapacity, sizeof(int) * tableau->capacity);
+    }
+
+    tableau->now[state] = pending->now;
+    tableau->next[state] = pending->next;
+    tableau->incomingCapacity[state] = 4;
+    tableau->incomingCount[state] = 0;
+    tableau->incoming[state] = malloc(sizeof(int) * tableau->incomingCapacity[state]);
+    tableau->count += 1;
+
+    automaton_add_incoming(tableau, state, pending->incoming);
+    automaton_push(tableau, state, pending->next, 0, 0);
+}
+
+/**
+ * @brief expand the states until every state is fully expanded - a state's subformulas are expanded one at a time
+ *        (a disjunction, until or release splits the state in two, a contradiction discards it)
+ *
+ */
+void automaton_expand(AUTOMATON *automaton, AUTOMATON_TABLEAU *tableau, int root)
+{
+    int *complements = malloc(sizeof(int) * (automaton->formulas + 1));
+
+    for (int iFormula = 0; iFormula < automaton->formulas; iFormula++)
+    {
+        complements[iFormula] = -1;
+
+        for (int iOther = 0; iOther < automaton->formulas && automaton->operators[iFormula] == COMPARE_OPERATOR;
+             iOther++)
+        {
+            if (automaton->operators[iOther] == COMPARE_OPERATOR &&
+                automaton->atoms[iOther] == automaton->atoms[iFormula] &&
+                automaton->negated[iOther] != automaton->negated[iFormula])
+            {
+                complements[iFormula] = iOther;
+            }
+        }
+    }
+
+    automaton_push(tableau, AUTOMATON_INITIAL, AUTOMATON_BIT(root), 0, 0);
+
+    while (tableau->pendingCount > 0)
+    {
+        AUTOMATON_PENDING pending = tableau->pending[--tableau->pendingCount];
+        int formula = 0;
+        unsigned long long left = 0;
+        unsigned long long right = 0;
+
+        if (pending.fresh == 0)
+        {
+            automaton_close(tableau, &pending);
+
+            continue;
+        }
+
+        formula = __builtin_ctzll(pending.fresh);
+
+        pending.fresh &= ~AUTOMATON_BIT(formula);
+
+        if (automaton->operators[formula] == FALSE_OPERATOR ||
+            (complements[formula] >= 0 && (pending.now & AUTOMATON_BIT(complements[formula])) != 0))
+        {
+            continue;
+        }
+
+        left = automaton->lefts[formula] >= 0 ? AUTOMATON_BIT(automaton->lefts[formula]) & ~pending.now : 0;
+        right = automaton->rights[formula] >= 0 ? AUTOMATON_BIT(automaton->rights[formula]) & ~pending.now : 0;
+
+        pending.now |= AUTOMATON_BIT(formula);
+
+        switch (automaton->operators[formula])
+        {
+        case AND_OPERATOR:
+            automaton_push(tableau, pending.incoming, pending.fresh | left | right, pending.now, pending.next);
+            break;
+        case OR_OPERATOR:
+            automaton_push(tableau, pending.incoming, pending.fresh | left, pending.now, pending.next);
+            automaton_push(tableau, pending.incoming, pending.fresh | right, pending.now, pending.next);
+            break;
+        case UNTIL_OPERATOR:
+            // f U g - f now and f U g next, or g now
+            automaton_push(tableau, pending.incoming, pending.fresh | left, pending.now,
+                           pending.next | AUTOMATON_BIT(formula));
+            automaton_push(tableau, pending.incoming, pending.fresh | right, pending.now, pending.next);
+            break;
+        case RELEASE_OPERATOR:
+            // f R g - g now and f R g next, or f and g now
+            automaton_push(tableau, pending.incoming, pending.fresh | right, pending.now,
+                           pending.next | AUTOMATON_BIT(formula));
+            automaton_push(tableau, pending.incoming, pending.fresh | left | right, pending.now, pending.next);
+            break;
+        case NEXT_OPERATOR:
+            automaton_push(tableau, pending.incoming, pending.fresh, pending.now,
+                           pending.next | AUTOMATON_BIT(automaton->lefts[formula]));
+            break;
+        default:
+            automaton_push(tableau, pending.incoming, pending.fresh, pending.now, pending.next);
+            break;
+        }
+    }
+
+    free(complements);
+}
+
+/**
+ * @brief build the automaton from the expanded states - the successors of a state are the states it is incoming to
+ *
+ */
+void automaton_build(AUTOMATON *automaton, AUTOMATON_TABLEAU *tableau)
+{
+    unsigned long long literals = 0;
+    int *fill = calloc(tableau->count + 1, sizeof(int));
+    int sets = 0;
+
+    automaton->states = tableau->count;
+    automaton->initial = malloc(sizeof(int) * (tableau->count + 1));
+    automaton->initialCount = 0;
+    automaton->successorStart = calloc(tableau->count + 1, sizeof(int));
+    automaton->labels = malloc(sizeof(unsigned long long) * (tableau->count + 1));
+    automaton->acceptance = calloc(tableau->count + 1, sizeof(unsigned long long));
+
+    for (int iFormula = 0; iFormula < automaton->formulas; iFormula++)
+    {
+        if (automaton->operators[iFormula] == COMPARE_OPERATOR)
+        {
+            literals |= AUTOMATON_BIT(iFormula);
+        }
+    }
+
+    for (int iState = 0; iState < tableau->count; iState++)
+    {
+        automaton->labels[iState] = tableau->now[iState] & literals;
+
+        for (int iIncoming = 0; iIncoming < tableau->incomingCount[iState]; iIncoming++)
+        {
+            if (tableau->incoming[iState][iIncoming] == AUTOMATON_INITIAL)
+            {
+                automaton->initial[automaton->initialCount++] = iState;
+            }
+            else
+            {
+                automaton->successorStart[tableau->incoming[iState][iIncoming] + 1] += 1;
+            }
+        }
+    }
+
+    for (int iState = 0; iState < tableau->count; iState++)
+    {
+        automaton->successorStart[iState + 1] += automaton->successorStart[iState];
+    }
+
+    automaton->successors = malloc(sizeof(int) * (automaton->successorStart[tableau->count] + 1));
+
+    for (int iState = 0; iState < tableau->count; iState++)
+    {
+        for (int iIncoming = 0; iIncoming < tableau->incomingCount[iState]; iIncoming++)
+        {
+            int source = tableau->incoming[iState][iIncoming];
+
+            if (source != AUTOMATON_INITIAL)
+            {
+                automaton->successors[automaton->successorStart[source] + fill[source]++] = iState;
+            }
+        }
+    }
+
+    // each f U g is an acceptance set - the states not promising it or already fulfilling it
+    for (int iFormula = 0; iFormula < automaton->formulas; iFormula++)
+    {
+        if (automaton->operators[iFormula] != UNTIL_OPERATOR)
+        {
+            continue;
+        }
+
+        for (int iState = 0; iState < tableau->count; iState++)
+        {
+            if ((tableau->now[iState] & AUTOMATON_BIT(iFormula)) == 0 ||
+                (tableau->now[iState] & AUTOMATON_BIT(automaton->rights[iFormula])) != 0)
+            {
+                automaton->acceptance[iState] |= AUTOMATON_BIT(sets);
+            }
+        }
+
+        sets += 1;
+    }
+
+    if (sets == 0)
+    {
+        for (int iState = 0; iState < tableau->count; iState++)
+        {
+            automaton->acceptance[iState] = 1;
+        }
+
+        sets = 1;
+    }
+
+    automaton->sets = sets;
+
+    free(fill);
+}
+
+/**
+ * @brief returns true if each literal of a state's label holds of a marking
+ *
+ */
+int automaton_holds(AUTOMATON *automaton, int state, const unsigned int *marking)
+{
+
+    for (unsigned long long label = automaton->labels[state]; label != 0; label &= label - 1)
+    {
+        int formula = __builtin_ctzll(label);
+
+        if (automaton->property->holds(automaton->property, automaton->atoms[formula], marking) ==
+            automaton->negated[formula])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief the count after leaving a state - it moves on once the state is in the set counted
+ *
+ */
+int automaton_next(AUTOMATON *automaton, int state, int count)
+{
+
+    return (automaton->acceptance[state] & AUTOMATON_BIT(count)) != 0 ? (count + 1) % automaton->sets : count;
+}
+
+/**
+ * @brief returns true if a state with a count is accepting - the count is zero and the state is in the first set
+ *
+ */
+int automaton_accepting(AUTOMATON *automaton, int state, int count)
+{
+
+    return count == 0 && (automaton->acceptance[state] & 1) != 0;
+}
+
+/**
+ * @brief release/free the automaton object
+ *
+ */
+void automaton_release(AUTOMATON *automaton)
+{
+
+    free(automaton->initial);
+    free(automaton->successorStart);
+    free(automaton->successors);
+    free(automaton->operators);
+    free(automaton->lefts);
+    free(automaton->rights);
+    free(automaton->atoms);
+    free(automaton->negated);
+    free(automaton->labels);
+    free(automaton->acceptance);
+
+    free(automaton);
+}
+
+/**
+ * @brief automaton constructor - the automaton of the negated property
+ *
+ */
+AUTOMATON *create_automaton(PROPERTY *property)
+{
+    AUTOMATON *automaton = malloc(sizeof(AUTOMATON));
+    AUTOMATON_TABLEAU tableau;
+    int root = -1;
+
+    automaton->property = property;
+    automaton->formulas = 0;
+    automaton->operators = malloc(sizeof(int) * AUTOMATON_MAXIMUM_FORMULAS);
+    automaton->lefts = malloc(sizeof(int) * AUTOMATON_MAXIMUM_FORMULAS);
+    automaton->rights = malloc(sizeof(int) * AUTOMATON_MAXIMUM_FORMULAS);
+    automaton->atoms = malloc(sizeof(int) * AUTOMATON_MAXIMUM_FORMULAS);
+    automaton->negated = malloc(sizeof(int) * AUTOMATON_MAXIMUM_FORMULAS);
+
+    tableau.capacity = 16;
+    tableau.count = 0;
+    tableau.now = malloc(sizeof(unsigned long long) * tableau.capacity);
+    tableau.next = malloc(sizeof(unsigned long long) * tableau.capacity);
+    tableau.incoming = malloc(sizeof(int *) * tableau.capacity);
+    tableau.incomingCount = malloc(sizeof(int) * tableau.capacity);
+    tableau.incomingCapacity = malloc(sizeof(int) * tableau.capacity);
+    tableau.pendingCapacity = 16;
+    tableau.pendingCount = 0;
+    tableau.pending = malloc(sizeof(AUTOMATON_PENDING) * tableau.pendingCapacity);
+
+    if (property->root >= 0 && (root = automaton_normal(automaton, property->root, TRUE)) >= 0)
+    {
+        automaton_expand(automaton, &tableau, root);
+    }
+
+    automaton->overflow = root < 0;
+
+    automaton_build(automaton, &tableau);
+
+    for (int iState = 0; iState < tableau.count; iState++)
+    {
+        free(tableau.incoming[iState]);
+    }
+
+    free(tableau.now);
+    free(tableau.next);
+    free(tableau.incoming);
+    free(tableau.incomingCount);
+    free(tableau.incomingCapacity);
+    free(tableau.pending);
+
+    automaton->holds = automaton_holds;
+    automaton->next = automaton_next;
+    automaton->accepting = automaton_accepting;
+    automaton->release = automaton_release;
+
+    return automaton;
+}
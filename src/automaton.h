@@ -0,0 +1,117 @@
+/**
+ * @file automaton.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - a Buchi automaton accepting the runs that violate an LTL property (tableau construction)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef AUTOMATON_H_INCLUDED
+#define AUTOMATON_H_INCLUDED
+
+#include "model.h"
+#include "property.h"
+
+/**
+ * @brief casts an object to an automaton
+ *
+ */
+#define TO_AUTOMATON(automaton) ((AUTOMATON *)(automaton))
+
+/**
+ * @brief the most subformulas of the negated property (each is a bit of a state's sets)
+ *
+ */
+#define AUTOMATON_MAXIMUM_FORMULAS 64
+
+/**
+ * @brief the automaton's interface - the negated property is put in negation normal form and expanded into states
+ *        (Gerth, Peled, Vardi and Wolper); a state is labelled by the atomic propositions it requires of the marking
+ *        read on entering it, and each 'f U g' gives an acceptance set (the states not promising it, or fulfilling
+ *        it). The sets are combined by counting (degeneralised): a run is accepted if it passes through a state of
+ *        the first set with the count at zero infinitely often - see next
+ *
+ */
+typedef struct _AUTOMATON
+{
+
+    /**
+     * @brief returns true if a state's label holds of a marking
+     *
+     */
+    int (*holds)(struct _AUTOMATON *automaton, int state, const unsigned int *marking);
+
+    /**
+     * @brief the count after leaving a state with a count
+     *
+     */
+    int (*next)(struct _AUTOMATON *automaton, int state, int count);
+
+    /**
+     * @brief returns true if a state with a count is accepting
+     *
+     */
+    int (*accepting)(struct _AUTOMATON *automaton, int state, int count);
+
+    /**
+     * @brief release the automaton and deallocate resources (the property is not released)
+     *
+     */
+    void (*release)(struct _AUTOMATON *automaton);
+
+    /**
+     * @brief the property (LTL)
+     *
+     */
+    PROPERTY *property;
+
+    /**
+     * @brief true if the negated property has too many subformulas (the automaton has no states)
+     *
+     */
+    int overflow;
+
+    /**
+     * @brief the number of states, the initial states and the successors of state 's' -
+     *        successors[successorStart[s]] .. successors[successorStart[s + 1]]
+     *
+     */
+    int states;
+    int *initial;
+    int initialCount;
+    int *successorStart;
+    int *successors;
+
+    /**
+     * @brief the number of acceptance sets (at least one)
+     *
+     */
+    int sets;
+
+    /**
+     * @brief private (the subformulas - their operator, operands, the property's atom and whether it is negated)
+     *
+     */
+    int formulas;
+    int *operators;
+    int *lefts;
+    int *rights;
+    int *atoms;
+    int *negated;
+
+    /**
+     * @brief private (each state's literals (atoms or negated atoms - bits of the subformulas) and the acceptance
+     *        sets it is in)
+     *
+     */
+    unsigned long long *labels;
+    unsigned long long *acceptance;
+
+} AUTOMATON, *AUTOMATON_P;
+
+extern AUTOMATON *create_automaton(PROPERTY *property);
+
+#endif // AUTOMATON_H_INCLUDED
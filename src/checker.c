@@ -0,0 +1,1060 @@
+/**
+ * @file checker.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  checks a temporal property on the fly - local fixpoints for CTL, a nested depth first search for LTL
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "explorer.h"
+#include "property.h"
+#include "automaton.h"
+#include "checker.h"
+
+/**
+ * @brief the values of a subformula at a state - ACTIVE is on the search stack, VISITED was searched but is not yet
+ *        known
+ *
+ */
+#define CHECKER_UNKNOWN 0
+#define CHECKER_TRUE 1
+#define CHECKER_FALSE 2
+#define CHECKER_ACTIVE 3
+#define CHECKER_VISITED 4
+
+/**
+ * @brief the colours of a product state (Schwoon and Esparza) - CYAN is on the outer search stack, BLUE has been
+ *        searched, RED has been searched by an inner search
+ *
+ */
+#define CHECKER_WHITE 0
+#define CHECKER_CYAN 1
+#define CHECKER_BLUE 2
+#define CHECKER_RED 3
+
+/**
+ * @brief returned for a successor when the limit of states is reached
+ *
+ */
+#define CHECKER_EXHAUSTED -2
+
+/**
+ * @brief private structure - a state on a search stack: the next transition to try, the enabled transitions found
+ *        (-1 once a dead marking has stuttered) and the transition it was reached by; a product state also holds the
+ *        marking it is moving to and the next automaton successor to pair it with
+ *
+ */
+typedef struct _CHECKER_FRAME
+{
+    int state;
+    int transition;
+    int fired;
+    int arrival;
+
+    int target;
+    int move;
+    int successor;
+
+} CHECKER_FRAME, *CHECKER_FRAME_P;
+
+/**
+ * @brief private structure - a search stack
+ *
+ */
+typedef struct _CHECKER_STACK
+{
+    CHECKER_FRAME *frames;
+    int count;
+    int capacity;
+
+} CHECKER_STACK, *CHECKER_STACK_P;
+
+/**
+ * @brief push a state - returns its frame
+ *
+ */
+CHECKER_FRAME *checker_push(CHECKER_STACK *stack, int state, int arrival)
+{
+    CHECKER_FRAME *frame = NULL;
+
+    if (stack->count == stack->capacity)
+    {
+        stack->capacity = stack->capacity * 2 + 64;
+        stack->frames = realloc(stack->frames, sizeof(CHECKER_FRAME) * stack->capacity);
+    }
+
+    frame = &stack->frames[stack->count++];
+
+    frame->state = state;
+    frame->transition = 0;
+    frame->fired = 0;
+    frame->arrival = arrival;
+    frame->target = -1;
+    frame->move = CHECKER_STUTTER;
+    frame->successor = 0;
+
+    return frame;
+}
+
+/**
+ * @brief widen the codec so the marking fits - the store is rebuilt (in the same order, so states keep their index)
+ *
+ */
+void checker_widen(CHECKER *checker, const unsigned int *marking)
+{
+    CODEC *codec = checker->codec->widen(checker->codec, marking);
+    STORE *store = create_store(codec->words);
+    unsigned int *unpacked = malloc(sizeof(unsigned int) * (checker->model->places + 1));
+
+    checker->packed = realloc(checker->packed, sizeof(unsigned int) * (codec->words + 1));
+
+    for (int iState = 0; iState < checker->store->count; iState++)
+    {
+        checker->codec->decode(checker->codec, checker->store->get(checker->store, iState), unpacked);
+        codec->encode(codec, unpacked, checker->packed);
+        store->insert(store, checker->packed, NULL);
+    }
+
+    checker->store->release(checker->store);
+    checker->codec->release(checker->codec);
+
+    checker->store = store;
+    checker->codec = codec;
+    checker->widenings += 1;
+
+    free(unpacked);
+}
+
+/**
+ * @brief insert a marking - returns its state, CHECKER_EXHAUSTED if it is new and the limit is reached
+ *
+ */
+int checker_insert(CHECKER *checker, const unsigned int *marking)
+{
+    int state = 0;
+
+    if (!checker->codec->fits(checker->codec, marking))
+    {
+        checker_widen(checker, marking);
+    }
+
+    checker->codec->encode(checker->codec, marking, checker->packed);
+
+    if (checker->limit > 0 && checker->store->count >= checker->limit &&
+        checker->store->find(checker->store, checker->packed) < 0)
+    {
+        checker->exhausted = TRUE;
+
+        return CHECKER_EXHAUSTED;
+    }
+
+    state = checker->store->insert(checker->store, checker->packed, NULL);
+
+    if (checker->store->count > checker->valueCapacity)
+    {
+        int capacity = checker->valueCapacity * 2;
+
+        for (int iNode = 0; iNode < checker->property->count; iNode++)
+        {
+            if (checker->values[iNode] != NULL)
+            {
+                checker->values[iNode] = realloc(checker->values[iNode], capacity);
+                memset(checker->values[iNode] + checker->valueCapacity, CHECKER_UNKNOWN,
+                       capacity - checker->valueCapacity);
+            }
+        }
+
+        checker->valueCapacity = capacity;
+    }
+
+    return state;
+}
+
+/**
+ * @brief decode a state into a buffer
+ *
+ */
+void checker_decode(CHECKER *checker, int state, unsigned int *marking)
+{
+
+    checker->codec->decode(checker->codec, checker->store->get(checker->store, state), marking);
+}
+
+/**
+ * @brief the next transition enabled in a marking from 'first' on - returns -1 if there is none
+ *
+ */
+int checker_next_enabled(MODEL *model, const unsigned int *marking, int first)
+{
+
+    for (int iTransition = first; iTransition < model->transitions; iTransition++)
+    {
+        if (reduction_is_enabled(model, marking, iTransition))
+        {
+            return iTransition;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief fire a transition enabled in a marking - returns the successor state (or CHECKER_EXHAUSTED)
+ *
+ */
+int checker_fire(CHECKER *checker, const unsigned int *marking, int transition, unsigned int *successor)
+{
+    MODEL *model = checker->model;
+
+    memcpy(successor, marking, sizeof(unsigned int) * model->places);
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        successor[model->changePlaces[iChange]] += model->changeValues[iChange];
+    }
+
+    return checker_insert(checker, successor);
+}
+
+/**
+ * @brief the next successor of a state on a search stack (a dead marking is its own successor) - returns the
+ *        successor, -1 if there are no more, CHECKER_EXHAUSTED if the limit is reached; the transition fired is set
+ *
+ */
+int checker_successor(CHECKER *checker, CHECKER_FRAME *frame, unsigned int *marking, unsigned int *successor,
+                      int *transition)
+{
+    int enabled = 0;
+
+    if (frame->fired < 0)
+    {
+        return -1;
+    }
+
+    checker_decode(checker, frame->state, marking);
+
+    if ((enabled = checker_next_enabled(checker->model, marking, frame->transition)) < 0)
+    {
+        if (frame->fired > 0)
+        {
+            return -1;
+        }
+
+        frame->fired = -1;
+        *transition = CHECKER_STUTTER;
+
+        return frame->state;
+    }
+
+    frame->transition = enabled + 1;
+    frame->fired += 1;
+    *transition = enabled;
+
+    return checker_fire(checker, marking, enabled, successor);
+}
+
+/**
+ * @brief record the transitions by which the states on a stack were reached (from the second on) and a last one
+ *
+ */
+void checker_record(CHECKER *checker, CHECKER_STACK *stack, int last)
+{
+
+    if (checker->traceCount + stack->count + 1 > checker->traceCapacity)
+    {
+        checker->traceCapacity = checker->traceCount + stack->count + 1;
+        checker->trace = realloc(checker->trace, sizeof(int) * checker->traceCapacity);
+    }
+
+    for (int iFrame = 1; iFrame < stack->count; iFrame++)
+    {
+        checker->trace[checker->traceCount++] = stack->frames[iFrame].arrival;
+    }
+
+    checker->trace[checker->traceCount++] = last;
+}
+
+int checker_evaluate(CHECKER *checker, int node, int state);
+
+/**
+ * @brief settle a search - on success the states on the stack have the value true and the other states searched
+ *        are unknown again (they may reach a stack state), on failure every state searched is false
+ *
+ */
+void checker_settle(CHECKER *checker, int node, CHECKER_STACK *stack, int *visited, int visitedCount, int success)
+{
+    unsigned char *values = checker->values[node];
+
+    for (int iVisited = 0; iVisited < visitedCount; iVisited++)
+    {
+        values[visited[iVisited]] = success || checker->exhausted ? CHECKER_UNKNOWN : CHECKER_FALSE;
+    }
+
+    for (int iFrame = 0; iFrame < stack->count && success; iFrame++)
+    {
+        values[stack->frames[iFrame].state] = CHECKER_TRUE;
+    }
+}
+
+/**
+ * @brief EX f - some successor satisfies f
+ *
+ */
+int checker_next(CHECKER *checker, int node, int state)
+{
+    int operand = checker->property->nodes[node].left;
+    CHECKER_FRAME frame = {state, 0, 0, CHECKER_STUTTER, -1, CHECKER_STUTTER, 0};
+    int transition = CHECKER_STUTTER;
+    int successor = 0;
+    int value = FALSE;
+
+    if (checker->values[node][state] != CHECKER_UNKNOWN)
+    {
+        return checker->values[node][state] == CHECKER_TRUE;
+    }
+
+    while (!value && (successor = checker_successor(checker, &frame, checker->markings[node],
+                                                    checker->successors[node], &transition)) >= 0)
+    {
+        value = checker_evaluate(checker, operand, successor);
+    }
+
+    if (value && node == checker->traceNode && state == 0)
+    {
+        checker->trace[checker->traceCount++] = transition;
+    }
+
+    if (!checker->exhausted)
+    {
+        checker->values[node][state] = value ? CHECKER_TRUE : CHECKER_FALSE;
+    }
+
+    return value;
+}
+
+/**
+ * @brief E[f U g] - a least fixpoint found locally: a depth first search through the markings satisfying f for one
+ *        satisfying g
+ *
+ */
+int checker_until(CHECKER *checker, int node, int start)
+{
+    PROPERTY_NODE *formula = &checker->property->nodes[node];
+    CHECKER_STACK stack = {NULL, 0, 0};
+    int *visited = NULL;
+    int visitedCount = 0;
+    int visitedCapacity = 0;
+    int success = FALSE;
+
+    if (checker->values[node][start] == CHECKER_TRUE || checker->values[node][start] == CHECKER_FALSE)
+    {
+        return checker->values[node][start] == CHECKER_TRUE;
+    }
+
+    if (checker_evaluate(checker, formula->right, start))
+    {
+        checker->values[node][start] = CHECKER_TRUE;
+
+        return TRUE;
+    }
+
+    if (!checker_evaluate(checker, formula->left, start))
+    {
+        checker->values[node][start] = checker->exhausted ? CHECKER_UNKNOWN : CHECKER_FALSE;
+
+        return FALSE;
+    }
+
+    checker_push(&stack, start, CHECKER_STUTTER);
+    checker->values[node][start] = CHECKER_ACTIVE;
+
+    while (stack.count > 0 && !success && !checker->exhausted)
+    {
+        CHECKER_FRAME *frame = &stack.frames[stack.count - 1];
+        int transition = CHECKER_STUTTER;
+        int successor = checker_successor(checker, frame, checker->markings[node], checker->successors[node],
+                                          &transition);
+
+        if (successor < 0)
+        {
+            if (successor == -1)
+            {
+                if (visitedCount == visitedCapacity)
+                {
+                    visitedCapacity = visitedCapacity * 2 + 64;
+                    visited = realloc(visited, sizeof(int) * visitedCapacity);
+                }
+
+                visited[visitedCount++] = frame->state;
+                checker->values[node][frame->state] = CHECKER_VISITED;
+                stack.count -= 1;
+            }
+
+            continue;
+        }
+
+        if (checker->values[node][successor] == CHECKER_TRUE || (checker->values[node][successor] == CHECKER_UNKNOWN &&
+                                                                 checker_evaluate(checker, formula->right, successor)))
+        {
+            success = TRUE;
+
+            if (node == checker->traceNode && start == 0)
+            {
+                checker_record(checker, &stack, transition);
+            }
+        }
+        else if (checker->values[node][successor] == CHECKER_UNKNOWN && !checker->exhausted)
+        {
+            if (!checker_evaluate(checker, formula->left, successor))
+            {
+                checker->values[node][successor] = checker->exhausted ? CHECKER_UNKNOWN : CHECKER_FALSE;
+            }
+            else
+            {
+                checker_push(&stack, successor, transition);
+                checker->values[node][successor] = CHECKER_ACTIVE;
+            }
+        }
+    }
+
+    checker_settle(checker, node, &stack, visited, visitedCount, success);
+
+    for (int iFrame = 0; iFrame < stack.count && checker->exhausted; iFrame++)
+    {
+        checker->values[node][stack.frames[iFrame].state] = CHECKER_UNKNOWN;
+    }
+
+    free(stack.frames);
+    free(visited);
+
+    return success;
+}
+
+/**
+ * @brief EG f - a greatest fixpoint found locally: a depth first search through the markings satisfying f for a
+ *        cycle (or a dead marking, which repeats)
+ *
+ */
+int checker_globally(CHECKER *checker, int node, int start)
+{
+    PROPERTY_NODE *formula = &checker->property->nodes[node];
+    CHECKER_STACK stack = {NULL, 0, 0};
+    int *visited = NULL;
+    int visitedCount = 0;
+    int visitedCapacity = 0;
+    int success = FALSE;
+
+    if (checker->values[node][start] == CHECKER_TRUE || checker->values[node][start] == CHECKER_FALSE)
+    {
+        return checker->values[node][start] == CHECKER_TRUE;
+    }
+
+    if (!checker_evaluate(checker, formula->left, start))
+    {
+        checker->values[node][start] = checker->exhausted ? CHECKER_UNKNOWN : CHECKER_FALSE;
+
+        return FALSE;
+    }
+
+    checker_push(&stack, start, CHECKER_STUTTER);
+    checker->values[node][start] = CHECKER_ACTIVE;
+
+    while (stack.count > 0 && !success && !checker->exhausted)
+    {
+        CHECKER_FRAME *frame = &stack.frames[stack.count - 1];
+        int transition = CHECKER_STUTTER;
+        int successor = checker_successor(checker, frame, checker->markings[node], checker->successors[node],
+                                          &transition);
+        int value = successor >= 0 ? checker->values[node][successor] : CHECKER_UNKNOWN;
+
+        if (successor < 0)
+        {
+            if (successor == -1)
+            {
+                if (visitedCount == visitedCapacity)
+                {
+                    visitedCapacity = visitedCapacity * 2 + 64;
+                    visited = realloc(visited, sizeof(int) * visitedCapacity);
+                }
+
+                visited[visitedCount++] = frame->state;
+                checker->values[node][frame->state] = CHECKER_VISITED;
+                stack.count -= 1;
+            }
+
+            continue;
+        }
+
+        if (value == CHECKER_TRUE || value == CHECKER_ACTIVE)
+        {
+            success = TRUE;
+
+            if (node == checker->traceNode && start == 0)
+            {
+                checker_record(checker, &stack, transition);
+
+                // the cycle starts where the successor is on the stack
+                for (int iFrame = 0; iFrame < stack.count && value == CHECKER_ACTIVE; iFrame++)
+                {
+                    if (stack.frames[iFrame].state == successor)
+                    {
+                        checker->loopStart = iFrame;
+                    }
+                }
+            }
+        }
+        else if (value == CHECKER_UNKNOWN)
+        {
+            if (!checker_evaluate(checker, formula->left, successor))
+            {
+                checker->values[node][successor] = checker->exhausted ? CHECKER_UNKNOWN : CHECKER_FALSE;
+            }
+            else
+            {
+                checker_push(&stack, successor, transition);
+                checker->values[node][successor] = CHECKER_ACTIVE;
+            }
+        }
+    }
+
+    checker_settle(checker, node, &stack, visited, visitedCount, success);
+
+    for (int iFrame = 0; iFrame < stack.count && checker->exhausted; iFrame++)
+    {
+        checker->values[node][stack.frames[iFrame].state] = CHECKER_UNKNOWN;
+    }
+
+    free(stack.frames);
+    free(visited);
+
+    return success;
+}
+
+/**
+ * @brief the value of a subformula at a state
+ *
+ */
+int checker_evaluate(CHECKER *checker, int node, int state)
+{
+    PROPERTY_NODE *formula = &checker->property->nodes[node];
+
+    if (checker->exhausted)
+    {
+        return FALSE;
+    }
+
+    switch (formula->operator)
+    {
+    case NOT_OPERATOR:
+        return !checker_evaluate(checker, formula->left, state);
+    case AND_OPERATOR:
+        return checker_evaluate(checker, formula->left, state) && checker_evaluate(checker, formula->right, state);
+    case OR_OPERATOR:
+        return checker_evaluate(checker, formula->left, state) || checker_evaluate(checker, formula->right, state);
+    case EX_OPERATOR:
+        return checker_next(checker, node, state);
+    case EU_OPERATOR:
+        return checker_until(checker, node, state);
+    case EG_OPERATOR:
+        return checker_globally(checker, node, state);
+    case TRUE_OPERATOR:
+    case FALSE_OPERATOR:
+        return formula->operator == TRUE_OPERATOR;
+    default:
+        checker_decode(checker, state, checker->markings[node]);
+
+        return checker->property->holds(checker->property, node, checker->markings[node]);
+    }
+}
+
+/**
+ * @brief check a CTL property - the trace is kept from the outermost path quantifier (below any negations)
+ *
+ */
+enum CHECKER_RESULT checker_check_ctl(CHECKER *checker)
+{
+    PROPERTY *property = checker->property;
+    int negations = 0;
+    int node = property->root;
+    int value = FALSE;
+
+    while (property->nodes[node].operator == NOT_OPERATOR)
+    {
+        node = property->nodes[node].left;
+        negations += 1;
+    }
+
+    if (property->nodes[node].operator == EX_OPERATOR || property->nodes[node].operator == EU_OPERATOR ||
+        property->nodes[node].operator == EG_OPERATOR)
+    {
+        checker->traceNode = node;
+        checker->witness = negations % 2 == 0;
+    }
+
+    value = checker_evaluate(checker, property->root, 0);
+
+    if (checker->exhausted)
+    {
+        checker->traceCount = 0;
+        checker->loopStart = -1;
+
+        return UNKNOWN_RESULT;
+    }
+
+    return value ? HOLDS_RESULT : FAILS_RESULT;
+}
+
+/**
+ * @brief the colour of a product state
+ *
+ */
+unsigned char *checker_colour(CHECKER *checker, int state)
+{
+
+    if (state >= checker->colourCapacity)
+    {
+        int capacity = checker->colourCapacity;
+
+        while (state >= capacity)
+        {
+            capacity *= 2;
+        }
+
+        checker->colours = realloc(checker->colours, capacity);
+        memset(checker->colours + checker->colourCapacity, CHECKER_WHITE, capacity - checker->colourCapacity);
+        checker->colourCapacity = capacity;
+    }
+
+    return &checker->colours[state];
+}
+
+/**
+ * @brief the product state of a marking, an automaton state and a count
+ *
+ */
+int checker_product(CHECKER *checker, int marking, int state, int count)
+{
+    unsigned int key[3] = {(unsigned int)marking, (unsigned int)state, (unsigned int)count};
+    int product = checker->product->insert(checker->product, key, NULL);
+
+    checker_colour(checker, product);
+
+    return product;
+}
+
+/**
+ * @brief returns true if a product state is accepting
+ *
+ */
+int checker_accepting(CHECKER *checker, int product)
+{
+    const unsigned int *key = checker->product->get(checker->product, product);
+
+    return checker->automaton->accepting(checker->automaton, key[1], key[2]);
+}
+
+/**
+ * @brief the next successor of a product state on a search stack - each successor of the marking is paired with each
+ *        successor of the automaton state whose label it satisfies; returns -1 if there are no more (or
+ *        CHECKER_EXHAUSTED), the transition fired is set
+ *
+ */
+int checker_product_successor(CHECKER *checker, CHECKER_FRAME *frame, int *transition)
+{
+    AUTOMATON *automaton = checker->automaton;
+    unsigned int *marking = checker->markings[checker->property->count];
+    unsigned int *successor = checker->successors[checker->property->count];
+    const unsigned int *key = checker->product->get(checker->product, frame->state);
+    int state = (int)key[1];
+    int count = automaton->next(automaton, state, (int)key[2]);
+    CHECKER_FRAME system = {(int)key[0], frame->transition, frame->fired, CHECKER_STUTTER, -1, CHECKER_STUTTER, 0};
+
+    for (;;)
+    {
+        if (frame->target >= 0)
+        {
+            checker_decode(checker, frame->target, successor);
+
+            while (frame->successor < automaton->successorStart[state + 1])
+            {
+                int next = automaton->successors[frame->successor++];
+
+                if (automaton->holds(automaton, next, successor))
+                {
+                    *transition = frame->move;
+
+                    return checker_product(checker, frame->target, next, count);
+                }
+            }
+
+            frame->target = -1;
+        }
+
+        frame->target = checker_successor(checker, &system, marking, successor, &frame->move);
+        frame->transition = system.transition;
+        frame->fired = system.fired;
+        frame->successor = automaton->successorStart[state];
+
+        if (frame->target < 0)
+        {
+            return frame->target;
+        }
+    }
+}
+
+/**
+ * @brief record the counterexample - the outer stack, then the inner stack (which starts at the seed, the top of the
+ *        outer stack) and the step closing the cycle at a product state on the outer stack
+ *
+ */
+void checker_record_cycle(CHECKER *checker, CHECKER_STACK *outer, CHECKER_STACK *inner, int last, int closing)
+{
+
+    checker->traceCount = 0;
+    checker->traceCapacity = outer->count + inner->count + 1;
+    checker->trace = realloc(checker->trace, sizeof(int) * checker->traceCapacity);
+
+    for (int iFrame = 1; iFrame < outer->count; iFrame++)
+    {
+        checker->trace[checker->traceCount++] = outer->frames[iFrame].arrival;
+    }
+
+    for (int iFrame = 1; iFrame < inner->count; iFrame++)
+    {
+        checker->trace[checker->traceCount++] = inner->frames[iFrame].arrival;
+    }
+
+    checker->trace[checker->traceCount++] = last;
+
+    for (int iFrame = 0; iFrame < outer->count && checker->loopStart < 0; iFrame++)
+    {
+        if (outer->frames[iFrame].state == closing)
+        {
+            checker->loopStart = iFrame;
+        }
+    }
+}
+
+/**
+ * @brief the inner search from an accepting seed through the blue states - returns true if it reaches a cyan state
+ *        (an accepting cycle), false otherwise
+ *
+ */
+int checker_red(CHECKER *checker, CHECKER_STACK *outer, CHECKER_STACK *inner, int seed)
+{
+
+    inner->count = 0;
+
+    checker_push(inner, seed, CHECKER_STUTTER);
+
+    while (inner->count > 0 && !checker->exhausted)
+    {
+        int transition = CHECKER_STUTTER;
+        int successor = checker_product_successor(checker, &inner->frames[inner->count - 1], &transition);
+
+        if (successor < 0)
+        {
+            inner->count -= successor == -1 ? 1 : 0;
+
+            continue;
+        }
+
+        if (*checker_colour(checker, successor) == CHECKER_CYAN)
+        {
+            checker_record_cycle(checker, outer, inner, transition, successor);
+
+            return TRUE;
+        }
+
+        if (*checker_colour(checker, successor) == CHECKER_BLUE)
+        {
+            *checker_colour(checker, successor) = CHECKER_RED;
+
+            checker_push(inner, successor, transition);
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief the outer search from an initial product state - returns true if an accepting cycle was found
+ *
+ */
+int checker_blue(CHECKER *checker, CHECKER_STACK *outer, CHECKER_STACK *inner, int initial)
+{
+
+    outer->count = 0;
+
+    checker_push(outer, initial, CHECKER_STUTTER);
+    *checker_colour(checker, initial) = CHECKER_CYAN;
+
+    while (outer->count > 0 && !checker->exhausted)
+    {
+        CHECKER_FRAME *frame = &outer->frames[outer->count - 1];
+        int transition = CHECKER_STUTTER;
+        int state = frame->state;
+        int successor = checker_product_successor(checker, frame, &transition);
+
+        if (successor >= 0)
+        {
+            unsigned char colour = *checker_colour(checker, successor);
+
+            if (colour == CHECKER_CYAN && (checker_accepting(checker, state) || checker_accepting(checker, successor)))
+            {
+                inner->count = 0;
+
+                checker_record_cycle(checker, outer, inner, transition, successor);
+
+                return TRUE;
+            }
+
+            if (colour == CHECKER_WHITE)
+            {
+                checker_push(outer, successor, transition);
+                *checker_colour(checker, successor) = CHECKER_CYAN;
+            }
+
+            continue;
+        }
+
+        if (successor == CHECKER_EXHAUSTED)
+        {
+            continue;
+        }
+
+        if (checker_accepting(checker, state))
+        {
+            if (checker_red(checker, outer, inner, state))
+            {
+                return TRUE;
+            }
+
+            *checker_colour(checker, state) = CHECKER_RED;
+        }
+        else
+        {
+            *checker_colour(checker, state) = CHECKER_BLUE;
+        }
+
+        outer->count -= 1;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief check an LTL property - an accepting cycle of the product with the negated property's automaton is a
+ *        counterexample
+ *
+ */
+enum CHECKER_RESULT checker_check_ltl(CHECKER *checker)
+{
+    AUTOMATON *automaton = checker->automaton;
+    CHECKER_STACK outer = {NULL, 0, 0};
+    CHECKER_STACK inner = {NULL, 0, 0};
+    int found = FALSE;
+
+    checker->witness = FALSE;
+
+    checker_decode(checker, 0, checker->markings[checker->property->count]);
+
+    for (int iInitial = 0; iInitial < automaton->initialCount && !found && !checker->exhausted; iInitial++)
+    {
+        int product = -1;
+
+        if (!automaton->holds(automaton, automaton->initial[iInitial], checker->markings[checker->property->count]))
+        {
+            continue;
+        }
+
+        product = checker_product(checker, 0, automaton->initial[iInitial], 0);
+
+        if (*checker_colour(checker, product) == CHECKER_WHITE)
+        {
+            found = checker_blue(checker, &outer, &inner, product);
+        }
+
+        checker_decode(checker, 0, checker->markings[checker->property->count]);
+    }
+
+    checker->productStates = checker->product->count;
+
+    free(outer.frames);
+    free(inner.frames);
+
+    if (checker->exhausted && !found)
+    {
+        return UNKNOWN_RESULT;
+    }
+
+    return found ? FAILS_RESULT : HOLDS_RESULT;
+}
+
+/**
+ * @brief check the property
+ *
+ */
+enum CHECKER_RESULT checker_check(CHECKER *checker, int limit)
+{
+    double started = explorer_clock();
+
+    checker->limit = limit;
+    checker->exhausted = FALSE;
+    checker->traceCount = 0;
+    checker->loopStart = -1;
+    checker->traceNode = -1;
+    checker->witness = FALSE;
+    checker->productStates = 0;
+
+    if (checker->property->root < 0 || (checker->automaton != NULL && checker->automaton->overflow))
+    {
+        checker->result = UNKNOWN_RESULT;
+
+        return checker->result;
+    }
+
+    checker->store->clear(checker->store);
+    checker->product->clear(checker->product);
+
+    memset(checker->colours, CHECKER_WHITE, checker->colourCapacity);
+
+    for (int iNode = 0; iNode < checker->property->count; iNode++)
+    {
+        if (checker->values[iNode] != NULL)
+        {
+            memset(checker->values[iNode], CHECKER_UNKNOWN, checker->valueCapacity);
+        }
+    }
+
+    for (int iPlace = 0; iPlace < checker->model->places; iPlace++)
+    {
+        checker->view[iPlace] = checker->model->marking[iPlace];
+    }
+
+    checker_insert(checker, checker->view);
+
+    checker->result = checker->automaton != NULL ? checker_check_ltl(checker) : checker_check_ctl(checker);
+    checker->seconds = explorer_clock() - started;
+
+    return checker->result;
+}
+
+/**
+ * @brief the marking of a state
+ *
+ */
+const unsigned int *checker_get_marking(CHECKER *checker, int state)
+{
+
+    checker_decode(checker, state, checker->view);
+
+    return checker->view;
+}
+
+/**
+ * @brief release/free the checker object
+ *
+ */
+void checker_release(CHECKER *checker)
+{
+
+    for (int iNode = 0; iNode <= checker->property->count; iNode++)
+    {
+        if (iNode < checker->property->count)
+        {
+            free(checker->values[iNode]);
+        }
+
+        free(checker->markings[iNode]);
+        free(checker->successors[iNode]);
+    }
+
+    if (checker->automaton != NULL)
+    {
+        checker->automaton->release(checker->automaton);
+    }
+
+    checker->store->release(checker->store);
+    checker->codec->release(checker->codec);
+    checker->product->release(checker->product);
+
+    free(checker->values);
+    free(checker->markings);
+    free(checker->successors);
+    free(checker->packed);
+    free(checker->view);
+    free(checker->colours);
+    free(checker->trace);
+
+    free(checker);
+}
+
+/**
+ * @brief checker constructor - an LTL property's automaton is built at once
+ *
+ */
+CHECKER *create_checker(MODEL *model, PROPERTY *property)
+{
+    CHECKER *checker = malloc(sizeof(CHECKER));
+
+    checker->model = model;
+    checker->property = property;
+    checker->automaton = property->root >= 0 && property->logic == LTL_LOGIC ? create_automaton(property) : NULL;
+
+    checker->codec = create_codec_for_model(model);
+    checker->store = create_store(checker->codec->words);
+    checker->widenings = 0;
+    checker->packed = malloc(sizeof(unsigned int) * (checker->codec->words + 1));
+    checker->view = malloc(sizeof(unsigned int) * (model->places + 1));
+
+    checker->result = UNKNOWN_RESULT;
+    checker->traceCapacity = 64;
+    checker->trace = malloc(sizeof(int) * checker->traceCapacity);
+    checker->traceCount = 0;
+    checker->loopStart = -1;
+    checker->witness = FALSE;
+    checker->productStates = 0;
+    checker->seconds = 0;
+    checker->limit = 0;
+    checker->exhausted = FALSE;
+    checker->traceNode = -1;
+
+    checker->valueCapacity = STORE_INITIAL_SLOTS;
+    checker->values = calloc(property->count + 1, sizeof(unsigned char *));
+    checker->markings = malloc(sizeof(unsigned int *) * (property->count + 1));
+    checker->successors = malloc(sizeof(unsigned int *) * (property->count + 1));
+
+    for (int iNode = 0; iNode <= property->count; iNode++)
+    {
+        enum PROPERTY_OPERATOR operator = iNode < property->count ? property->nodes[iNode].operator : TRUE_OPERATOR;
+
+        if (operator == EX_OPERATOR || operator == EU_OPERATOR || operator == EG_OPERATOR)
+        {
+            checker->values[iNode] = calloc(checker->valueCapacity, sizeof(unsigned char));
+        }
+
+        checker->markings[iNode] = malloc(sizeof(unsigned int) * (model->places + 1));
+        checker->successors[iNode] = malloc(sizeof(unsigned int) * (model->places + 1));
+    }
+
+    checker->product = create_store(3);
+    checker->colourCapacity = STORE_INITIAL_SLOTS;
+    checker->colours = calloc(checker->colourCapacity, sizeof(unsigned char));
+
+    checker->check = checker_check;
+    checker->getMarking = checker_get_marking;
+    checker->release = checker_release;
+
+    return checker;
+}
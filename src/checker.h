@@ -0,0 +1,181 @@
+/**
+ * @file checker.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - checks a temporal property (CTL or LTL) while the reachable markings are generated
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef CHECKER_H_INCLUDED
+#define CHECKER_H_INCLUDED
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "property.h"
+#include "automaton.h"
+
+/**
+ * @brief casts an object to a checker
+ *
+ */
+#define TO_CHECKER(checker) ((CHECKER *)(checker))
+
+/**
+ * @brief the step of a trace that stays in a dead marking (a dead marking is its own successor)
+ *
+ */
+#define CHECKER_STUTTER -1
+
+/**
+ * @brief the outcome of a check
+ *
+ */
+enum CHECKER_RESULT
+{
+    HOLDS_RESULT = 0,
+    FAILS_RESULT,
+    /**
+     * @brief the limit of states was reached before the property was decided
+     *
+     */
+    UNKNOWN_RESULT,
+    END_CHECKER_RESULTS
+};
+
+/**
+ * @brief the checker's interface - the markings are generated depth first only as far as the property needs them (a
+ *        dead marking is its own successor, so every run is infinite), and the check stops as soon as it is decided:
+ *        - CTL: each subformula is evaluated at a marking on demand and remembered; E[f U g] and EG f are local
+ *          fixpoints - a search through the f markings for a g marking (or a cycle, or a dead marking) whose
+ *          markings are all known to satisfy the subformula once it succeeds, or all known not to once it fails
+ *        - LTL: the product of the markings and the automaton of the negated property is searched for an accepting
+ *          cycle by a nested depth first search (Schwoon and Esparza) - the first found is a counterexample
+ *        The trace is the witness (of E f, so the property holds) or the counterexample (of A f, so it fails) found by
+ *        the outermost path quantifier, if any
+ *
+ */
+typedef struct _CHECKER
+{
+
+    /**
+     * @brief check the property - generation stops once 'limit' markings are held (0 is no limit) and the result is
+     *        unknown
+     *
+     */
+    enum CHECKER_RESULT (*check)(struct _CHECKER *checker, int limit);
+
+    /**
+     * @brief the marking of a state (one entry per place) - valid until the next call
+     *
+     */
+    const unsigned int *(*getMarking)(struct _CHECKER *checker, int state);
+
+    /**
+     * @brief release the checker and deallocate resources (the model and the property are not released)
+     *
+     */
+    void (*release)(struct _CHECKER *checker);
+
+    /**
+     * @brief the compiled net and the property
+     *
+     */
+    MODEL *model;
+    PROPERTY *property;
+
+    /**
+     * @brief the automaton of the negated property (LTL only, NULL otherwise)
+     *
+     */
+    AUTOMATON *automaton;
+
+    /**
+     * @brief the markings generated (the initial marking is state 0), packed by the codec
+     *
+     */
+    STORE *store;
+    CODEC *codec;
+    int widenings;
+
+    /**
+     * @brief the result of the last check
+     *
+     */
+    enum CHECKER_RESULT result;
+
+    /**
+     * @brief the transitions of the trace from the initial marking (CHECKER_STUTTER stays in a dead marking); a
+     *        trace ending in a cycle repeats trace[loopStart] .. trace[traceCount - 1] (loopStart is -1 otherwise)
+     *
+     */
+    int *trace;
+    int traceCount;
+    int loopStart;
+
+    /**
+     * @brief true if the trace is a witness, false if it is a counterexample
+     *
+     */
+    int witness;
+
+    /**
+     * @brief the states of the product searched (LTL only)
+     *
+     */
+    int productStates;
+
+    /**
+     * @brief the time taken by the last check (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief private (the limit of states and true if it was reached)
+     *
+     */
+    int limit;
+    int exhausted;
+
+    /**
+     * @brief private (the value of each temporal subformula at each state - unknown, true, false, or being searched)
+     *        and the states they are held for
+     *
+     */
+    unsigned char **values;
+    int valueCapacity;
+
+    /**
+     * @brief private (the subformula whose search gives the trace, -1 if none)
+     *
+     */
+    int traceNode;
+    int traceCapacity;
+
+    /**
+     * @brief private (each subformula's marking and successor, a packed marking and the marking returned by
+     *        getMarking)
+     *
+     */
+    unsigned int **markings;
+    unsigned int **successors;
+    unsigned int *packed;
+    unsigned int *view;
+
+    /**
+     * @brief private (the product states - a marking, an automaton state and a count - and their colours)
+     *
+     */
+    STORE *product;
+    unsigned char *colours;
+    int colourCapacity;
+
+} CHECKER, *CHECKER_P;
+
+extern CHECKER *create_checker(MODEL *model, PROPERTY *property);
+
+#endif // CHECKER_H_INCLUDED
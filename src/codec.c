@@ -0,0 +1,200 @@
+/**
+ * @file codec.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  packs a marking into as few words as its places' bit widths allow
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "codec.h"
+
+/**
+ * @brief the number of bits needed to hold a value (at least one)
+ *
+ */
+int codec_bits_needed(unsigned int value)
+{
+    int bits = 1;
+
+    while (bits < CODEC_WORD_BITS && (value >> bits) != 0)
+    {
+        bits += 1;
+    }
+
+    return bits;
+}
+
+/**
+ * @brief pack a marking
+ *
+ */
+void codec_encode(CODEC *codec, const unsigned int *marking, unsigned int *packed)
+{
+
+    memset(packed, 0, sizeof(unsigned int) * codec->words);
+
+    for (int iPlace = 0; iPlace < codec->places; iPlace++)
+    {
+        packed[codec->offsets[iPlace]] |= marking[iPlace] << codec->shifts[iPlace];
+    }
+}
+
+/**
+ * @brief unpack a marking
+ *
+ */
+void codec_decode(CODEC *codec, const unsigned int *packed, unsigned int *marking)
+{
+
+    for (int iPlace = 0; iPlace < codec->places; iPlace++)
+    {
+        marking[iPlace] = (packed[codec->offsets[iPlace]] >> codec->shifts[iPlace]) & codec->limits[iPlace];
+    }
+}
+
+/**
+ * @brief set a place's field
+ *
+ */
+void codec_set(CODEC *codec, unsigned int *packed, int place, unsigned int tokens)
+{
+    unsigned int *word = &packed[codec->offsets[place]];
+
+    *word = (*word & ~(codec->limits[place] << codec->shifts[place])) | (tokens << codec->shifts[place]);
+}
+
+/**
+ * @brief returns true if the marking fits the fields
+ *
+ */
+int codec_fits(CODEC *codec, const unsigned int *marking)
+{
+
+    for (int iPlace = 0; iPlace < codec->places; iPlace++)
+    {
+        if (marking[iPlace] > codec->limits[iPlace])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief a wider codec - the places that overflow are given at least twice their width
+ *
+ */
+CODEC *codec_widen(CODEC *codec, const unsigned int *marking)
+{
+    int *widths = malloc(sizeof(int) * (codec->places + 1));
+    CODEC *wider = NULL;
+
+    for (int iPlace = 0; iPlace < codec->places; iPlace++)
+    {
+        widths[iPlace] = codec->widths[iPlace];
+
+        if (marking[iPlace] > codec->limits[iPlace])
+        {
+            int needed = codec_bits_needed(marking[iPlace]);
+
+            widths[iPlace] = needed > widths[iPlace] * 2 ? needed : widths[iPlace] * 2;
+        }
+    }
+
+    wider = create_codec(codec->places, widths);
+
+    free(widths);
+
+    return wider;
+}
+
+/**
+ * @brief release/free the codec object
+ *
+ */
+void codec_release(CODEC *codec)
+{
+
+    free(codec->widths);
+    free(codec->offsets);
+    free(codec->shifts);
+    free(codec->limits);
+
+    free(codec);
+}
+
+/**
+ * @brief codec constructor - the places are laid out in order, a field that would span a word starts the next
+ *
+ */
+CODEC *create_codec(int places, const int *widths)
+{
+    CODEC *codec = malloc(sizeof(CODEC));
+    int used = 0;
+
+    codec->places = places;
+    codec->words = 0;
+
+    codec->widths = malloc(sizeof(int) * (places + 1));
+    codec->offsets = malloc(sizeof(int) * (places + 1));
+    codec->shifts = malloc(sizeof(int) * (places + 1));
+    codec->limits = malloc(sizeof(unsigned int) * (places + 1));
+
+    for (int iPlace = 0; iPlace < places; iPlace++)
+    {
+        int width = widths[iPlace] < 1 ? 1 : widths[iPlace] > CODEC_WORD_BITS ? CODEC_WORD_BITS : widths[iPlace];
+
+        if (codec->words == 0 || used + width > CODEC_WORD_BITS)
+        {
+            codec->words += 1;
+            used = 0;
+        }
+
+        codec->widths[iPlace] = width;
+        codec->offsets[iPlace] = codec->words - 1;
+        codec->shifts[iPlace] = used;
+        codec->limits[iPlace] = width == CODEC_WORD_BITS ? ~0u : (1u << width) - 1;
+
+        used += width;
+    }
+
+    codec->encode = codec_encode;
+    codec->decode = codec_decode;
+    codec->set = codec_set;
+    codec->fits = codec_fits;
+    codec->widen = codec_widen;
+    codec->release = codec_release;
+
+    return codec;
+}
+
+/**
+ * @brief codec constructor - a place's width is taken from its declared bound, otherwise from its initial marking
+ *
+ */
+CODEC *create_codec_for_model(MODEL *model)
+{
+    int *widths = malloc(sizeof(int) * (model->places + 1));
+    CODEC *codec = NULL;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        int bound = model->bounds[iPlace] > model->marking[iPlace] ? model->bounds[iPlace] : model->marking[iPlace];
+
+        widths[iPlace] = codec_bits_needed((unsigned int)bound);
+    }
+
+    codec = create_codec(model->places, widths);
+
+    free(widths);
+
+    return codec;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file codec.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - packs a marking into as few words as its places' bit widths allow
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef CODEC_H_INCLUDED
+#define CODEC_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a codec
+ *
+ */
+#define TO_CODEC(codec) ((CODEC *)(codec))
+
+/**
+ * @brief the bits in a packed word (a place's field never spans two words)
+ *
+ */
+#define CODEC_WORD_BITS 32
+
+/**
+ * @brief the codec's interface - each place is given a field of 'widths[p]' bits at 'shifts[p]' in word
+ *        'offsets[p]'; two markings are equal if and only if their packed forms are equal, so a packed
+ *        marking can be hashed and compared as it is
+ *
+ */
+typedef struct _CODEC
+{
+
+    /**
+     * @brief pack a marking (the marking must fit - see fits)
+     *
+     */
+    void (*encode)(struct _CODEC *codec, const unsigned int *marking, unsigned int *packed);
+
+    /**
+     * @brief unpack a marking
+     *
+     */
+    void (*decode)(struct _CODEC *codec, const unsigned int *packed, unsigned int *marking);
+
+    /**
+     * @brief set one place's field of a packed marking (the tokens must fit - see limits)
+     *
+     */
+    void (*set)(struct _CODEC *codec, unsigned int *packed, int place, unsigned int tokens);
+
+    /**
+     * @brief returns true if every place's tokens fit its field, false otherwise
+     *
+     */
+    int (*fits)(struct _CODEC *codec, const unsigned int *marking);
+
+    /**
+     * @brief returns a new codec whose fields are wide enough for the marking (widths are at least doubled
+     *        for the places that overflow) - this codec is unchanged
+     *
+     */
+    struct _CODEC *(*widen)(struct _CODEC *codec, const unsigned int *marking);
+
+    /**
+     * @brief release the codec and deallocate resources
+     *
+     */
+    void (*release)(struct _CODEC *codec);
+
+    /**
+     * @brief the number of places
+     *
+     */
+    int places;
+
+    /**
+     * @brief the number of words in a packed marking
+     *
+     */
+    int words;
+
+    /**
+     * @brief the layout of each place's field - its width (bits), word and shift
+     *
+     */
+    int *widths;
+    int *offsets;
+    int *shifts;
+
+    /**
+     * @brief the most tokens each place's field holds
+     *
+     */
+    unsigned int *limits;
+
+} CODEC, *CODEC_P;
+
+extern CODEC *create_codec(int places, const int *widths);
+
+extern CODEC *create_codec_for_model(MODEL *model);
+
+extern int codec_bits_needed(unsigned int value);
+
+#endif // CODEC_H_INCLUDED
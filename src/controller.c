@@ -85,6 +85,16 @@ void controller_send(CONTROLLER *controller, EVENT *event)
                                     event->events.set_view_size.size.h + 64);
     }
     break;
+
+    case SHOW_MESSAGE:
+    {
+        GtkAlertDialog *alert = gtk_alert_dialog_new("%s", event->events.show_message.message);
+
+        gtk_alert_dialog_show(alert, GTK_WINDOW(controller->window));
+
+        g_object_unref(alert);
+    }
+    break;
     };
 
     if (event->disposal)
@@ -165,6 +175,66 @@ void controller_transition_clicked(GtkButton *button, gpointer user_data)
     controller_notify(TO_CONTROLLER(user_data), event);
 }
 
+/**
+ * @brief 'simulate' tool selected
+ *
+ */
+void controller_simulate_clicked(GtkButton *button, gpointer user_data)
+{
+    EVENT *event = create_event(TOOL_SELECTED, SIMULATE_TOOL);
+
+    GdkCursor *cursor = gdk_cursor_new_from_name("pointer", NULL);
+
+    gtk_widget_set_cursor(TO_CONTROLLER(user_data)->scrolledWindow, cursor);
+
+    controller_notify(TO_CONTROLLER(user_data), event);
+}
+
+/**
+ * @brief 'coverability' tool selected
+ *
+ */
+void controller_cover_clicked(GtkButton *button, gpointer user_data)
+{
+    EVENT *event = create_event(TOOL_SELECTED, COVER_TOOL);
+
+    GdkCursor *cursor = gdk_cursor_new_from_name("default", NULL);
+
+    gtk_widget_set_cursor(TO_CONTROLLER(user_data)->scrolledWindow, cursor);
+
+    controller_notify(TO_CONTROLLER(user_data), event);
+}
+
+/**
+ * @brief 'invariants' tool selected
+ *
+ */
+void controller_invariant_clicked(GtkButton *button, gpointer user_data)
+{
+    EVENT *event = create_event(TOOL_SELECTED, INVARIANT_TOOL);
+
+    GdkCursor *cursor = gdk_cursor_new_from_name("default", NULL);
+
+    gtk_widget_set_cursor(TO_CONTROLLER(user_data)->scrolledWindow, cursor);
+
+    controller_notify(TO_CONTROLLER(user_data), event);
+}
+
+/**
+ * @brief 'siphons' tool selected
+ *
+ */
+void controller_siphon_clicked(GtkButton *button, gpointer user_data)
+{
+    EVENT *event = create_event(TOOL_SELECTED, SIPHON_TOOL);
+
+    GdkCursor *cursor = gdk_cursor_new_from_name("default", NULL);
+
+    gtk_widget_set_cursor(TO_CONTROLLER(user_data)->scrolledWindow, cursor);
+
+    controller_notify(TO_CONTROLLER(user_data), event);
+}
+
 void controller_open(GObject *source_object, GAsyncResult *res, gpointer data)
 {
     GError *error = NULL;
@@ -461,6 +531,14 @@ CONTROLLER *create_controller(GtkApplication *gtkAppication,
             GTK_WIDGET(gtk_builder_get_object(builder, "placeButton"));
         controller->transitionButton =
             GTK_WIDGET(gtk_builder_get_object(builder, "transitionButton"));
+        controller->simulateButton =
+            GTK_WIDGET(gtk_builder_get_object(builder, "simulateButton"));
+        controller->coverButton =
+            GTK_WIDGET(gtk_builder_get_object(builder, "coverButton"));
+        controller->invariantButton =
+            GTK_WIDGET(gtk_builder_get_object(builder, "invariantButton"));
+        controller->siphonButton =
+            GTK_WIDGET(gtk_builder_get_object(builder, "siphonButton"));
 
         controller->newToolbarButton =
             GTK_WIDGET(gtk_builder_get_object(builder, "newToolbarButton"));
@@ -495,6 +573,18 @@ CONTROLLER *create_controller(GtkApplication *gtkAppication,
         g_signal_connect(controller->transitionButton, "clicked",
                          G_CALLBACK(controller_transition_clicked), controller);
 
+        g_signal_connect(controller->simulateButton, "clicked",
+                         G_CALLBACK(controller_simulate_clicked), controller);
+
+        g_signal_connect(controller->coverButton, "clicked",
+                         G_CALLBACK(controller_cover_clicked), controller);
+
+        g_signal_connect(controller->invariantButton, "clicked",
+                         G_CALLBACK(controller_invariant_clicked), controller);
+
+        g_signal_connect(controller->siphonButton, "clicked",
+                         G_CALLBACK(controller_siphon_clicked), controller);
+
         g_signal_connect(controller->newToolbarButton, "clicked",
                          G_CALLBACK(controller_new_clicked), controller);
 
@@ -51,6 +51,10 @@ typedef struct _CONTROLLER
   GtkWidget *selectButton;
   GtkWidget *placeButton;
   GtkWidget *transitionButton;
+  GtkWidget *simulateButton;
+  GtkWidget *coverButton;
+  GtkWidget *invariantButton;
+  GtkWidget *siphonButton;
 
   GtkWidget *newToolbarButton;
   GtkWidget *openToolbarButton;
@@ -0,0 +1,790 @@
+/**
+ * @file coverability.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  the coverability (Karp-Miller) tree of a compiled model - finds the unbounded places
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "explorer.h"
+#include "coverability.h"
+
+/**
+ * @brief compare two keys (omega places first, then finite tokens) - returns <0, 0 or >0
+ *
+ */
+int coverability_compare(int firstOmegas, unsigned long long firstSum, int secondOmegas,
+                         unsigned long long secondSum)
+{
+
+    if (firstOmegas != secondOmegas)
+    {
+        return firstOmegas < secondOmegas ? -1 : 1;
+    }
+
+    return firstSum < secondSum ? -1 : firstSum > secondSum ? 1 : 0;
+}
+
+/**
+ * @brief the key of a marking - its omega places and finite tokens
+ *
+ */
+void coverability_key(MODEL *model, const unsigned int *marking, int *omegas, unsigned long long *sum)
+{
+
+    *omegas = 0;
+    *sum = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        if (marking[iPlace] == COVERABILITY_OMEGA)
+        {
+            *omegas += 1;
+        }
+        else
+        {
+            *sum += marking[iPlace];
+        }
+    }
+}
+
+/**
+ * @brief the marked places of a marking (a bit per place) - a marking can only cover another if its support holds
+ *        the other's
+ *
+ */
+void coverability_support(COVERABILITY *coverability, const unsigned int *marking, unsigned long long *support)
+{
+
+    memset(support, 0, sizeof(unsigned long long) * coverability->supportWords);
+
+    for (int iPlace = 0; iPlace < coverability->model->places; iPlace++)
+    {
+        support[iPlace >> 6] |= marking[iPlace] > 0 ? 1ull << (iPlace & 63) : 0;
+    }
+}
+
+/**
+ * @brief true if every place of the first support is in the second
+ *
+ */
+int coverability_within(COVERABILITY *coverability, const unsigned long long *first, const unsigned long long *second)
+{
+
+    for (int iWord = 0; iWord < coverability->supportWords; iWord++)
+    {
+        if ((first[iWord] & ~second[iWord]) != 0)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief a node's support
+ *
+ */
+unsigned long long *coverability_node_support(COVERABILITY *coverability, int node)
+{
+
+    return &coverability->supports[(size_t)node * coverability->supportWords];
+}
+
+/**
+ * @brief true if the first marking covers the second (every place holds at least as many tokens)
+ *
+ */
+int coverability_covers(MODEL *model, const unsigned int *first, const unsigned int *second)
+{
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        if (first[iPlace] < second[iPlace])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief fire a transition enabled in the marking - omega places stay omega (a place whose tokens would overflow
+ *        becomes omega)
+ *
+ */
+void coverability_fire(MODEL *model, const unsigned int *marking, int transition, unsigned int *successor)
+{
+
+    memcpy(successor, marking, sizeof(unsigned int) * model->places);
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        int place = model->changePlaces[iChange];
+        long long tokens = (long long)successor[place] + model->changeValues[iChange];
+
+        if (successor[place] != COVERABILITY_OMEGA)
+        {
+            successor[place] = tokens >= COVERABILITY_OMEGA ? COVERABILITY_OMEGA : (unsigned int)tokens;
+        }
+    }
+}
+
+/**
+ * @brief accelerate a successor of the node (whose support is 'support' - it is not changed by an acceleration)
+ *        - a place that grew from an ancestor the successor covers becomes omega; an ancestor can only be covered
+ *        (and differ) if its key is smaller, so the walk stops once every remaining ancestor's key is at least the
+ *        successor's
+ *
+ */
+void coverability_accelerate(COVERABILITY *coverability, int node, unsigned int *successor, int *omegas,
+                             unsigned long long *sum)
+{
+    MODEL *model = coverability->model;
+
+    for (int ancestor = node; ancestor >= 0; ancestor = coverability->parents[ancestor])
+    {
+        const unsigned int *marking = NULL;
+
+        if (coverability_compare(coverability->lowestOmegas[ancestor], coverability->lowestSums[ancestor], *omegas,
+                                 *sum) >= 0)
+        {
+            break;
+        }
+
+        if (coverability_compare(coverability->omegas[ancestor], coverability->sums[ancestor], *omegas, *sum) >= 0)
+        {
+            continue;
+        }
+
+        marking = coverability->store->get(coverability->store, ancestor);
+
+        if (!coverability_within(coverability, coverability_node_support(coverability, ancestor),
+                                 coverability->support) ||
+            !coverability_covers(model, successor, marking))
+        {
+            continue;
+        }
+
+        for (int iPlace = 0; iPlace < model->places; iPlace++)
+        {
+            if (marking[iPlace] < successor[iPlace])
+            {
+                successor[iPlace] = COVERABILITY_OMEGA;
+            }
+        }
+
+        coverability_key(model, successor, omegas, sum);
+    }
+}
+
+/**
+ * @brief the position of the first antichain entry whose key is below the key ('strict') or at most the key
+ *
+ */
+int coverability_search(COVERABILITY *coverability, int omegas, unsigned long long sum, int strict)
+{
+    int low = 0;
+    int high = coverability->antichainCount;
+
+    while (low < high)
+    {
+        int middle = (low + high) / 2;
+        int entry = coverability->antichain[middle];
+        int order = coverability_compare(coverability->omegas[entry], coverability->sums[entry], omegas, sum);
+
+        if (strict ? order >= 0 : order > 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/**
+ * @brief the position of the first node of a place's list (from 'position') that is at least the node - the lists
+ *        hold the nodes in the order added, so the position is galloped to
+ *
+ */
+int coverability_advance(COVERABILITY *coverability, int place, int position, int node)
+{
+    const int *entries = coverability->entries[place];
+    int count = coverability->entryCounts[place];
+    int step = 1;
+    int high = 0;
+
+    while (position + step < count && entries[position + step] < node)
+    {
+        position += step;
+        step *= 2;
+    }
+
+    high = position + step < count ? position + step : count;
+
+    while (position < high)
+    {
+        int middle = (position + high) / 2;
+
+        if (entries[middle] < node)
+        {
+            position = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return position;
+}
+
+/**
+ * @brief true if a node with a larger key listed by every one of the places covers the marking (whose support is
+ *        'support') - the places' lists are intersected by leaping each to the largest node the others are at
+ *
+ */
+int coverability_is_covered_by_places(COVERABILITY *coverability, const int *places, int count,
+                                      const unsigned int *marking, int omegas, unsigned long long sum)
+{
+    int positions[COVERABILITY_INDEX_PLACES] = {0};
+    int node = -1;
+
+    while (TRUE)
+    {
+        int agreed = 0;
+
+        // leap each list to the node, a list past it names the next node
+        for (int iPlace = 0; agreed < count; iPlace = (iPlace + 1) % count)
+        {
+            positions[iPlace] = coverability_advance(coverability, places[iPlace], positions[iPlace], node);
+
+            if (positions[iPlace] == coverability->entryCounts[places[iPlace]])
+            {
+                return FALSE;
+            }
+
+            if (coverability->entries[places[iPlace]][positions[iPlace]] == node)
+            {
+                agreed += 1;
+            }
+            else
+            {
+                node = coverability->entries[places[iPlace]][positions[iPlace]];
+                agreed = 1;
+            }
+        }
+
+        if (!coverability->covered[node] &&
+            coverability_compare(coverability->omegas[node], coverability->sums[node], omegas, sum) > 0 &&
+            coverability_within(coverability, coverability->support, coverability_node_support(coverability, node)) &&
+            coverability_covers(coverability->model, coverability->store->get(coverability->store, node), marking))
+        {
+            return TRUE;
+        }
+
+        node += 1;
+    }
+}
+
+/**
+ * @brief true if a node with a larger key covers the marking (whose support is 'support') - the nodes listed by
+ *        the marked places listing the fewest are searched, or the larger entries of the antichain if there are
+ *        fewer of those
+ *
+ */
+int coverability_is_covered(COVERABILITY *coverability, const unsigned int *marking, int omegas,
+                            unsigned long long sum)
+{
+    int larger = coverability_search(coverability, omegas, sum, FALSE);
+    int places[COVERABILITY_INDEX_PLACES];
+    int count = 0;
+
+    if (larger == 0)
+    {
+        return FALSE;
+    }
+
+    // the marked places listing the fewest nodes, fewest first
+    for (int iPlace = 0; iPlace < coverability->model->places; iPlace++)
+    {
+        int position = count;
+
+        if (marking[iPlace] == 0)
+        {
+            continue;
+        }
+
+        while (position > 0 && coverability->entryCounts[places[position - 1]] > coverability->entryCounts[iPlace])
+        {
+            position -= 1;
+        }
+
+        if (position == COVERABILITY_INDEX_PLACES)
+        {
+            continue;
+        }
+
+        count = count < COVERABILITY_INDEX_PLACES ? count + 1 : count;
+
+        memmove(&places[position + 1], &places[position], sizeof(int) * (count - 1 - position));
+
+        places[position] = iPlace;
+    }
+
+    if (count > 0 && 2 * coverability->entryCounts[places[0]] < larger)
+    {
+        return coverability_is_covered_by_places(coverability, places, count, marking, omegas, sum);
+    }
+
+    for (int iEntry = 0; iEntry < larger; iEntry++)
+    {
+        int entry = coverability->antichain[iEntry];
+
+        if (coverability_within(coverability, coverability->support,
+                                coverability_node_support(coverability, entry)) &&
+            coverability_covers(coverability->model, coverability->store->get(coverability->store, entry), marking))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief add a node to the antichain - if 'sweep' is true the entries it covers (all have smaller keys) are
+ *        removed and are not expanded
+ *
+ */
+void coverability_add_maximal(COVERABILITY *coverability, int node, int sweep)
+{
+    const unsigned int *marking = coverability->store->get(coverability->store, node);
+    int position = coverability_search(coverability, coverability->omegas[node], coverability->sums[node], TRUE);
+    int kept = sweep ? position + 1 : coverability->antichainCount + 1;
+
+    memmove(&coverability->antichain[position + 1], &coverability->antichain[position],
+            sizeof(int) * (coverability->antichainCount - position));
+
+    coverability->antichain[position] = node;
+    coverability->antichainCount += 1;
+
+    for (int iPlace = 0; iPlace < coverability->model->places; iPlace++)
+    {
+        if (marking[iPlace] == 0)
+        {
+            continue;
+        }
+
+        if (coverability->entryCounts[iPlace] == coverability->entryCapacities[iPlace])
+        {
+            coverability->entryCapacities[iPlace] *= 2;
+            coverability->entries[iPlace] =
+                realloc(coverability->entries[iPlace], sizeof(int) * coverability->entryCapacities[iPlace]);
+        }
+
+        coverability->entries[iPlace][coverability->entryCounts[iPlace]++] = node;
+    }
+
+    for (int iEntry = position + 1; iEntry < coverability->antichainCount && sweep; iEntry++)
+    {
+        int entry = coverability->antichain[iEntry];
+
+        if (coverability_within(coverability, coverability_node_support(coverability, entry),
+                                coverability_node_support(coverability, node)) &&
+            coverability_covers(coverability->model, marking, coverability->store->get(coverability->store, entry)))
+        {
+            coverability->skipped += coverability->expanded[entry] || coverability->covered[entry] ? 0 : 1;
+            coverability->covered[entry] = TRUE;
+
+            continue;
+        }
+
+        coverability->antichain[kept++] = entry;
+    }
+
+    coverability->antichainCount = kept;
+}
+
+/**
+ * @brief mark the nodes waiting to be expanded that the node covers - they are not expanded
+ *
+ */
+void coverability_skip_covered(COVERABILITY *coverability, int node)
+{
+    const unsigned int *marking = coverability->store->get(coverability->store, node);
+
+    for (int iWaiting = coverability->next; iWaiting < node; iWaiting++)
+    {
+        if (!coverability->covered[iWaiting] && !coverability->expanded[iWaiting] &&
+            coverability_within(coverability, coverability_node_support(coverability, iWaiting),
+                                coverability_node_support(coverability, node)) &&
+            coverability_covers(coverability->model, marking, coverability->store->get(coverability->store, iWaiting)))
+        {
+            coverability->covered[iWaiting] = TRUE;
+            coverability->skipped += 1;
+        }
+    }
+}
+
+/**
+ * @brief make room for another node
+ *
+ */
+void coverability_grow(COVERABILITY *coverability)
+{
+
+    coverability->nodeCapacity *= 2;
+
+    coverability->parents = realloc(coverability->parents, sizeof(int) * coverability->nodeCapacity);
+    coverability->transitions = realloc(coverability->transitions, sizeof(int) * coverability->nodeCapacity);
+    coverability->depths = realloc(coverability->depths, sizeof(int) * coverability->nodeCapacity);
+    coverability->omegas = realloc(coverability->omegas, sizeof(int) * coverability->nodeCapacity);
+    coverability->sums = realloc(coverability->sums, sizeof(unsigned long long) * coverability->nodeCapacity);
+    coverability->lowestOmegas = realloc(coverability->lowestOmegas, sizeof(int) * coverability->nodeCapacity);
+    coverability->lowestSums =
+        realloc(coverability->lowestSums, sizeof(unsigned long long) * coverability->nodeCapacity);
+    coverability->supports = realloc(coverability->supports, sizeof(unsigned long long) * coverability->nodeCapacity *
+                                                                 coverability->supportWords);
+    coverability->covered = realloc(coverability->covered, sizeof(int) * coverability->nodeCapacity);
+    coverability->expanded = realloc(coverability->expanded, sizeof(int) * coverability->nodeCapacity);
+    coverability->antichain = realloc(coverability->antichain, sizeof(int) * coverability->nodeCapacity);
+    coverability->stack = realloc(coverability->stack, sizeof(int) * coverability->nodeCapacity);
+}
+
+/**
+ * @brief add a node (the child of the parent reached by the transition)
+ *
+ */
+void coverability_add_node(COVERABILITY *coverability, const unsigned int *marking, int parent, int transition,
+                           int omegas, unsigned long long sum)
+{
+    int node = coverability->store->count;
+
+    if (node == coverability->nodeCapacity)
+    {
+        coverability_grow(coverability);
+    }
+
+    coverability->store->insert(coverability->store, marking, NULL);
+
+    coverability->parents[node] = parent;
+    coverability->transitions[node] = transition;
+    coverability->depths[node] = parent < 0 ? 0 : coverability->depths[parent] + 1;
+    coverability->omegas[node] = omegas;
+    coverability->sums[node] = sum;
+    coverability->lowestOmegas[node] = omegas;
+    coverability->lowestSums[node] = sum;
+    coverability_support(coverability, marking, coverability_node_support(coverability, node));
+    coverability->covered[node] = FALSE;
+
+    if (parent >= 0 && coverability_compare(coverability->lowestOmegas[parent], coverability->lowestSums[parent],
+                                            omegas, sum) < 0)
+    {
+        coverability->lowestOmegas[node] = coverability->lowestOmegas[parent];
+        coverability->lowestSums[node] = coverability->lowestSums[parent];
+    }
+
+    coverability->depth = coverability->depths[node] > coverability->depth ? coverability->depths[node]
+                                                                           : coverability->depth;
+
+    coverability->expanded[node] = FALSE;
+
+    // only a node that gained an omega place removes the entries it covers - such a node usually covers much of
+    // the tree, other nodes rarely cover anything and the sweep would be most of the work
+    coverability_add_maximal(coverability, node, parent < 0 || omegas > coverability->omegas[parent]);
+
+    if (omegas > 0)
+    {
+        coverability_skip_covered(coverability, node);
+    }
+
+    // a node that gained an omega place is expanded first (depth first) - its successors cover much of the tree
+    if (parent >= 0 && omegas > coverability->omegas[parent])
+    {
+        coverability->stack[coverability->stackCount++] = node;
+    }
+}
+
+/**
+ * @brief expand a node - returns false if the limit was reached
+ *
+ */
+int coverability_expand(COVERABILITY *coverability, int node, int limit)
+{
+    MODEL *model = coverability->model;
+    unsigned int *successor = coverability->successor;
+
+    // the store's states move as it grows
+    memcpy(coverability->marking, coverability->store->get(coverability->store, node),
+           sizeof(unsigned int) * model->places);
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        int omegas = 0;
+        unsigned long long sum = 0;
+
+        if (!reduction_is_enabled(model, coverability->marking, iTransition))
+        {
+            continue;
+        }
+
+        coverability_fire(model, coverability->marking, iTransition, successor);
+        coverability_key(model, successor, &omegas, &sum);
+        coverability_support(coverability, successor, coverability->support);
+        coverability_accelerate(coverability, node, successor, &omegas, &sum);
+
+        if (coverability->store->find(coverability->store, successor) >= 0 ||
+            coverability_is_covered(coverability, successor, omegas, sum))
+        {
+            continue;
+        }
+
+        if (limit > 0 && coverability->store->count >= limit)
+        {
+            return FALSE;
+        }
+
+        coverability_add_node(coverability, successor, node, iTransition, omegas, sum);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief find the unbounded places and the bounds of the others
+ *
+ */
+void coverability_summarise(COVERABILITY *coverability)
+{
+    MODEL *model = coverability->model;
+
+    coverability->unboundedCount = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        coverability->unbounded[iPlace] = FALSE;
+        coverability->bounds[iPlace] = 0;
+        coverability->witnesses[iPlace] = -1;
+    }
+
+    for (int iNode = 0; iNode < coverability->store->count; iNode++)
+    {
+        const unsigned int *marking = coverability->store->get(coverability->store, iNode);
+
+        for (int iPlace = 0; iPlace < model->places; iPlace++)
+        {
+            if (marking[iPlace] == COVERABILITY_OMEGA)
+            {
+                coverability->unboundedCount += coverability->unbounded[iPlace] ? 0 : 1;
+                coverability->unbounded[iPlace] = TRUE;
+                coverability->witnesses[iPlace] = coverability->witnesses[iPlace] < 0 ? iNode
+                                                                                      : coverability->witnesses[iPlace];
+            }
+            else if (marking[iPlace] > coverability->bounds[iPlace])
+            {
+                coverability->bounds[iPlace] = marking[iPlace];
+            }
+        }
+    }
+}
+
+/**
+ * @brief build the tree - the nodes are expanded in the order they were added (breadth first) except that a node
+ *        that gained an omega place is expanded at once; a node covered by a later node is not expanded
+ *
+ */
+int coverability_build(COVERABILITY *coverability, int limit)
+{
+    MODEL *model = coverability->model;
+    double started = explorer_clock();
+    int omegas = 0;
+    unsigned long long sum = 0;
+
+    coverability->store->clear(coverability->store);
+
+    coverability->antichainCount = 0;
+    coverability->skipped = 0;
+    coverability->depth = 0;
+    coverability->stackCount = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        coverability->entryCounts[iPlace] = 0;
+    }
+
+    coverability->next = 0;
+    coverability->complete = TRUE;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        coverability->successor[iPlace] = model->marking[iPlace];
+    }
+
+    coverability_key(model, coverability->successor, &omegas, &sum);
+    coverability_add_node(coverability, coverability->successor, -1, -1, omegas, sum);
+
+    while (coverability->complete)
+    {
+        int node = 0;
+
+        if (coverability->stackCount > 0)
+        {
+            node = coverability->stack[--coverability->stackCount];
+        }
+        else if (coverability->next < coverability->store->count)
+        {
+            node = coverability->next++;
+        }
+        else
+        {
+            break;
+        }
+
+        if (!coverability->covered[node] && !coverability->expanded[node])
+        {
+            coverability->expanded[node] = TRUE;
+            coverability->complete = coverability_expand(coverability, node, limit);
+        }
+    }
+
+    coverability_summarise(coverability);
+
+    coverability->seconds = explorer_clock() - started;
+
+    return coverability->complete;
+}
+
+/**
+ * @brief the transitions fired from the initial marking to the node
+ *
+ */
+int coverability_trace(COVERABILITY *coverability, int node, int *sequence)
+{
+    int count = coverability->depths[node];
+
+    for (int iStep = count - 1; iStep >= 0; iStep--, node = coverability->parents[node])
+    {
+        sequence[iStep] = coverability->transitions[node];
+    }
+
+    return count;
+}
+
+/**
+ * @brief release/free the coverability tree object
+ *
+ */
+void coverability_release(COVERABILITY *coverability)
+{
+
+    coverability->store->release(coverability->store);
+
+    free(coverability->unbounded);
+    free(coverability->bounds);
+    free(coverability->witnesses);
+    free(coverability->parents);
+    free(coverability->transitions);
+    free(coverability->depths);
+    free(coverability->omegas);
+    free(coverability->sums);
+    free(coverability->lowestOmegas);
+    free(coverability->lowestSums);
+    free(coverability->supports);
+    free(coverability->support);
+    free(coverability->covered);
+    free(coverability->expanded);
+    free(coverability->antichain);
+    free(coverability->stack);
+
+    for (int iPlace = 0; iPlace < coverability->model->places; iPlace++)
+    {
+        free(coverability->entries[iPlace]);
+    }
+
+    free(coverability->entries);
+    free(coverability->entryCounts);
+    free(coverability->entryCapacities);
+    free(coverability->marking);
+    free(coverability->successor);
+
+    free(coverability);
+}
+
+/**
+ * @brief coverability tree constructor
+ *
+ */
+COVERABILITY *create_coverability(MODEL *model)
+{
+    COVERABILITY *coverability = malloc(sizeof(COVERABILITY));
+    int capacity = COVERABILITY_INITIAL_NODES;
+
+    coverability->model = model;
+    coverability->store = create_store(model->places);
+
+    coverability->unbounded = calloc(model->places + 1, sizeof(int));
+    coverability->bounds = calloc(model->places + 1, sizeof(unsigned int));
+    coverability->witnesses = malloc(sizeof(int) * (model->places + 1));
+    coverability->unboundedCount = 0;
+
+    coverability->antichainCount = 0;
+    coverability->skipped = 0;
+    coverability->depth = 0;
+    coverability->complete = FALSE;
+    coverability->seconds = 0;
+
+    coverability->nodeCapacity = capacity;
+    coverability->parents = malloc(sizeof(int) * capacity);
+    coverability->transitions = malloc(sizeof(int) * capacity);
+    coverability->depths = malloc(sizeof(int) * capacity);
+    coverability->omegas = malloc(sizeof(int) * capacity);
+    coverability->sums = malloc(sizeof(unsigned long long) * capacity);
+    coverability->lowestOmegas = malloc(sizeof(int) * capacity);
+    coverability->lowestSums = malloc(sizeof(unsigned long long) * capacity);
+    coverability->supportWords = model->places / 64 + 1;
+    coverability->supports = malloc(sizeof(unsigned long long) * capacity * coverability->supportWords);
+    coverability->support = malloc(sizeof(unsigned long long) * coverability->supportWords);
+    coverability->covered = malloc(sizeof(int) * capacity);
+    coverability->expanded = malloc(sizeof(int) * capacity);
+    coverability->antichain = malloc(sizeof(int) * capacity);
+    coverability->stack = malloc(sizeof(int) * capacity);
+    coverability->stackCount = 0;
+    coverability->next = 0;
+
+    coverability->marking = malloc(sizeof(unsigned int) * (model->places + 1));
+    coverability->successor = malloc(sizeof(unsigned int) * (model->places + 1));
+
+    coverability->entries = calloc(model->places + 1, sizeof(int *));
+    coverability->entryCounts = calloc(model->places + 1, sizeof(int));
+    coverability->entryCapacities = calloc(model->places + 1, sizeof(int));
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        coverability->witnesses[iPlace] = -1;
+        coverability->entryCapacities[iPlace] = COVERABILITY_INITIAL_ENTRIES;
+        coverability->entries[iPlace] = malloc(sizeof(int) * COVERABILITY_INITIAL_ENTRIES);
+    }
+
+    coverability->build = coverability_build;
+    coverability->trace = coverability_trace;
+    coverability->release = coverability_release;
+
+    return coverability;
+}
@@ -0,0 +1,207 @@
+/**
+ * @file coverability.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - the coverability (Karp-Miller) tree of a compiled model - finds the unbounded places
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef COVERABILITY_H_INCLUDED
+#define COVERABILITY_H_INCLUDED
+
+#include "model.h"
+#include "store.h"
+
+/**
+ * @brief casts an object to a coverability tree
+ *
+ */
+#define TO_COVERABILITY(coverability) ((COVERABILITY *)(coverability))
+
+/**
+ * @brief the tokens of a place that can hold arbitrarily many (omega)
+ *
+ */
+#define COVERABILITY_OMEGA 0xFFFFFFFFu
+
+/**
+ * @brief the initial number of nodes held
+ *
+ */
+#define COVERABILITY_INITIAL_NODES 1024
+
+/**
+ * @brief the initial number of nodes listed by each place
+ *
+ */
+#define COVERABILITY_INITIAL_ENTRIES 16
+
+/**
+ * @brief the most places whose lists are intersected looking for a covering node
+ *
+ */
+#define COVERABILITY_INDEX_PLACES 8
+
+/**
+ * @brief the coverability tree's interface - the nodes are the store's indexes (the initial marking is node 0) and
+ *        are expanded breadth first (a node that gained an omega place is expanded at once); a successor is
+ *        accelerated against its ancestors (a place that grew from an ancestor it covers becomes omega) and is pruned
+ *        if an existing node covers it. The nodes not known to be covered are held in an antichain sorted by (omega
+ *        places, tokens) so a covering node is looked for among the larger entries only - a node with the same key
+ *        covers a marking only if it is equal (found by the store) - and each node's marked places (a bit set) rule
+ *        out most entries and ancestors without reading their markings. A covering node marks every place the
+ *        marking does, so the nodes are also listed by the places they mark and the shortest lists of the marking's
+ *        places are intersected (if the shortest is shorter than the larger entries). Only a node that gained an omega place
+ *        removes the entries it covers, so the antichain may hold covered entries; a node holding an omega place
+ *        marks the nodes waiting to be expanded that it covers, which are then not expanded
+ *
+ */
+typedef struct _COVERABILITY
+{
+
+    /**
+     * @brief build the tree - stops once 'limit' nodes are held (0 is no limit), returns true if the tree is
+     *        complete, false otherwise
+     *
+     */
+    int (*build)(struct _COVERABILITY *coverability, int limit);
+
+    /**
+     * @brief the transitions fired from the initial marking to a node - returns the number fired ('sequence' holds
+     *        at least the node's depth entries)
+     *
+     */
+    int (*trace)(struct _COVERABILITY *coverability, int node, int *sequence);
+
+    /**
+     * @brief release the tree and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _COVERABILITY *coverability);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the marking of each node (one word per place, COVERABILITY_OMEGA for omega)
+     *
+     */
+    STORE *store;
+
+    /**
+     * @brief true if each place is unbounded (is omega in some node) and the number of unbounded places
+     *
+     */
+    int *unbounded;
+    int unboundedCount;
+
+    /**
+     * @brief the most tokens each bounded place holds
+     *
+     */
+    unsigned int *bounds;
+
+    /**
+     * @brief the node in which each unbounded place first became omega (-1 if the place is bounded)
+     *
+     */
+    int *witnesses;
+
+    /**
+     * @brief the nodes not expanded because a later node covers them and the depth of the tree (the number of nodes
+     *        is the store's count)
+     *
+     */
+    int skipped;
+    int depth;
+
+    /**
+     * @brief true if the last build was complete (the limit was not reached)
+     *
+     */
+    int complete;
+
+    /**
+     * @brief the time taken by the last build (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief private (each node's parent, the transition fired to reach it and its depth)
+     *
+     */
+    int *parents;
+    int *transitions;
+    int *depths;
+
+    /**
+     * @brief private (each node's key - its omega places and finite tokens - and the smallest key from the root
+     *        to the node)
+     *
+     */
+    int *omegas;
+    unsigned long long *sums;
+    int *lowestOmegas;
+    unsigned long long *lowestSums;
+
+    /**
+     * @brief private (each node's marked places - 'supportWords' words, place 'p' is bit 'p % 64' of word 'p / 64' -
+     *        and the support of the successor being added)
+     *
+     */
+    unsigned long long *supports;
+    unsigned long long *support;
+    int supportWords;
+
+    /**
+     * @brief private (true if a node is covered by a later node - it is not expanded - and true if a node was
+     *        expanded)
+     *
+     */
+    int *covered;
+    int *expanded;
+    int nodeCapacity;
+
+    /**
+     * @brief private (the nodes not known to be covered, largest key first)
+     *
+     */
+    int *antichain;
+    int antichainCount;
+
+    /**
+     * @brief private (per place - the nodes marking it in the order added, including those later covered)
+     *
+     */
+    int **entries;
+    int *entryCounts;
+    int *entryCapacities;
+
+    /**
+     * @brief private (the nodes that gained an omega place waiting to be expanded and the next node to be expanded
+     *        in the order added)
+     *
+     */
+    int *stack;
+    int stackCount;
+    int next;
+
+    /**
+     * @brief private (the marking being expanded and its successor)
+     *
+     */
+    unsigned int *marking;
+    unsigned int *successor;
+
+} COVERABILITY, *COVERABILITY_P;
+
+extern COVERABILITY *create_coverability(MODEL *model);
+
+#endif // COVERABILITY_H_INCLUDED
@@ -0,0 +1,412 @@
+/**
+ * @file diagram.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  a multi-valued decision diagram (MDD) package - a unique table, an operation cache and a compacting
+ *         garbage collector
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "diagram.h"
+
+/**
+ * @brief mix a value into a hash
+ *
+ */
+unsigned int diagram_mix(unsigned int hash, unsigned int value)
+{
+
+    hash ^= value * 0xCC9E2D51u;
+    hash = (hash << 13) | (hash >> 19);
+
+    return hash * 5 + 0xE6546B64u;
+}
+
+/**
+ * @brief hash a node (its level and children)
+ *
+ */
+unsigned int diagram_hash_node(DIAGRAM *diagram, int level, const int *children)
+{
+    unsigned int hash = diagram_mix(0x811C9DC5u, (unsigned int)level);
+
+    for (int iValue = 0; iValue < diagram->domains[level]; iValue++)
+    {
+        hash = diagram_mix(hash, (unsigned int)children[iValue]);
+    }
+
+    return hash ^ (hash >> 16);
+}
+
+/**
+ * @brief (re)build the unique table
+ *
+ */
+void diagram_rehash(DIAGRAM *diagram, unsigned int buckets)
+{
+
+    free(diagram->buckets);
+
+    diagram->buckets = malloc(sizeof(int) * buckets);
+    diagram->bucketMask = buckets - 1;
+
+    memset(diagram->buckets, 0xFF, sizeof(int) * buckets);
+
+    for (int iNode = DIAGRAM_ONE + 1; iNode < diagram->nodes; iNode++)
+    {
+        unsigned int bucket = diagram_hash_node(diagram, diagram->nodeLevels[iNode],
+                                                diagram->children + diagram->nodeChildren[iNode]) &
+                              diagram->bucketMask;
+
+        diagram->nodeNext[iNode] = diagram->buckets[bucket];
+        diagram->buckets[bucket] = iNode;
+    }
+}
+
+/**
+ * @brief find or create a node - the children must not be held by the diagram (they may move)
+ *
+ */
+int diagram_node(DIAGRAM *diagram, int level, const int *children)
+{
+    int domain = diagram->domains[level];
+    unsigned int bucket = 0;
+    int empty = TRUE;
+
+    for (int iValue = 0; iValue < domain && empty; iValue++)
+    {
+        empty = children[iValue] == DIAGRAM_EMPTY;
+    }
+
+    if (empty)
+    {
+        return DIAGRAM_EMPTY;
+    }
+
+    bucket = diagram_hash_node(diagram, level, children) & diagram->bucketMask;
+
+    for (int iNode = diagram->buckets[bucket]; iNode >= 0; iNode = diagram->nodeNext[iNode])
+    {
+        if (diagram->nodeLevels[iNode] == level &&
+            memcmp(diagram->children + diagram->nodeChildren[iNode], children, sizeof(int) * domain) == 0)
+        {
+            return iNode;
+        }
+    }
+
+    if (diagram->nodes == diagram->nodeCapacity)
+    {
+        diagram->nodeCapacity *= 2;
+        diagram->nodeLevels = realloc(diagram->nodeLevels, sizeof(int) * diagram->nodeCapacity);
+        diagram->nodeChildren = realloc(diagram->nodeChildren, sizeof(long) * diagram->nodeCapacity);
+        diagram->nodeNext = realloc(diagram->nodeNext, sizeof(int) * diagram->nodeCapacity);
+    }
+
+    while (diagram->childCount + domain > diagram->childCapacity)
+    {
+        diagram->childCapacity *= 2;
+        diagram->children = realloc(diagram->children, sizeof(int) * diagram->childCapacity);
+    }
+
+    memcpy(diagram->children + diagram->childCount, children, sizeof(int) * domain);
+
+    diagram->nodeLevels[diagram->nodes] = level;
+    diagram->nodeChildren[diagram->nodes] = diagram->childCount;
+    diagram->nodeNext[diagram->nodes] = diagram->buckets[bucket];
+    diagram->buckets[bucket] = diagram->nodes;
+
+    diagram->childCount += domain;
+    diagram->nodes += 1;
+    diagram->peak = diagram->nodes > diagram->peak ? diagram->nodes : diagram->peak;
+
+    if ((unsigned int)diagram->nodes > diagram->bucketMask + 1)
+    {
+        diagram_rehash(diagram, (diagram->bucketMask + 1) * 2);
+    }
+
+    return diagram->nodes - 1;
+}
+
+/**
+ * @brief a node's child for a value
+ *
+ */
+int diagram_child(DIAGRAM *diagram, int node, int value)
+{
+
+    return diagram->children[diagram->nodeChildren[node] + value];
+}
+
+/**
+ * @brief look up an operation in the cache
+ *
+ */
+int diagram_lookup(DIAGRAM *diagram, int operation, int first, int second)
+{
+    unsigned int slot = diagram_mix(diagram_mix((unsigned int)operation, (unsigned int)first), (unsigned int)second);
+    DIAGRAM_CACHE_ENTRY *entry = &diagram->cache[(slot ^ (slot >> 15)) & (DIAGRAM_CACHE_SIZE - 1)];
+
+    if (entry->operation == operation && entry->first == first && entry->second == second)
+    {
+        return entry->result;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief add an operation to the cache (replacing whatever was in its slot)
+ *
+ */
+void diagram_remember(DIAGRAM *diagram, int operation, int first, int second, int result)
+{
+    unsigned int slot = diagram_mix(diagram_mix((unsigned int)operation, (unsigned int)first), (unsigned int)second);
+    DIAGRAM_CACHE_ENTRY *entry = &diagram->cache[(slot ^ (slot >> 15)) & (DIAGRAM_CACHE_SIZE - 1)];
+
+    entry->operation = operation;
+    entry->first = first;
+    entry->second = second;
+    entry->result = result;
+}
+
+/**
+ * @brief the union of two sets at the same level
+ *
+ */
+int diagram_unite(DIAGRAM *diagram, int first, int second)
+{
+    int *children = NULL;
+    int result = 0;
+    int level = 0;
+
+    if (first == DIAGRAM_EMPTY || first == second)
+    {
+        return second;
+    }
+
+    if (second == DIAGRAM_EMPTY)
+    {
+        return first;
+    }
+
+    if (first > second)
+    {
+        int swap = first;
+
+        first = second;
+        second = swap;
+    }
+
+    if ((result = diagram_lookup(diagram, DIAGRAM_UNION_OPERATION, first, second)) >= 0)
+    {
+        return result;
+    }
+
+    level = diagram->nodeLevels[first];
+    children = diagram->scratch[level];
+
+    for (int iValue = 0; iValue < diagram->domains[level]; iValue++)
+    {
+        // the children are fetched for each value - the nodes may move as the union grows the diagram
+        children[iValue] = diagram_unite(diagram, diagram_child(diagram, first, iValue),
+                                         diagram_child(diagram, second, iValue));
+    }
+
+    result = diagram_node(diagram, level, children);
+
+    diagram_remember(diagram, DIAGRAM_UNION_OPERATION, first, second, result);
+
+    return result;
+}
+
+/**
+ * @brief the number of tuples in a set - the nodes are counted bottom up (children precede their parents)
+ *
+ */
+double diagram_count(DIAGRAM *diagram, int node)
+{
+    double *counts = malloc(sizeof(double) * (node + 2));
+    double count = 0;
+
+    counts[DIAGRAM_EMPTY] = 0;
+    counts[DIAGRAM_ONE] = 1;
+
+    for (int iNode = DIAGRAM_ONE + 1; iNode <= node; iNode++)
+    {
+        counts[iNode] = 0;
+
+        for (int iValue = 0; iValue < diagram->domains[diagram->nodeLevels[iNode]]; iValue++)
+        {
+            counts[iNode] += counts[diagram_child(diagram, iNode, iValue)];
+        }
+    }
+
+    count = counts[node];
+
+    free(counts);
+
+    return count;
+}
+
+/**
+ * @brief clear the operation cache
+ *
+ */
+void diagram_clear_cache(DIAGRAM *diagram)
+{
+
+    for (int iEntry = 0; iEntry < DIAGRAM_CACHE_SIZE; iEntry++)
+    {
+        diagram->cache[iEntry].operation = -1;
+    }
+}
+
+/**
+ * @brief remove the nodes not reachable from the roots - the survivors are moved down in order (so children still
+ *        precede their parents) and renumbered
+ *
+ */
+void diagram_collect(DIAGRAM *diagram, int *roots, int count)
+{
+    int *forward = calloc(diagram->nodes + 1, sizeof(int));
+    int nodes = DIAGRAM_ONE + 1;
+    long children = 0;
+
+    for (int iRoot = 0; iRoot < count; iRoot++)
+    {
+        forward[roots[iRoot]] = TRUE;
+    }
+
+    // mark - a parent is always visited before its children
+    for (int iNode = diagram->nodes - 1; iNode > DIAGRAM_ONE; iNode--)
+    {
+        if (forward[iNode])
+        {
+            for (int iValue = 0; iValue < diagram->domains[diagram->nodeLevels[iNode]]; iValue++)
+            {
+                forward[diagram_child(diagram, iNode, iValue)] = TRUE;
+            }
+        }
+    }
+
+    forward[DIAGRAM_EMPTY] = DIAGRAM_EMPTY;
+    forward[DIAGRAM_ONE] = DIAGRAM_ONE;
+
+    // compact
+    for (int iNode = DIAGRAM_ONE + 1; iNode < diagram->nodes; iNode++)
+    {
+        int domain = diagram->domains[diagram->nodeLevels[iNode]];
+
+        if (!forward[iNode])
+        {
+            continue;
+        }
+
+        for (int iValue = 0; iValue < domain; iValue++)
+        {
+            diagram->children[children + iValue] = forward[diagram_child(diagram, iNode, iValue)];
+        }
+
+        diagram->nodeLevels[nodes] = diagram->nodeLevels[iNode];
+        diagram->nodeChildren[nodes] = children;
+
+        forward[iNode] = nodes++;
+        children += domain;
+    }
+
+    for (int iRoot = 0; iRoot < count; iRoot++)
+    {
+        roots[iRoot] = forward[roots[iRoot]];
+    }
+
+    diagram->nodes = nodes;
+    diagram->childCount = children;
+
+    diagram_rehash(diagram, diagram->bucketMask + 1);
+    diagram_clear_cache(diagram);
+
+    free(forward);
+}
+
+/**
+ * @brief release/free the diagram object
+ *
+ */
+void diagram_release(DIAGRAM *diagram)
+{
+
+    for (int iLevel = 0; iLevel < diagram->levels; iLevel++)
+    {
+        free(diagram->scratch[iLevel]);
+    }
+
+    free(diagram->scratch);
+    free(diagram->domains);
+    free(diagram->nodeLevels);
+    free(diagram->nodeChildren);
+    free(diagram->nodeNext);
+    free(diagram->children);
+    free(diagram->buckets);
+    free(diagram->cache);
+
+    free(diagram);
+}
+
+/**
+ * @brief diagram constructor
+ *
+ */
+DIAGRAM *create_diagram(int levels, const int *domains)
+{
+    DIAGRAM *diagram = malloc(sizeof(DIAGRAM));
+
+    diagram->levels = levels;
+    diagram->domains = malloc(sizeof(int) * (levels + 1));
+    diagram->scratch = malloc(sizeof(int *) * (levels + 1));
+
+    for (int iLevel = 0; iLevel < levels; iLevel++)
+    {
+        diagram->domains[iLevel] = domains[iLevel];
+        diagram->scratch[iLevel] = malloc(sizeof(int) * domains[iLevel]);
+    }
+
+    diagram->nodeCapacity = DIAGRAM_INITIAL_NODES;
+    diagram->nodeLevels = malloc(sizeof(int) * diagram->nodeCapacity);
+    diagram->nodeChildren = malloc(sizeof(long) * diagram->nodeCapacity);
+    diagram->nodeNext = malloc(sizeof(int) * diagram->nodeCapacity);
+
+    diagram->childCapacity = DIAGRAM_INITIAL_NODES * 2;
+    diagram->childCount = 0;
+    diagram->children = malloc(sizeof(int) * diagram->childCapacity);
+
+    diagram->nodeLevels[DIAGRAM_EMPTY] = DIAGRAM_TERMINAL_LEVEL;
+    diagram->nodeLevels[DIAGRAM_ONE] = DIAGRAM_TERMINAL_LEVEL;
+    diagram->nodeChildren[DIAGRAM_EMPTY] = 0;
+    diagram->nodeChildren[DIAGRAM_ONE] = 0;
+
+    diagram->nodes = DIAGRAM_ONE + 1;
+    diagram->peak = diagram->nodes;
+
+    diagram->buckets = NULL;
+    diagram_rehash(diagram, DIAGRAM_INITIAL_NODES);
+
+    diagram->cache = malloc(sizeof(DIAGRAM_CACHE_ENTRY) * DIAGRAM_CACHE_SIZE);
+    diagram_clear_cache(diagram);
+
+    diagram->node = diagram_node;
+    diagram->unite = diagram_unite;
+    diagram->child = diagram_child;
+    diagram->count = diagram_count;
+    diagram->lookup = diagram_lookup;
+    diagram->remember = diagram_remember;
+    diagram->collect = diagram_collect;
+    diagram->release = diagram_release;
+
+    return diagram;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file diagram.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - a multi-valued decision diagram (MDD) package - a unique table, an operation cache and a
+ *         compacting garbage collector
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef DIAGRAM_H_INCLUDED
+#define DIAGRAM_H_INCLUDED
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+/**
+ * @brief casts an object to a diagram
+ *
+ */
+#define TO_DIAGRAM(diagram) ((DIAGRAM *)(diagram))
+
+/**
+ * @brief the terminal nodes - the empty set and the set holding the empty tuple
+ *
+ */
+#define DIAGRAM_EMPTY 0
+#define DIAGRAM_ONE 1
+
+/**
+ * @brief the level of the terminal nodes
+ *
+ */
+#define DIAGRAM_TERMINAL_LEVEL (-1)
+
+/**
+ * @brief the number of entries in the operation cache (a power of two)
+ *
+ */
+#define DIAGRAM_CACHE_SIZE (1 << 20)
+
+/**
+ * @brief the initial number of nodes (and of unique table buckets)
+ *
+ */
+#define DIAGRAM_INITIAL_NODES (1 << 16)
+
+/**
+ * @brief the operations held in the cache - the diagram's clients use operations from DIAGRAM_CLIENT_OPERATION
+ *
+ */
+#define DIAGRAM_UNION_OPERATION 0
+#define DIAGRAM_CLIENT_OPERATION 1
+
+/**
+ * @brief private structure - an operation cache entry
+ *
+ */
+typedef struct _DIAGRAM_CACHE_ENTRY
+{
+    int operation;
+    int first;
+    int second;
+    int result;
+
+} DIAGRAM_CACHE_ENTRY, *DIAGRAM_CACHE_ENTRY_P;
+
+/**
+ * @brief the diagram's interface - a node's level is a variable (0 is the lowest) whose value selects one of
+ *        'domains[level]' children at the level below; the diagram is quasi-reduced (no level is skipped) and a node
+ *        whose children are all empty is the empty set. A node's children are always created before it, so children
+ *        have lower identifiers than their parents
+ *
+ */
+typedef struct _DIAGRAM
+{
+
+    /**
+     * @brief find or create the node at the level with the children ('domains[level]' of them)
+     *
+     */
+    int (*node)(struct _DIAGRAM *diagram, int level, const int *children);
+
+    /**
+     * @brief the union of two sets at the same level
+     *
+     */
+    int (*unite)(struct _DIAGRAM *diagram, int first, int second);
+
+    /**
+     * @brief a node's child for a value
+     *
+     */
+    int (*child)(struct _DIAGRAM *diagram, int node, int value);
+
+    /**
+     * @brief the number of tuples in a set
+     *
+     */
+    double (*count)(struct _DIAGRAM *diagram, int node);
+
+    /**
+     * @brief look up and add to the operation cache - lookup returns -1 if the entry is missing
+     *
+     */
+    int (*lookup)(struct _DIAGRAM *diagram, int operation, int first, int second);
+    void (*remember)(struct _DIAGRAM *diagram, int operation, int first, int second, int result);
+
+    /**
+     * @brief remove every node not reachable from the roots - the nodes are renumbered and the roots updated,
+     *        the cache is cleared
+     *
+     */
+    void (*collect)(struct _DIAGRAM *diagram, int *roots, int count);
+
+    /**
+     * @brief release the diagram and deallocate resources
+     *
+     */
+    void (*release)(struct _DIAGRAM *diagram);
+
+    /**
+     * @brief the number of levels and the number of values of each
+     *
+     */
+    int levels;
+    int *domains;
+
+    /**
+     * @brief the number of nodes held (including the terminals) and the most held at once
+     *
+     */
+    int nodes;
+    int peak;
+
+    /**
+     * @brief private (each node's level, first child and unique table chain)
+     *
+     */
+    int *nodeLevels;
+    long *nodeChildren;
+    int *nodeNext;
+    int nodeCapacity;
+
+    /**
+     * @brief private (the children of every node - 'domains[level]' each)
+     *
+     */
+    int *children;
+    long childCount;
+    long childCapacity;
+
+    /**
+     * @brief private (the unique table)
+     *
+     */
+    int *buckets;
+    unsigned int bucketMask;
+
+    /**
+     * @brief private (the operation cache)
+     *
+     */
+    DIAGRAM_CACHE_ENTRY *cache;
+
+    /**
+     * @brief private (the children being united at each level)
+     *
+     */
+    int **scratch;
+
+} DIAGRAM, *DIAGRAM_P;
+
+extern DIAGRAM *create_diagram(int levels, const int *domains);
+
+#endif // DIAGRAM_H_INCLUDED
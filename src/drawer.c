@@ -185,6 +185,32 @@ void draw_selection_box(DRAWER *drawer, NODE *node)
     }
 }
 
+/**
+ * @brief draw the node's highlight - a node highlighted by an analysis (e.g. an unbounded place, an invariant's
+ *        support or a siphon) is ringed in red
+ *
+ */
+void draw_highlight(DRAWER *drawer, NODE *node)
+{
+
+    if (node->artifact.highlighted)
+    {
+        cairo_set_line_width(drawer->canvas, 3);
+        cairo_set_source_rgba(drawer->canvas, 1.0, 0, 0, 0.6);
+
+        if (node->type == PLACE_NODE)
+        {
+            cairo_arc(drawer->canvas, node->position.x, node->position.y, 14, 0, 2 * M_PI);
+        }
+        else
+        {
+            cairo_rectangle(drawer->canvas, (int)node->position.x - 13, (int)node->position.y - 13, 26, 26);
+        }
+
+        cairo_stroke(drawer->canvas);
+    }
+}
+
 /**
  * @brief draw the 'place' node
  *
@@ -192,6 +218,7 @@ void draw_selection_box(DRAWER *drawer, NODE *node)
 void draw_place(DRAWER *drawer, PAINTER *painter)
 {
     NODE *node = painter->painters.transition_painter.node;
+    int marking = node->artifact.state == ACTIVE ? node->place.occupied : node->place.marked;
 
     cairo_set_line_width(drawer->canvas, 2);
     cairo_set_source_rgb(drawer->canvas, 0.75, 0.75, 0.75);
@@ -203,14 +230,14 @@ void draw_place(DRAWER *drawer, PAINTER *painter)
     cairo_arc(drawer->canvas, node->position.x, node->position.y, 10, 0, 2 * M_PI);
     cairo_stroke(drawer->canvas);
 
-    // Draw the marking
-    if ((node->place.marked && node->artifact.state == INACTIVE) || node->place.occupied && node->artifact.state == ACTIVE)
+    // Draw the marking - the simulated marking when ACTIVE
+    if (marking > 0)
     {
         cairo_text_extents_t extents;
 
         cairo_set_source_rgb(drawer->canvas, 0, 0, 0);
 
-        if (node->place.marked == 1)
+        if (marking == 1)
         {
             cairo_arc(drawer->canvas, node->position.x, node->position.y, 4, 0, 2 * M_PI);
             cairo_fill(drawer->canvas);
@@ -219,7 +246,7 @@ void draw_place(DRAWER *drawer, PAINTER *painter)
         {
             GString *tokens = g_string_new("");
 
-            g_string_printf(tokens, "%d", node->place.marked);
+            g_string_printf(tokens, "%d", marking);
 
             cairo_arc(drawer->canvas, node->position.x, node->position.y - 5, 2, 0, 2 * M_PI);
             cairo_fill(drawer->canvas);
@@ -237,6 +264,7 @@ void draw_place(DRAWER *drawer, PAINTER *painter)
         }
     }
 
+    draw_highlight(drawer, node);
     draw_selection_box(drawer, node);
     draw_text(drawer, node);
 }
@@ -259,6 +287,7 @@ void draw_transition(DRAWER *drawer, PAINTER *painter)
     cairo_rectangle(drawer->canvas, (int)node->position.x - 9, (int)node->position.y - 9, 18, 18);
     cairo_stroke(drawer->canvas);
 
+    draw_highlight(drawer, node);
     draw_selection_box(drawer, node);
     draw_text(drawer, node);
 }
@@ -153,6 +153,11 @@ EVENT *create_event(enum NOTIFICATION notification, ...)
         break;
         case CLEAR_NET:
         break;
+        case SHOW_MESSAGE:
+        {
+            event->events.show_message.message = va_arg(args, char*);
+        }
+        break;
         
     }
 
@@ -41,18 +41,24 @@ enum NOTIFICATION
     READ_NET,
     WRITE_NET,
     CLEAR_NET,
+    SHOW_MESSAGE,
     END_NOTIFICATION
 };
 
 /**
- * @brief user selected tool from the tool pane; can be either - 'select', 'place', and 'transition'
+ * @brief user selected tool from the tool pane; can be either - 'select', 'place', 'transition', 'simulate',
+ *        'coverability', 'invariants' and 'siphons'
  * 
  */
 enum TOOL
 {
     SELECT_TOOL,
     PLACE_TOOL,
-    TRANSITION_TOOL
+    TRANSITION_TOOL,
+    SIMULATE_TOOL,
+    COVER_TOOL,
+    INVARIANT_TOOL,
+    SIPHON_TOOL
 };
 
 /**
@@ -163,6 +169,12 @@ typedef struct _EVENT
            char * filename;
 
         } write_net;
+        struct
+        {
+
+           char * message;
+
+        } show_message;
 
     } events;
 
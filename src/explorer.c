@@ -0,0 +1,529 @@
+/**
+ * @file explorer.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  builds the reachability graph of a compiled model (breadth first)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "kernel.h"
+#include "explorer.h"
+
+/**
+ * @brief a monotonic clock (in seconds)
+ *
+ */
+double explorer_clock()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * @brief add an edge from the state being expanded
+ *
+ */
+void explorer_add_edge(EXPLORER *explorer, int target, int transition)
+{
+
+    if (explorer->edges == explorer->edgeCapacity)
+    {
+        explorer->edgeCapacity *= 2;
+        explorer->edgeTargets = realloc(explorer->edgeTargets, sizeof(int) * explorer->edgeCapacity);
+        explorer->edgeTransitions = realloc(explorer->edgeTransitions, sizeof(int) * explorer->edgeCapacity);
+    }
+
+    explorer->edgeTargets[explorer->edges] = target;
+    explorer->edgeTransitions[explorer->edges] = transition;
+    explorer->edges += 1;
+}
+
+/**
+ * @brief add a dead state
+ *
+ */
+void explorer_add_deadlock(EXPLORER *explorer, int state)
+{
+
+    if (explorer->deadlockCount == explorer->deadlockCapacity)
+    {
+        explorer->deadlockCapacity *= 2;
+        explorer->deadlocks = realloc(explorer->deadlocks, sizeof(int) * explorer->deadlockCapacity);
+    }
+
+    explorer->deadlocks[explorer->deadlockCount++] = state;
+}
+
+/**
+ * @brief widen the codec so the marking fits - the store is rebuilt (in the same order, so states keep their index)
+ *
+ */
+void explorer_widen(EXPLORER *explorer, const unsigned int *marking)
+{
+    CODEC *codec = explorer->codec->widen(explorer->codec, marking);
+    STORE *store = create_store(codec->words);
+    unsigned int *unpacked = malloc(sizeof(unsigned int) * (explorer->model->places + 1));
+
+    explorer->packed = realloc(explorer->packed, sizeof(unsigned int) * (codec->words + 1));
+
+    for (int iState = 0; iState < explorer->store->count; iState++)
+    {
+        explorer->codec->decode(explorer->codec, explorer->store->get(explorer->store, iState), unpacked);
+        codec->encode(codec, unpacked, explorer->packed);
+        store->insert(store, explorer->packed, NULL);
+    }
+
+    explorer->store->release(explorer->store);
+    explorer->codec->release(explorer->codec);
+
+    explorer->store = store;
+    explorer->codec = codec;
+    explorer->widenings += 1;
+
+    free(unpacked);
+}
+
+/**
+ * @brief insert a marking - the codec is widened first if the marking overflows a field
+ *
+ */
+int explorer_insert(EXPLORER *explorer, const unsigned int *marking)
+{
+
+    if (!explorer->codec->fits(explorer->codec, marking))
+    {
+        explorer_widen(explorer, marking);
+    }
+
+    explorer->codec->encode(explorer->codec, marking, explorer->packed);
+
+    return explorer->store->insert(explorer->store, explorer->packed, NULL);
+}
+
+/**
+ * @brief fire an enabled transition and add the edge - returns the successor state
+ *
+ */
+int explorer_fire(EXPLORER *explorer, const unsigned int *marking, int transition, unsigned int *successor)
+{
+    MODEL *model = explorer->model;
+    int target = 0;
+
+    memcpy(successor, marking, sizeof(unsigned int) * model->places);
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        successor[model->changePlaces[iChange]] += model->changeValues[iChange];
+    }
+
+    target = explorer_insert(explorer, successor);
+
+    explorer_add_edge(explorer, target, transition);
+
+    return target;
+}
+
+/**
+ * @brief private structure - the state whose stubborn sets are being considered
+ *
+ */
+typedef struct _EXPLORER_CANDIDATE
+{
+    EXPLORER *explorer;
+    int state;
+    const unsigned int *marking;
+    unsigned int *successor;
+
+} EXPLORER_CANDIDATE, *EXPLORER_CANDIDATE_P;
+
+/**
+ * @brief accept a stubborn set if none of its successors was inserted before (or is) the state - every cycle has
+ *        such an edge, so every cycle of the reduced graph holds a fully expanded state (the cycle proviso)
+ *
+ */
+int explorer_accept(void *data, const int *transitions, int count)
+{
+    EXPLORER_CANDIDATE *candidate = data;
+    EXPLORER *explorer = candidate->explorer;
+    MODEL *model = explorer->model;
+
+    for (int iTransition = 0; iTransition < count; iTransition++)
+    {
+        int found = 0;
+
+        memcpy(candidate->successor, candidate->marking, sizeof(unsigned int) * model->places);
+
+        for (int iChange = model->changeStart[transitions[iTransition]];
+             iChange < model->changeStart[transitions[iTransition] + 1]; iChange++)
+        {
+            candidate->successor[model->changePlaces[iChange]] += model->changeValues[iChange];
+        }
+
+        if (!explorer->codec->fits(explorer->codec, candidate->successor))
+        {
+            continue;
+        }
+
+        explorer->codec->encode(explorer->codec, candidate->successor, explorer->packed);
+
+        found = explorer->store->find(explorer->store, explorer->packed);
+
+        if (found >= 0 && found <= candidate->state)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief generate the successors of a stubborn set - in SAFETY_REDUCTION mode only a set satisfying the cycle
+ *        proviso is accepted, and the state is fully expanded if there is none
+ *
+ */
+void explorer_expand_reduced(EXPLORER *explorer, int state, const unsigned int *marking, unsigned int *successor)
+{
+    MODEL *model = explorer->model;
+    REDUCTION *reduction = explorer->reduction;
+    EXPLORER_CANDIDATE candidate = {explorer, state, marking, successor};
+    int count = reduction->select(reduction, marking, explorer->chosen, explorer->work,
+                                  reduction->mode == SAFETY_REDUCTION ? explorer_accept : NULL, &candidate);
+
+    for (int iChosen = 0; iChosen < count; iChosen++)
+    {
+        explorer_fire(explorer, marking, explorer->chosen[iChosen], successor);
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions && count == 0; iTransition++)
+    {
+        if (reduction_is_enabled(model, marking, iTransition))
+        {
+            explorer_fire(explorer, marking, iTransition, successor);
+        }
+    }
+}
+
+/**
+ * @brief generate the successors of a state - the successor's marking is built in 'successor'
+ *
+ */
+void explorer_expand(EXPLORER *explorer, int state, unsigned int *successor)
+{
+    MODEL *model = explorer->model;
+    unsigned int *marking = explorer->marking;
+    long edges = explorer->edges;
+
+    explorer->codec->decode(explorer->codec, explorer->store->get(explorer->store, state), marking);
+
+    if (explorer->reduction != NULL)
+    {
+        explorer_expand_reduced(explorer, state, marking, successor);
+    }
+    else
+    {
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            if (reduction_is_enabled(model, marking, iTransition))
+            {
+                explorer_fire(explorer, marking, iTransition, successor);
+            }
+        }
+    }
+
+    if (explorer->edges == edges)
+    {
+        explorer_add_deadlock(explorer, state);
+    }
+}
+
+/**
+ * @brief copy the packed markings of a batch of states (the store may move them while successors are inserted)
+ *
+ */
+void explorer_copy_parents(EXPLORER *explorer, int first, int count)
+{
+    int words = explorer->codec->words;
+
+    explorer->parents = realloc(explorer->parents, sizeof(unsigned int) * ((size_t)words * KERNEL_LANES + 1));
+
+    for (int iLane = 0; iLane < count; iLane++)
+    {
+        memcpy(&explorer->parents[iLane * words], explorer->store->get(explorer->store, first + iLane),
+               sizeof(unsigned int) * words);
+    }
+}
+
+/**
+ * @brief insert the successor in a lane of the fired batch - only the changed places of the state's packed marking
+ *        are set, and the whole marking is unpacked only if a changed place overflows its field
+ *
+ */
+int explorer_insert_lane(EXPLORER *explorer, int first, int count, int lane, int transition, unsigned int *successor)
+{
+    MODEL *model = explorer->model;
+    CODEC *codec = explorer->codec;
+    int words = codec->words;
+    int target = 0;
+
+    memcpy(explorer->packed, &explorer->parents[lane * words], sizeof(unsigned int) * words);
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        int place = model->changePlaces[iChange];
+        unsigned int tokens = explorer->batch[place * KERNEL_LANES + lane];
+
+        if (tokens > codec->limits[place])
+        {
+            kernel_store(explorer->batch, lane, successor, model->places);
+
+            target = explorer_insert(explorer, successor);
+
+            explorer_copy_parents(explorer, first, count);
+
+            return target;
+        }
+
+        codec->set(codec, explorer->packed, place, tokens);
+    }
+
+    return explorer->store->insert(explorer->store, explorer->packed, NULL);
+}
+
+/**
+ * @brief generate the successors of a batch of states - each transition is tested against every lane, and fired in
+ *        every lane in which it is enabled at once (the firing is undone afterwards); the edges are then added state by
+ *        state
+ *
+ */
+void explorer_expand_batch(EXPLORER *explorer, int first, int count, unsigned int *successor)
+{
+    MODEL *model = explorer->model;
+    KERNEL *kernel = explorer->kernel;
+    unsigned int active = KERNEL_ALL_LANES >> (KERNEL_LANES - count);
+
+    explorer_copy_parents(explorer, first, count);
+
+    for (int iLane = 0; iLane < count; iLane++)
+    {
+        explorer->codec->decode(explorer->codec, &explorer->parents[iLane * explorer->codec->words],
+                                explorer->marking);
+
+        kernel_load(explorer->batch, iLane, explorer->marking, model->places);
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        unsigned int lanes = kernel->enabled(kernel, explorer->batch, iTransition) & active;
+
+        explorer->lanes[iTransition] = lanes;
+
+        if (lanes == 0)
+        {
+            continue;
+        }
+
+        kernel->fire(kernel, explorer->batch, iTransition, 1);
+
+        for (int iLane = 0; iLane < count; iLane++)
+        {
+            if (lanes & (1u << iLane))
+            {
+                explorer->targets[iTransition * KERNEL_LANES + iLane] =
+                    explorer_insert_lane(explorer, first, count, iLane, iTransition, successor);
+            }
+        }
+
+        kernel->fire(kernel, explorer->batch, iTransition, -1);
+    }
+
+    for (int iLane = 0; iLane < count; iLane++)
+    {
+        long edges = explorer->edges;
+
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            if (explorer->lanes[iTransition] & (1u << iLane))
+            {
+                explorer_add_edge(explorer, explorer->targets[iTransition * KERNEL_LANES + iLane], iTransition);
+            }
+        }
+
+        if (explorer->edges == edges)
+        {
+            explorer_add_deadlock(explorer, first + iLane);
+        }
+
+        explorer->edgeStart[first + iLane + 1] = explorer->edges;
+    }
+}
+
+/**
+ * @brief build the reachability graph breadth first - the store's order is the queue
+ *
+ */
+int explorer_explore(EXPLORER *explorer, int limit)
+{
+    MODEL *model = explorer->model;
+    unsigned int *successor = malloc(sizeof(unsigned int) * (model->places + 1));
+    double started = explorer_clock();
+
+    explorer->store->clear(explorer->store);
+
+    explorer->expanded = 0;
+    explorer->edges = 0;
+    explorer->deadlockCount = 0;
+    explorer->edgeStart[0] = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        successor[iPlace] = model->marking[iPlace];
+    }
+
+    explorer_insert(explorer, successor);
+
+    while (explorer->expanded < explorer->store->count && (limit <= 0 || explorer->store->count < limit))
+    {
+        int batched = explorer->kernel != NULL && explorer->reduction == NULL;
+        int count = 1;
+
+        if (batched)
+        {
+            count = explorer->store->count - explorer->expanded;
+            count = count < KERNEL_LANES ? count : KERNEL_LANES;
+        }
+
+        while (explorer->expanded + count >= explorer->stateCapacity)
+        {
+            explorer->stateCapacity *= 2;
+            explorer->edgeStart = realloc(explorer->edgeStart, sizeof(long) * explorer->stateCapacity);
+        }
+
+        if (batched)
+        {
+            explorer_expand_batch(explorer, explorer->expanded, count, successor);
+        }
+        else
+        {
+            explorer_expand(explorer, explorer->expanded, successor);
+
+            explorer->edgeStart[explorer->expanded + 1] = explorer->edges;
+        }
+
+        explorer->expanded += count;
+    }
+
+    explorer->complete = explorer->expanded == explorer->store->count;
+    explorer->seconds = explorer_clock() - started;
+
+    free(successor);
+
+    return explorer->complete;
+}
+
+/**
+ * @brief the marking of a state
+ *
+ */
+const unsigned int *explorer_get_marking(EXPLORER *explorer, int state)
+{
+
+    explorer->codec->decode(explorer->codec, explorer->store->get(explorer->store, state), explorer->view);
+
+    return explorer->view;
+}
+
+/**
+ * @brief release/free the explorer object
+ *
+ */
+void explorer_release(EXPLORER *explorer)
+{
+
+    explorer->store->release(explorer->store);
+    explorer->codec->release(explorer->codec);
+
+    if (explorer->kernel != NULL)
+    {
+        explorer->kernel->release(explorer->kernel);
+    }
+
+    free(explorer->marking);
+    free(explorer->packed);
+    free(explorer->view);
+    free(explorer->chosen);
+    free(explorer->work);
+    free(explorer->batch);
+    free(explorer->parents);
+    free(explorer->lanes);
+    free(explorer->targets);
+    free(explorer->edgeStart);
+    free(explorer->edgeTargets);
+    free(explorer->edgeTransitions);
+    free(explorer->deadlocks);
+
+    free(explorer);
+}
+
+/**
+ * @brief explorer constructor
+ *
+ */
+EXPLORER *create_explorer(MODEL *model)
+{
+    EXPLORER *explorer = malloc(sizeof(EXPLORER));
+
+    explorer->model = model;
+    explorer->codec = create_codec_for_model(model);
+    explorer->store = create_store(explorer->codec->words);
+    explorer->widenings = 0;
+
+    explorer->expanded = 0;
+    explorer->edges = 0;
+    explorer->deadlockCount = 0;
+    explorer->complete = FALSE;
+    explorer->seconds = 0;
+
+    explorer->stateCapacity = 1024;
+    explorer->edgeCapacity = 1024;
+    explorer->deadlockCapacity = 64;
+
+    explorer->edgeStart = malloc(sizeof(long) * explorer->stateCapacity);
+    explorer->edgeTargets = malloc(sizeof(int) * explorer->edgeCapacity);
+    explorer->edgeTransitions = malloc(sizeof(int) * explorer->edgeCapacity);
+    explorer->deadlocks = malloc(sizeof(int) * explorer->deadlockCapacity);
+
+    explorer->marking = malloc(sizeof(unsigned int) * (model->places + 1));
+    explorer->packed = malloc(sizeof(unsigned int) * (explorer->codec->words + 1));
+    explorer->view = malloc(sizeof(unsigned int) * (model->places + 1));
+
+    explorer->reduction = NULL;
+    explorer->chosen = malloc(sizeof(int) * (model->transitions + 1));
+    explorer->work = malloc(sizeof(int) * REDUCTION_WORK_SIZE(model->transitions));
+
+    explorer->kernel = create_fastest_kernel(model);
+    explorer->batch = calloc((size_t)(model->places + 1) * KERNEL_LANES, sizeof(unsigned int));
+    explorer->parents = NULL;
+    explorer->lanes = malloc(sizeof(unsigned int) * (model->transitions + 1));
+    explorer->targets = malloc(sizeof(int) * (size_t)(model->transitions + 1) * KERNEL_LANES);
+
+    explorer->explore = explorer_explore;
+    explorer->getMarking = explorer_get_marking;
+    explorer->release = explorer_release;
+
+    return explorer;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file explorer.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - builds the reachability graph of a compiled model (breadth first)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef EXPLORER_H_INCLUDED
+#define EXPLORER_H_INCLUDED
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "kernel.h"
+
+/**
+ * @brief casts an object to an explorer
+ *
+ */
+#define TO_EXPLORER(explorer) ((EXPLORER *)(explorer))
+
+/**
+ * @brief the explorer's interface - the states are the store's indexes (the initial marking is state 0),
+ *        the edges of each state are held in compressed rows (edgeStart[s] .. edgeStart[s + 1]); the store
+ *        holds the markings packed by the codec, which is widened (and the store rebuilt) if a place overflows.
+ *        Without a reduction the states are expanded KERNEL_LANES at a time by the kernel: each transition is tested
+ *        against the whole batch and fired in every lane at once, so the successors are numbered transition by
+ *        transition within a batch (the edges of a state are still in the order of its transitions)
+ *
+ */
+typedef struct _EXPLORER
+{
+
+    /**
+     * @brief build the reachability graph - exploration stops once 'limit' states are held (0 is no limit),
+     *        returns true if the graph is complete, false otherwise
+     *
+     */
+    int (*explore)(struct _EXPLORER *explorer, int limit);
+
+    /**
+     * @brief the marking of a state (one entry per place) - valid until the next call
+     *
+     */
+    const unsigned int *(*getMarking)(struct _EXPLORER *explorer, int state);
+
+    /**
+     * @brief release the explorer and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _EXPLORER *explorer);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the reachable markings
+     *
+     */
+    STORE *store;
+
+    /**
+     * @brief packs the markings held by the store
+     *
+     */
+    CODEC *codec;
+
+    /**
+     * @brief the number of times the codec has been widened
+     *
+     */
+    int widenings;
+
+    /**
+     * @brief the stubborn set reduction applied to each state (NULL - every enabled transition is expanded)
+     *
+     */
+    REDUCTION *reduction;
+
+    /**
+     * @brief the kernel that expands a batch of states (NULL - one state at a time) - released with the explorer
+     *
+     */
+    KERNEL *kernel;
+
+    /**
+     * @brief the number of states whose edges have been generated
+     *
+     */
+    int expanded;
+
+    /**
+     * @brief the edges - the successor state and the transition fired
+     *
+     */
+    long *edgeStart;
+    int *edgeTargets;
+    int *edgeTransitions;
+    long edges;
+
+    /**
+     * @brief the states without an enabled transition
+     *
+     */
+    int *deadlocks;
+    int deadlockCount;
+
+    /**
+     * @brief true if every reachable state has been expanded
+     *
+     */
+    int complete;
+
+    /**
+     * @brief the time taken by the last exploration (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief private (the capacity of the edge and deadlock arrays)
+     *
+     */
+    long edgeCapacity;
+    int stateCapacity;
+    int deadlockCapacity;
+
+    /**
+     * @brief private (the unpacked marking being expanded, a packed successor and the marking returned by getMarking)
+     *
+     */
+    unsigned int *marking;
+    unsigned int *packed;
+    unsigned int *view;
+
+    /**
+     * @brief private (the reduction's chosen transitions and work)
+     *
+     */
+    int *chosen;
+    int *work;
+
+    /**
+     * @brief private (the batch of markings being expanded and their packed form, the lanes in which each transition
+     *        is enabled and the successor state of each transition in each lane - 'transition * KERNEL_LANES + lane')
+     *
+     */
+    unsigned int *batch;
+    unsigned int *parents;
+    unsigned int *lanes;
+    int *targets;
+
+} EXPLORER, *EXPLORER_P;
+
+extern EXPLORER *create_explorer(MODEL *model);
+
+extern double explorer_clock();
+
+#endif // EXPLORER_H_INCLUDED
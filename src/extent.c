@@ -0,0 +1,135 @@
+/**
+ * @file extent.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  the extent (furthest right and bottom coordinates) of a collection of points
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <glib.h>
+#include <gtk/gtk.h>
+#include <gdk/gdk.h>
+
+#include <math.h>
+
+#include "geometry.h"
+#include "extent.h"
+
+/**
+ * @brief order the coordinates
+ *
+ */
+gint extent_compare(gconstpointer a, gconstpointer b, gpointer data)
+{
+
+    return GPOINTER_TO_INT(a) < GPOINTER_TO_INT(b) ? -1 : GPOINTER_TO_INT(a) > GPOINTER_TO_INT(b) ? 1 : 0;
+}
+
+/**
+ * @brief increment/decrement the number of points at a coordinate
+ *
+ */
+void extent_count(GTree *axis, double value, int count)
+{
+    gpointer key = GINT_TO_POINTER((int)ceil(value));
+    int total = GPOINTER_TO_INT(g_tree_lookup(axis, key)) + count;
+
+    if (total > 0)
+    {
+        g_tree_replace(axis, key, GINT_TO_POINTER(total));
+    }
+    else
+    {
+        g_tree_remove(axis, key);
+    }
+}
+
+/**
+ * @brief the furthest coordinate of an axis (never less than the origin)
+ *
+ */
+double extent_furthest(GTree *axis)
+{
+    GTreeNode *last = g_tree_node_last(axis);
+
+    return last == NULL || GPOINTER_TO_INT(g_tree_node_key(last)) < 0 ? 0 : GPOINTER_TO_INT(g_tree_node_key(last));
+}
+
+/**
+ * @brief include a point
+ *
+ */
+void extent_add(EXTENT *extent, double x, double y)
+{
+
+    extent_count(extent->columns, x, 1);
+    extent_count(extent->rows, y, 1);
+}
+
+/**
+ * @brief exclude a point
+ *
+ */
+void extent_remove(EXTENT *extent, double x, double y)
+{
+
+    extent_count(extent->columns, x, -1);
+    extent_count(extent->rows, y, -1);
+}
+
+/**
+ * @brief get the size from the origin to the furthest point
+ *
+ */
+SIZE *extent_get(EXTENT *extent, SIZE *size)
+{
+
+    return set_size(size, extent_furthest(extent->columns), extent_furthest(extent->rows));
+}
+
+/**
+ * @brief exclude all the points
+ *
+ */
+void extent_clear(EXTENT *extent)
+{
+
+    g_tree_remove_all(extent->columns);
+    g_tree_remove_all(extent->rows);
+}
+
+/**
+ * @brief release/free the extent object
+ *
+ */
+void extent_release(EXTENT *extent)
+{
+
+    g_tree_destroy(extent->columns);
+    g_tree_destroy(extent->rows);
+
+    g_free(extent);
+}
+
+/**
+ * @brief extent constructor
+ *
+ */
+EXTENT *create_extent()
+{
+    EXTENT *extent = g_malloc(sizeof(EXTENT));
+
+    extent->columns = g_tree_new_full(extent_compare, NULL, NULL, NULL);
+    extent->rows = g_tree_new_full(extent_compare, NULL, NULL, NULL);
+
+    extent->add = extent_add;
+    extent->remove = extent_remove;
+    extent->get = extent_get;
+    extent->clear = extent_clear;
+    extent->release = extent_release;
+
+    return extent;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file extent.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - the extent (furthest right and bottom coordinates) of a collection of points
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef EXTENT_H_INCLUDED
+#define EXTENT_H_INCLUDED
+
+#include "geometry.h"
+
+/**
+ * @brief casts an object to an extent
+ *
+ */
+#define TO_EXTENT(extent) ((EXTENT *)(extent))
+
+/**
+ * @brief the extent's interface - each axis counts the points at each (whole) coordinate
+ *
+ */
+typedef struct _EXTENT
+{
+
+    /**
+     * @brief include a point (points may be included more than once)
+     *
+     */
+    void (*add)(struct _EXTENT *extent, double x, double y);
+
+    /**
+     * @brief exclude a point previously included
+     *
+     */
+    void (*remove)(struct _EXTENT *extent, double x, double y);
+
+    /**
+     * @brief get the size from the origin to the furthest point (size is the input to receive the extent)
+     *
+     */
+    SIZE *(*get)(struct _EXTENT *extent, SIZE *size);
+
+    /**
+     * @brief exclude all the points
+     *
+     */
+    void (*clear)(struct _EXTENT *extent);
+
+    /**
+     * @brief release the extent and deallocate resources
+     *
+     */
+    void (*release)(struct _EXTENT *extent);
+
+    /**
+     * @brief private (x coordinate -> number of points)
+     *
+     */
+    GTree *columns;
+
+    /**
+     * @brief private (y coordinate -> number of points)
+     *
+     */
+    GTree *rows;
+
+} EXTENT, *EXTENT_P;
+
+extern EXTENT *create_extent();
+
+#endif // EXTENT_H_INCLUDED
@@ -117,6 +117,32 @@ int point_in_bounds(POINT *point, BOUNDS *bounds)
             point->y <= adjusted.point.y + adjusted.size.h);
 }
 
+/**
+ * @brief get the bounds containing every point 'point_on_line' accepts for the line
+ *
+ */
+BOUNDS *get_line_bounds(POINT *source, POINT *target, double tolerate, BOUNDS *bounds)
+{
+    double dx = target->x - source->x;
+    double dy = target->y - source->y;
+
+    // the accepted points form an ellipse with the line's end points as foci - (2 covers the truncation)
+
+    double major = (sqrt(dx * dx + dy * dy) + tolerate + 2) / 2;
+    double focus = sqrt(dx * dx + dy * dy) / 2;
+    double minor = sqrt(major * major - focus * focus);
+
+    double adjustment = minor > tolerate ? minor : tolerate;
+
+    bounds->point.x = (source->x < target->x ? source->x : target->x) - adjustment;
+    bounds->point.y = (source->y < target->y ? source->y : target->y) - adjustment;
+
+    bounds->size.w = fabs(dx) + adjustment * 2;
+    bounds->size.h = fabs(dy) + adjustment * 2;
+
+    return bounds;
+}
+
 /**
  * @brief get the midpoint on a line give two points
  *
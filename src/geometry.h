@@ -89,6 +89,7 @@ extern int point_on_point(POINT *point, POINT *test, int adjustment);
 extern int point_on_line(POINT * source, POINT * target, POINT * point, double tolerate);
 extern POINT * get_point_on_line(LINE *line, int distance, POINT *point);
 extern int point_in_bounds(POINT * point, BOUNDS * bounds);
+extern BOUNDS * get_line_bounds(POINT * source, POINT * target, double tolerate, BOUNDS * bounds);
 extern POINT * get_midpoint(POINT *source, POINT *target, POINT *midpoint);
 
 extern POINT * set_point(POINT * point, double x, double y);
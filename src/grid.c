@@ -0,0 +1,302 @@
+/**
+ * @file grid.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  a uniform grid (spatial index) of artifacts keyed on their bounds
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <glib.h>
+#include <gtk/gtk.h>
+#include <gdk/gdk.h>
+
+#include <math.h>
+
+#include "geometry.h"
+#include "grid.h"
+
+/**
+ * @brief private structure - the range of cells occupied by an item
+ *
+ */
+typedef struct _RANGE
+{
+    int left;
+    int top;
+    int right;
+    int bottom;
+
+} RANGE, *RANGE_P;
+
+/**
+ * @brief the cell coordinate for a value
+ *
+ */
+int grid_cell(GRID *grid, double value)
+{
+
+    return (int)floor(value / grid->size);
+}
+
+/**
+ * @brief the key of a cell - coordinates are folded into 16 bits (folded cells only share candidates)
+ *
+ */
+gpointer grid_key(int x, int y)
+{
+
+    return GUINT_TO_POINTER(((guint)(x & 0xFFFF) << 16) | (guint)(y & 0xFFFF));
+}
+
+/**
+ * @brief calculate the range of cells covered by the bounds (the bounds may have a negative size)
+ *
+ */
+RANGE *grid_get_range(GRID *grid, BOUNDS *bounds, RANGE *range)
+{
+    double x = bounds->size.w < 0 ? bounds->point.x + bounds->size.w : bounds->point.x;
+    double y = bounds->size.h < 0 ? bounds->point.y + bounds->size.h : bounds->point.y;
+
+    range->left = grid_cell(grid, x);
+    range->top = grid_cell(grid, y);
+    range->right = grid_cell(grid, x + fabs(bounds->size.w));
+    range->bottom = grid_cell(grid, y + fabs(bounds->size.h));
+
+    return range;
+}
+
+/**
+ * @brief remove the item from the cells within the range
+ *
+ */
+void grid_unlink(GRID *grid, gpointer item, RANGE *range)
+{
+
+    for (int x = range->left; x <= range->right; x++)
+    {
+        for (int y = range->top; y <= range->bottom; y++)
+        {
+            GPtrArray *cell = g_hash_table_lookup(grid->cells, grid_key(x, y));
+
+            if (cell != NULL)
+            {
+                g_ptr_array_remove_fast(cell, item);
+
+                if (cell->len == 0)
+                {
+                    g_hash_table_remove(grid->cells, grid_key(x, y));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief add the item to the cells within the range
+ *
+ */
+void grid_link(GRID *grid, gpointer item, RANGE *range)
+{
+
+    for (int x = range->left; x <= range->right; x++)
+    {
+        for (int y = range->top; y <= range->bottom; y++)
+        {
+            GPtrArray *cell = g_hash_table_lookup(grid->cells, grid_key(x, y));
+
+            if (cell == NULL)
+            {
+                cell = g_ptr_array_new();
+
+                g_hash_table_insert(grid->cells, grid_key(x, y), cell);
+            }
+
+            g_ptr_array_add(cell, item);
+        }
+    }
+}
+
+/**
+ * @brief register an item (or re-register a registered item)
+ *
+ */
+void grid_insert(GRID *grid, gpointer item, BOUNDS *bounds)
+{
+    RANGE *range = g_hash_table_lookup(grid->items, item);
+    RANGE update;
+
+    grid_get_range(grid, bounds, &update);
+
+    if (range == NULL)
+    {
+        range = g_malloc(sizeof(RANGE));
+
+        g_hash_table_insert(grid->items, item, range);
+    }
+    else if (range->left == update.left && range->top == update.top &&
+             range->right == update.right && range->bottom == update.bottom)
+    {
+        return;
+    }
+    else
+    {
+        grid_unlink(grid, item, range);
+    }
+
+    *range = update;
+
+    grid_link(grid, item, range);
+}
+
+/**
+ * @brief re-register an item that is already registered
+ *
+ */
+int grid_move(GRID *grid, gpointer item, BOUNDS *bounds)
+{
+
+    if (!g_hash_table_contains(grid->items, item))
+    {
+        return FALSE;
+    }
+
+    grid_insert(grid, item, bounds);
+
+    return TRUE;
+}
+
+/**
+ * @brief unregister an item
+ *
+ */
+void grid_remove(GRID *grid, gpointer item)
+{
+    RANGE *range = g_hash_table_lookup(grid->items, item);
+
+    if (range != NULL)
+    {
+        grid_unlink(grid, item, range);
+
+        g_hash_table_remove(grid->items, item);
+    }
+}
+
+/**
+ * @brief is the item registered
+ *
+ */
+int grid_contains(GRID *grid, gpointer item)
+{
+
+    return g_hash_table_contains(grid->items, item);
+}
+
+/**
+ * @brief add the items registered in the cell containing the point
+ *
+ */
+void grid_query(GRID *grid, POINT *point, GPtrArray *items)
+{
+    GPtrArray *cell = g_hash_table_lookup(grid->cells,
+                                          grid_key(grid_cell(grid, point->x), grid_cell(grid, point->y)));
+
+    if (cell != NULL)
+    {
+        for (int iItem = 0; iItem < cell->len; iItem++)
+        {
+            g_ptr_array_add(items, g_ptr_array_index(cell, iItem));
+        }
+    }
+}
+
+/**
+ * @brief add the items registered in the cells overlapping the bounds
+ *
+ */
+void grid_search(GRID *grid, BOUNDS *bounds, GPtrArray *items)
+{
+    GHashTable *found = g_hash_table_new(g_direct_hash, g_direct_equal);
+    RANGE range;
+
+    grid_get_range(grid, bounds, &range);
+
+    for (int x = range.left; x <= range.right; x++)
+    {
+        for (int y = range.top; y <= range.bottom; y++)
+        {
+            GPtrArray *cell = g_hash_table_lookup(grid->cells, grid_key(x, y));
+
+            for (int iItem = 0; cell != NULL && iItem < cell->len; iItem++)
+            {
+                if (g_hash_table_add(found, g_ptr_array_index(cell, iItem)))
+                {
+                    g_ptr_array_add(items, g_ptr_array_index(cell, iItem));
+                }
+            }
+        }
+    }
+
+    g_hash_table_destroy(found);
+}
+
+/**
+ * @brief unregister all the items
+ *
+ */
+void grid_clear(GRID *grid)
+{
+
+    g_hash_table_remove_all(grid->cells);
+    g_hash_table_remove_all(grid->items);
+}
+
+/**
+ * @brief release/free the grid object
+ *
+ */
+void grid_release(GRID *grid)
+{
+
+    g_hash_table_destroy(grid->cells);
+    g_hash_table_destroy(grid->items);
+
+    g_free(grid);
+}
+
+/**
+ * @brief free a cell's item array
+ *
+ */
+void grid_free_cell(gpointer cell)
+{
+
+    g_ptr_array_unref(cell);
+}
+
+/**
+ * @brief grid constructor
+ *
+ */
+GRID *create_grid(double size)
+{
+    GRID *grid = g_malloc(sizeof(GRID));
+
+    grid->size = size;
+
+    grid->cells = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, grid_free_cell);
+    grid->items = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+
+    grid->insert = grid_insert;
+    grid->move = grid_move;
+    grid->remove = grid_remove;
+    grid->contains = grid_contains;
+    grid->query = grid_query;
+    grid->search = grid_search;
+    grid->clear = grid_clear;
+    grid->release = grid_release;
+
+    return grid;
+}
@@ -0,0 +1,106 @@
+/**
+ * @file grid.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - a uniform grid (spatial index) of artifacts keyed on their bounds
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef GRID_H_INCLUDED
+#define GRID_H_INCLUDED
+
+#include "geometry.h"
+
+/**
+ * @brief casts an object to a grid
+ *
+ */
+#define TO_GRID(grid) ((GRID *)(grid))
+
+/**
+ * @brief the default width/height of a grid cell (in pixels)
+ *
+ */
+#define GRID_CELL_SIZE 64
+
+/**
+ * @brief the grid's interface - each item is registered in every cell its bounds overlap
+ *
+ */
+typedef struct _GRID
+{
+
+    /**
+     * @brief register an item (or re-register a registered item) using its bounds
+     *
+     */
+    void (*insert)(struct _GRID *grid, gpointer item, BOUNDS *bounds);
+
+    /**
+     * @brief re-register an item only if it is already registered, returns true if the item was moved
+     *
+     */
+    int (*move)(struct _GRID *grid, gpointer item, BOUNDS *bounds);
+
+    /**
+     * @brief unregister an item
+     *
+     */
+    void (*remove)(struct _GRID *grid, gpointer item);
+
+    /**
+     * @brief returns true if the item is registered, false otherwise
+     *
+     */
+    int (*contains)(struct _GRID *grid, gpointer item);
+
+    /**
+     * @brief add the items registered in the cell containing the point (candidates only)
+     *
+     */
+    void (*query)(struct _GRID *grid, POINT *point, GPtrArray *items);
+
+    /**
+     * @brief add the items registered in the cells overlapping the bounds - each item once (candidates only)
+     *
+     */
+    void (*search)(struct _GRID *grid, BOUNDS *bounds, GPtrArray *items);
+
+    /**
+     * @brief unregister all items
+     *
+     */
+    void (*clear)(struct _GRID *grid);
+
+    /**
+     * @brief release the grid and deallocate resources
+     *
+     */
+    void (*release)(struct _GRID *grid);
+
+    /**
+     * @brief the width/height of a cell
+     *
+     */
+    double size;
+
+    /**
+     * @brief private (cell key -> items within the cell)
+     *
+     */
+    GHashTable *cells;
+
+    /**
+     * @brief private (item -> the range of cells the item occupies)
+     *
+     */
+    GHashTable *items;
+
+} GRID, *GRID_P;
+
+extern GRID *create_grid(double size);
+
+#endif // GRID_H_INCLUDED
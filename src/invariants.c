@@ -0,0 +1,643 @@
+/**
+ * @file invariants.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  the minimal P- and T-semiflows (invariants) of a compiled model (Farkas algorithm)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "explorer.h"
+#include "invariants.h"
+
+/**
+ * @brief private structure - a row of the matrix: the entries left of the incidence matrix (sorted by column) and of
+ *        the identity (the row's support, sorted by node, with a bit set of the support)
+ *
+ */
+typedef struct _INVARIANTS_ROW
+{
+    int entries;
+    int *columns;
+    long long *values;
+
+    int size;
+    int *nodes;
+    long long *weights;
+
+    unsigned long long *support;
+
+} INVARIANTS_ROW, *INVARIANTS_ROW_P;
+
+/**
+ * @brief private structure - the rows of the matrix
+ *
+ */
+typedef struct _INVARIANTS_MATRIX
+{
+    INVARIANTS_ROW **rows;
+    int count;
+    int capacity;
+
+} INVARIANTS_MATRIX, *INVARIANTS_MATRIX_P;
+
+/**
+ * @brief allocate a row with room for the entries and the support
+ *
+ */
+INVARIANTS_ROW *invariants_create_row(int entries, int size, int words)
+{
+    INVARIANTS_ROW *row = malloc(sizeof(INVARIANTS_ROW));
+
+    row->entries = entries;
+    row->size = size;
+
+    row->columns = malloc(sizeof(int) * (entries + size + 1));
+    row->nodes = row->columns + entries;
+    row->values = malloc(sizeof(long long) * (entries + size + 1));
+    row->weights = row->values + entries;
+    row->support = calloc(words, sizeof(unsigned long long));
+
+    return row;
+}
+
+/**
+ * @brief free a row
+ *
+ */
+void invariants_free_row(INVARIANTS_ROW *row)
+{
+
+    free(row->columns);
+    free(row->values);
+    free(row->support);
+
+    free(row);
+}
+
+/**
+ * @brief add a row to the matrix
+ *
+ */
+void invariants_add_row(INVARIANTS_MATRIX *matrix, INVARIANTS_ROW *row)
+{
+
+    if (matrix->count == matrix->capacity)
+    {
+        matrix->capacity = matrix->capacity * 2 + 16;
+        matrix->rows = realloc(matrix->rows, sizeof(INVARIANTS_ROW *) * matrix->capacity);
+    }
+
+    matrix->rows[matrix->count++] = row;
+}
+
+/**
+ * @brief the greatest common divisor of two magnitudes
+ *
+ */
+long long invariants_gcd(long long first, long long second)
+{
+
+    first = first < 0 ? -first : first;
+    second = second < 0 ? -second : second;
+
+    while (second != 0)
+    {
+        long long remainder = first % second;
+
+        first = second;
+        second = remainder;
+    }
+
+    return first;
+}
+
+/**
+ * @brief a row's entry in a column (zero if it has none)
+ *
+ */
+long long invariants_value(INVARIANTS_ROW *row, int column)
+{
+    int low = 0;
+    int high = row->entries - 1;
+
+    while (low <= high)
+    {
+        int middle = (low + high) / 2;
+
+        if (row->columns[middle] == column)
+        {
+            return row->values[middle];
+        }
+
+        if (row->columns[middle] < column)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle - 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief 'first * a + second * b' - returns false if it overflows
+ *
+ */
+int invariants_sum(long long first, long long a, long long second, long long b, long long *sum)
+{
+    long long left = 0;
+    long long right = 0;
+
+    return !__builtin_mul_overflow(first, a, &left) && !__builtin_mul_overflow(second, b, &right) &&
+           !__builtin_add_overflow(left, right, sum);
+}
+
+/**
+ * @brief combine a row with a positive entry in the column and a row with a negative entry so the column's entry is
+ *        zero - the result is divided by the gcd of its entries; returns NULL if an entry overflows
+ *
+ */
+INVARIANTS_ROW *invariants_combine(INVARIANTS *invariants, INVARIANTS_ROW *positive, INVARIANTS_ROW *negative,
+                                   int column, const unsigned long long *support)
+{
+    long long a = -invariants_value(negative, column);
+    long long b = invariants_value(positive, column);
+    long long divisor = invariants_gcd(a, b);
+    INVARIANTS_ROW *row = invariants_create_row(positive->entries + negative->entries,
+                                                positive->size + negative->size, invariants->supportWords);
+    int iFirst = 0;
+    int iSecond = 0;
+    int count = 0;
+
+    a /= divisor;
+    b /= divisor;
+    divisor = 0;
+
+    // the columns left of the incidence matrix (the eliminated column cancels)
+    while (iFirst < positive->entries || iSecond < negative->entries)
+    {
+        int first = iFirst < positive->entries ? positive->columns[iFirst] : -1;
+        int second = iSecond < negative->entries ? negative->columns[iSecond] : -1;
+        int next = first < 0 ? second : second < 0 ? first : first < second ? first : second;
+        long long value = 0;
+
+        if (!invariants_sum(first == next ? positive->values[iFirst] : 0, a,
+                            second == next ? negative->values[iSecond] : 0, b, &value))
+        {
+            invariants->overflow = TRUE;
+            invariants_free_row(row);
+
+            return NULL;
+        }
+
+        iFirst += first == next ? 1 : 0;
+        iSecond += second == next ? 1 : 0;
+
+        if (value != 0 && next != column)
+        {
+            row->columns[count] = next;
+            row->values[count++] = value;
+            divisor = invariants_gcd(divisor, value);
+        }
+    }
+
+    row->entries = count;
+    row->nodes = row->columns + count;
+    row->weights = row->values + count;
+
+    iFirst = 0;
+    iSecond = 0;
+    count = 0;
+
+    // the support (the union of the rows' supports)
+    while (iFirst < positive->size || iSecond < negative->size)
+    {
+        int first = iFirst < positive->size ? positive->nodes[iFirst] : -1;
+        int second = iSecond < negative->size ? negative->nodes[iSecond] : -1;
+        int next = first < 0 ? second : second < 0 ? first : first < second ? first : second;
+        long long weight = 0;
+
+        if (!invariants_sum(first == next ? positive->weights[iFirst] : 0, a,
+                            second == next ? negative->weights[iSecond] : 0, b, &weight))
+        {
+            invariants->overflow = TRUE;
+            invariants_free_row(row);
+
+            return NULL;
+        }
+
+        iFirst += first == next ? 1 : 0;
+        iSecond += second == next ? 1 : 0;
+
+        row->nodes[count] = next;
+        row->weights[count++] = weight;
+        divisor = invariants_gcd(divisor, weight);
+    }
+
+    row->size = count;
+
+    for (int iEntry = 0; iEntry < row->entries + row->size && divisor > 1; iEntry++)
+    {
+        row->values[iEntry] /= divisor;
+    }
+
+    memcpy(row->support, support, sizeof(unsigned long long) * invariants->supportWords);
+
+    return row;
+}
+
+/**
+ * @brief returns true if a row's support is held in the support (the union of two rows' supports)
+ *
+ */
+int invariants_is_subset(INVARIANTS *invariants, INVARIANTS_ROW *row, const unsigned long long *support)
+{
+
+    if (row->size < invariants->supportWords)
+    {
+        for (int iNode = 0; iNode < row->size; iNode++)
+        {
+            if ((support[row->nodes[iNode] / 64] & (1ULL << (row->nodes[iNode] % 64))) == 0)
+            {
+                return FALSE;
+            }
+        }
+
+        return TRUE;
+    }
+
+    for (int iWord = 0; iWord < invariants->supportWords; iWord++)
+    {
+        if (row->support[iWord] & ~support[iWord])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief returns true if the combination of two rows would have a minimal support - no other row's support is held in
+ *        the union of theirs
+ *
+ */
+int invariants_is_minimal(INVARIANTS *invariants, INVARIANTS_MATRIX *matrix, INVARIANTS_ROW *positive,
+                          INVARIANTS_ROW *negative, const unsigned long long *support, int size)
+{
+
+    for (int iRow = 0; iRow < matrix->count; iRow++)
+    {
+        INVARIANTS_ROW *row = matrix->rows[iRow];
+
+        if (row != positive && row != negative && row->size <= size && invariants_is_subset(invariants, row, support))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief the first rows - the incidence matrix (a row per place, or per transition) beside the identity
+ *
+ */
+void invariants_setup(INVARIANTS *invariants, INVARIANTS_MATRIX *matrix)
+{
+    MODEL *model = invariants->model;
+    int *counts = calloc(invariants->nodes + 1, sizeof(int));
+
+    for (int iChange = 0; iChange < model->changeStart[model->transitions]; iChange++)
+    {
+        if (invariants->kind == PLACE_INVARIANTS)
+        {
+            counts[model->changePlaces[iChange]] += 1;
+        }
+    }
+
+    for (int iNode = 0; iNode < invariants->nodes; iNode++)
+    {
+        int entries = invariants->kind == PLACE_INVARIANTS ? counts[iNode]
+                                                            : model->changeStart[iNode + 1] - model->changeStart[iNode];
+        INVARIANTS_ROW *row = invariants_create_row(entries, 1, invariants->supportWords);
+
+        row->entries = 0;
+        row->nodes = row->columns + entries;
+        row->weights = row->values + entries;
+        row->nodes[0] = iNode;
+        row->weights[0] = 1;
+        row->support[iNode / 64] = 1ULL << (iNode % 64);
+
+        invariants_add_row(matrix, row);
+    }
+
+    // the changes of each transition - a place's row is built in transition order, so it is sorted
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        for (int iChange = model->changeStart[iTransition]; iChange < model->changeStart[iTransition + 1]; iChange++)
+        {
+            int place = model->changePlaces[iChange];
+            INVARIANTS_ROW *row = matrix->rows[invariants->kind == PLACE_INVARIANTS ? place : iTransition];
+            int column = invariants->kind == PLACE_INVARIANTS ? iTransition : place;
+            int iEntry = row->entries++;
+
+            // a transition's changes are inserted in place order
+            while (iEntry > 0 && row->columns[iEntry - 1] > column)
+            {
+                row->columns[iEntry] = row->columns[iEntry - 1];
+                row->values[iEntry] = row->values[iEntry - 1];
+                iEntry -= 1;
+            }
+
+            row->columns[iEntry] = column;
+            row->values[iEntry] = model->changeValues[iChange];
+        }
+    }
+
+    free(counts);
+}
+
+/**
+ * @brief the next column to be eliminated - the one whose elimination adds the fewest rows (-1 if every column is
+ *        zero)
+ *
+ */
+int invariants_choose(INVARIANTS_MATRIX *matrix, long *positives, long *negatives, int columns)
+{
+    int chosen = -1;
+    long long fewest = 0;
+
+    memset(positives, 0, sizeof(long) * columns);
+    memset(negatives, 0, sizeof(long) * columns);
+
+    for (int iRow = 0; iRow < matrix->count; iRow++)
+    {
+        INVARIANTS_ROW *row = matrix->rows[iRow];
+
+        for (int iEntry = 0; iEntry < row->entries; iEntry++)
+        {
+            if (row->values[iEntry] > 0)
+            {
+                positives[row->columns[iEntry]] += 1;
+            }
+            else
+            {
+                negatives[row->columns[iEntry]] += 1;
+            }
+        }
+    }
+
+    for (int iColumn = 0; iColumn < columns; iColumn++)
+    {
+        long long added = (long long)positives[iColumn] * negatives[iColumn] - positives[iColumn] - negatives[iColumn];
+
+        if (positives[iColumn] + negatives[iColumn] > 0 && (chosen < 0 || added < fewest))
+        {
+            chosen = iColumn;
+            fewest = added;
+        }
+    }
+
+    return chosen;
+}
+
+/**
+ * @brief eliminate a column - returns false if the limit was reached (the matrix is unchanged)
+ *
+ */
+int invariants_eliminate(INVARIANTS *invariants, INVARIANTS_MATRIX *matrix, int column, int limit)
+{
+    INVARIANTS_MATRIX kept = {NULL, 0, 0};
+    INVARIANTS_MATRIX positives = {NULL, 0, 0};
+    INVARIANTS_MATRIX negatives = {NULL, 0, 0};
+    unsigned long long *support = malloc(sizeof(unsigned long long) * invariants->supportWords);
+    int complete = TRUE;
+
+    for (int iRow = 0; iRow < matrix->count; iRow++)
+    {
+        long long value = invariants_value(matrix->rows[iRow], column);
+
+        invariants_add_row(value > 0 ? &positives : value < 0 ? &negatives : &kept, matrix->rows[iRow]);
+    }
+
+    for (int iPositive = 0; iPositive < positives.count && complete; iPositive++)
+    {
+        INVARIANTS_ROW *positive = positives.rows[iPositive];
+
+        for (int iNegative = 0; iNegative < negatives.count && complete; iNegative++)
+        {
+            INVARIANTS_ROW *negative = negatives.rows[iNegative];
+            INVARIANTS_ROW *row = NULL;
+            int size = 0;
+
+            for (int iWord = 0; iWord < invariants->supportWords; iWord++)
+            {
+                support[iWord] = positive->support[iWord] | negative->support[iWord];
+                size += __builtin_popcountll(support[iWord]);
+            }
+
+            if (!invariants_is_minimal(invariants, matrix, positive, negative, support, size))
+            {
+                continue;
+            }
+
+            row = invariants_combine(invariants, positive, negative, column, support);
+
+            if (row != NULL)
+            {
+                invariants_add_row(&kept, row);
+            }
+
+            complete = limit <= 0 || kept.count + positives.count + negatives.count <= limit;
+        }
+    }
+
+    invariants->rows = kept.count > invariants->rows ? kept.count : invariants->rows;
+
+    if (complete)
+    {
+        for (int iRow = 0; iRow < positives.count; iRow++)
+        {
+            invariants_free_row(positives.rows[iRow]);
+        }
+
+        for (int iRow = 0; iRow < negatives.count; iRow++)
+        {
+            invariants_free_row(negatives.rows[iRow]);
+        }
+
+        free(matrix->rows);
+
+        *matrix = kept;
+    }
+    else
+    {
+        // the combined rows follow the rows kept as they were
+        for (int iRow = matrix->count - positives.count - negatives.count; iRow < kept.count; iRow++)
+        {
+            invariants_free_row(kept.rows[iRow]);
+        }
+
+        free(kept.rows);
+    }
+
+    free(positives.rows);
+    free(negatives.rows);
+    free(support);
+
+    return complete;
+}
+
+/**
+ * @brief hold the rows whose incidence entries are all zero as the invariants
+ *
+ */
+void invariants_collect(INVARIANTS *invariants, INVARIANTS_MATRIX *matrix)
+{
+    int members = 0;
+
+    invariants->count = 0;
+    invariants->coveredCount = 0;
+
+    memset(invariants->covered, 0, sizeof(int) * (invariants->nodes + 1));
+
+    for (int iRow = 0; iRow < matrix->count; iRow++)
+    {
+        members += matrix->rows[iRow]->entries == 0 ? matrix->rows[iRow]->size : 0;
+    }
+
+    invariants->start = realloc(invariants->start, sizeof(int) * (matrix->count + 1));
+    invariants->members = realloc(invariants->members, sizeof(int) * (members + 1));
+    invariants->weights = realloc(invariants->weights, sizeof(long long) * (members + 1));
+
+    invariants->start[0] = 0;
+    members = 0;
+
+    for (int iRow = 0; iRow < matrix->count; iRow++)
+    {
+        INVARIANTS_ROW *row = matrix->rows[iRow];
+
+        if (row->entries != 0)
+        {
+            continue;
+        }
+
+        for (int iNode = 0; iNode < row->size; iNode++)
+        {
+            invariants->members[members] = row->nodes[iNode];
+            invariants->weights[members++] = row->weights[iNode];
+
+            if (!invariants->covered[row->nodes[iNode]])
+            {
+                invariants->covered[row->nodes[iNode]] = TRUE;
+                invariants->coveredCount += 1;
+            }
+        }
+
+        invariants->start[++invariants->count] = members;
+    }
+}
+
+/**
+ * @brief compute the minimal invariants
+ *
+ */
+int invariants_compute(INVARIANTS *invariants, int limit)
+{
+    MODEL *model = invariants->model;
+    int columns = invariants->kind == PLACE_INVARIANTS ? model->transitions : model->places;
+    long *positives = malloc(sizeof(long) * (columns + 1));
+    long *negatives = malloc(sizeof(long) * (columns + 1));
+    INVARIANTS_MATRIX matrix = {NULL, 0, 0};
+    double started = explorer_clock();
+    int column = 0;
+
+    invariants->complete = TRUE;
+    invariants->overflow = FALSE;
+
+    invariants_setup(invariants, &matrix);
+
+    invariants->rows = matrix.count;
+
+    while (invariants->complete && (column = invariants_choose(&matrix, positives, negatives, columns)) >= 0)
+    {
+        invariants->complete = invariants_eliminate(invariants, &matrix, column, limit);
+    }
+
+    invariants_collect(invariants, &matrix);
+
+    invariants->complete = invariants->complete && !invariants->overflow;
+
+    for (int iRow = 0; iRow < matrix.count; iRow++)
+    {
+        invariants_free_row(matrix.rows[iRow]);
+    }
+
+    free(matrix.rows);
+    free(positives);
+    free(negatives);
+
+    invariants->seconds = explorer_clock() - started;
+
+    return invariants->complete;
+}
+
+/**
+ * @brief release/free the invariants object
+ *
+ */
+void invariants_release(INVARIANTS *invariants)
+{
+
+    free(invariants->start);
+    free(invariants->members);
+    free(invariants->weights);
+    free(invariants->covered);
+
+    free(invariants);
+}
+
+/**
+ * @brief invariants constructor
+ *
+ */
+INVARIANTS *create_invariants(MODEL *model, enum INVARIANT_KIND kind)
+{
+    INVARIANTS *invariants = malloc(sizeof(INVARIANTS));
+
+    invariants->model = model;
+    invariants->kind = kind;
+    invariants->nodes = kind == PLACE_INVARIANTS ? model->places : model->transitions;
+    invariants->supportWords = invariants->nodes / 64 + 1;
+
+    invariants->count = 0;
+    invariants->start = calloc(1, sizeof(int));
+    invariants->members = NULL;
+    invariants->weights = NULL;
+    invariants->covered = calloc(invariants->nodes + 1, sizeof(int));
+    invariants->coveredCount = 0;
+
+    invariants->complete = FALSE;
+    invariants->overflow = FALSE;
+    invariants->rows = 0;
+    invariants->seconds = 0;
+
+    invariants->compute = invariants_compute;
+    invariants->release = invariants_release;
+
+    return invariants;
+}
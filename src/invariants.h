@@ -0,0 +1,120 @@
+/**
+ * @file invariants.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - the minimal P- and T-semiflows (invariants) of a compiled model (Farkas algorithm)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef INVARIANTS_H_INCLUDED
+#define INVARIANTS_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a set of invariants
+ *
+ */
+#define TO_INVARIANTS(invariants) ((INVARIANTS *)(invariants))
+
+/**
+ * @brief the semiflows found - place weightings whose weighted token count is constant (P), or transition counts
+ *        whose firing restores a marking (T)
+ *
+ */
+enum INVARIANT_KIND
+{
+    PLACE_INVARIANTS = 0,
+    TRANSITION_INVARIANTS,
+    END_INVARIANT_KINDS
+};
+
+/**
+ * @brief the invariants' interface - the Farkas algorithm starts from the incidence matrix (one row per place, or per
+ *        transition) beside the identity and eliminates a column at a time by adding every row with a positive entry
+ *        to every row with a negative entry; the column that adds the fewest rows is eliminated next
+ *        (Martinez-Silva). Rows are sparse and their entries exact (a row whose entries would overflow is dropped and
+ *        the result marked incomplete); a combined row is discarded at once unless no other row's support is held
+ *        in its support, so only minimal supports are ever held and the result is the minimal semiflows
+ *
+ */
+typedef struct _INVARIANTS
+{
+
+    /**
+     * @brief compute the invariants - stops once 'limit' rows are held (0 is no limit), returns true if every
+     *        minimal invariant was found, false otherwise (those found are minimal)
+     *
+     */
+    int (*compute)(struct _INVARIANTS *invariants, int limit);
+
+    /**
+     * @brief release the invariants and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _INVARIANTS *invariants);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the semiflows found and the number of places (or transitions) they weight
+     *
+     */
+    enum INVARIANT_KIND kind;
+    int nodes;
+
+    /**
+     * @brief the invariants - the nodes in the support of invariant 'i' and their weights are held in
+     *        start[i] .. start[i + 1]
+     *
+     */
+    int count;
+    int *start;
+    int *members;
+    long long *weights;
+
+    /**
+     * @brief true if each node is in the support of some invariant and the number of such nodes (every place
+     *        covered by P-invariants - the net is structurally bounded)
+     *
+     */
+    int *covered;
+    int coveredCount;
+
+    /**
+     * @brief true if the last computation was complete, and true if a row was dropped because it overflowed
+     *
+     */
+    int complete;
+    int overflow;
+
+    /**
+     * @brief the most rows held at once
+     *
+     */
+    long rows;
+
+    /**
+     * @brief the time taken by the last computation (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief private (the words of a row's support - node 'n' is bit 'n % 64' of word 'n / 64')
+     *
+     */
+    int supportWords;
+
+} INVARIANTS, *INVARIANTS_P;
+
+extern INVARIANTS *create_invariants(MODEL *model, enum INVARIANT_KIND kind);
+
+#endif // INVARIANTS_H_INCLUDED
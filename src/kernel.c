@@ -0,0 +1,300 @@
+/**
+ * @file kernel.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  tests and fires a transition on a batch of markings at once (scalar, SSE2 or AVX2)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define KERNEL_X86
+#include <immintrin.h>
+#endif
+
+#include "model.h"
+#include "kernel.h"
+
+/**
+ * @brief the name of each kernel
+ *
+ */
+static const char *kernel_names[END_KERNEL_TYPES] = {"scalar", "sse2", "avx2"};
+
+/**
+ * @brief the lanes in which the transition is enabled - one lane at a time
+ *
+ */
+unsigned int kernel_scalar_enabled(KERNEL *kernel, const unsigned int *batch, int transition)
+{
+    MODEL *model = kernel->model;
+    unsigned int lanes = KERNEL_ALL_LANES;
+
+    for (int iArc = model->inputStart[transition]; iArc < model->inputStart[transition + 1] && lanes != 0; iArc++)
+    {
+        const unsigned int *tokens = &batch[model->inputPlaces[iArc] * KERNEL_LANES];
+        unsigned int weight = model->inputWeights[iArc];
+
+        for (int iLane = 0; iLane < KERNEL_LANES; iLane++)
+        {
+            if (tokens[iLane] < weight)
+            {
+                lanes &= ~(1u << iLane);
+            }
+        }
+    }
+
+    return lanes;
+}
+
+/**
+ * @brief add the transition's change to every lane - one lane at a time
+ *
+ */
+void kernel_scalar_fire(KERNEL *kernel, unsigned int *batch, int transition, int times)
+{
+    MODEL *model = kernel->model;
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        unsigned int *tokens = &batch[model->changePlaces[iChange] * KERNEL_LANES];
+        unsigned int change = (unsigned int)(model->changeValues[iChange] * times);
+
+        for (int iLane = 0; iLane < KERNEL_LANES; iLane++)
+        {
+            tokens[iLane] += change;
+        }
+    }
+}
+
+#ifdef KERNEL_X86
+
+/**
+ * @brief the lanes in which the transition is enabled - four lanes per register (SSE2 has no unsigned comparison,
+ *        so the sign bits are flipped and the comparison is signed)
+ *
+ */
+__attribute__((target("sse2"))) unsigned int kernel_sse2_enabled(KERNEL *kernel, const unsigned int *batch,
+                                                                  int transition)
+{
+    MODEL *model = kernel->model;
+    __m128i sign = _mm_set1_epi32((int)0x80000000u);
+    __m128i low = _mm_set1_epi32(-1);
+    __m128i high = _mm_set1_epi32(-1);
+
+    for (int iArc = model->inputStart[transition]; iArc < model->inputStart[transition + 1]; iArc++)
+    {
+        const unsigned int *tokens = &batch[model->inputPlaces[iArc] * KERNEL_LANES];
+        __m128i weight = _mm_xor_si128(_mm_set1_epi32(model->inputWeights[iArc]), sign);
+
+        // a lane is disabled if the weight exceeds its tokens
+        low = _mm_andnot_si128(_mm_cmpgt_epi32(weight, _mm_xor_si128(_mm_loadu_si128((const __m128i *)tokens), sign)),
+                               low);
+        high = _mm_andnot_si128(
+            _mm_cmpgt_epi32(weight, _mm_xor_si128(_mm_loadu_si128((const __m128i *)(tokens + 4)), sign)), high);
+
+        if (_mm_movemask_epi8(_mm_or_si128(low, high)) == 0)
+        {
+            return 0;
+        }
+    }
+
+    return (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(low)) |
+           ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(high)) << 4);
+}
+
+/**
+ * @brief add the transition's change to every lane - four lanes per register
+ *
+ */
+__attribute__((target("sse2"))) void kernel_sse2_fire(KERNEL *kernel, unsigned int *batch, int transition, int times)
+{
+    MODEL *model = kernel->model;
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        __m128i *tokens = (__m128i *)&batch[model->changePlaces[iChange] * KERNEL_LANES];
+        __m128i change = _mm_set1_epi32(model->changeValues[iChange] * times);
+
+        _mm_storeu_si128(tokens, _mm_add_epi32(_mm_loadu_si128(tokens), change));
+        _mm_storeu_si128(tokens + 1, _mm_add_epi32(_mm_loadu_si128(tokens + 1), change));
+    }
+}
+
+/**
+ * @brief the lanes in which the transition is enabled - every lane in one register
+ *
+ */
+__attribute__((target("avx2"))) unsigned int kernel_avx2_enabled(KERNEL *kernel, const unsigned int *batch,
+                                                                  int transition)
+{
+    MODEL *model = kernel->model;
+    __m256i sign = _mm256_set1_epi32((int)0x80000000u);
+    __m256i lanes = _mm256_set1_epi32(-1);
+
+    for (int iArc = model->inputStart[transition]; iArc < model->inputStart[transition + 1]; iArc++)
+    {
+        const unsigned int *tokens = &batch[model->inputPlaces[iArc] * KERNEL_LANES];
+        __m256i weight = _mm256_xor_si256(_mm256_set1_epi32(model->inputWeights[iArc]), sign);
+
+        // a lane is disabled if the weight exceeds its tokens
+        lanes = _mm256_andnot_si256(
+            _mm256_cmpgt_epi32(weight, _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)tokens), sign)), lanes);
+
+        if (_mm256_testz_si256(lanes, lanes))
+        {
+            return 0;
+        }
+    }
+
+    return (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(lanes));
+}
+
+/**
+ * @brief add the transition's change to every lane - every lane in one register
+ *
+ */
+__attribute__((target("avx2"))) void kernel_avx2_fire(KERNEL *kernel, unsigned int *batch, int transition, int times)
+{
+    MODEL *model = kernel->model;
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        __m256i *tokens = (__m256i *)&batch[model->changePlaces[iChange] * KERNEL_LANES];
+
+        _mm256_storeu_si256(tokens, _mm256_add_epi32(_mm256_loadu_si256(tokens),
+                                                     _mm256_set1_epi32(model->changeValues[iChange] * times)));
+    }
+}
+
+#endif
+
+/**
+ * @brief the name of a kernel
+ *
+ */
+const char *kernel_name(enum KERNEL_TYPE type)
+{
+
+    return kernel_names[type];
+}
+
+/**
+ * @brief returns true if the processor supports the kernel's instructions, false otherwise
+ *
+ */
+int kernel_is_supported(enum KERNEL_TYPE type)
+{
+
+    switch (type)
+    {
+    case SCALAR_KERNEL:
+        return TRUE;
+#ifdef KERNEL_X86
+    case SSE2_KERNEL:
+        return __builtin_cpu_supports("sse2") ? TRUE : FALSE;
+    case AVX2_KERNEL:
+        return __builtin_cpu_supports("avx2") ? TRUE : FALSE;
+#endif
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief copy a marking into a lane of a batch
+ *
+ */
+void kernel_load(unsigned int *batch, int lane, const unsigned int *marking, int places)
+{
+
+    for (int iPlace = 0; iPlace < places; iPlace++)
+    {
+        batch[iPlace * KERNEL_LANES + lane] = marking[iPlace];
+    }
+}
+
+/**
+ * @brief copy a lane of a batch into a marking
+ *
+ */
+void kernel_store(const unsigned int *batch, int lane, unsigned int *marking, int places)
+{
+
+    for (int iPlace = 0; iPlace < places; iPlace++)
+    {
+        marking[iPlace] = batch[iPlace * KERNEL_LANES + lane];
+    }
+}
+
+/**
+ * @brief release/free the kernel object
+ *
+ */
+void kernel_release(KERNEL *kernel)
+{
+
+    free(kernel);
+}
+
+/**
+ * @brief kernel constructor - returns NULL if the processor does not support the kernel's instructions
+ *
+ */
+KERNEL *create_kernel(MODEL *model, enum KERNEL_TYPE type)
+{
+    KERNEL *kernel = NULL;
+
+    if (!kernel_is_supported(type))
+    {
+        return NULL;
+    }
+
+    kernel = malloc(sizeof(KERNEL));
+
+    kernel->model = model;
+    kernel->type = type;
+    kernel->name = kernel_names[type];
+
+    kernel->enabled = kernel_scalar_enabled;
+    kernel->fire = kernel_scalar_fire;
+
+#ifdef KERNEL_X86
+    if (type == SSE2_KERNEL)
+    {
+        kernel->enabled = kernel_sse2_enabled;
+        kernel->fire = kernel_sse2_fire;
+    }
+    else if (type == AVX2_KERNEL)
+    {
+        kernel->enabled = kernel_avx2_enabled;
+        kernel->fire = kernel_avx2_fire;
+    }
+#endif
+
+    kernel->release = kernel_release;
+
+    return kernel;
+}
+
+/**
+ * @brief the kernel using the widest instructions the processor supports
+ *
+ */
+KERNEL *create_fastest_kernel(MODEL *model)
+{
+
+    for (int iType = END_KERNEL_TYPES - 1; iType > SCALAR_KERNEL; iType--)
+    {
+        if (kernel_is_supported(iType))
+        {
+            return create_kernel(model, iType);
+        }
+    }
+
+    return create_kernel(model, SCALAR_KERNEL);
+}
@@ -0,0 +1,102 @@
+/**
+ * @file kernel.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - tests and fires a transition on a batch of markings at once (scalar, SSE2 or AVX2)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef KERNEL_H_INCLUDED
+#define KERNEL_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a kernel
+ *
+ */
+#define TO_KERNEL(kernel) ((KERNEL *)(kernel))
+
+/**
+ * @brief the markings in a batch (the lanes of an AVX2 register)
+ *
+ */
+#define KERNEL_LANES 8
+
+/**
+ * @brief the lanes of a batch as a mask (bit 'l' is lane 'l')
+ *
+ */
+#define KERNEL_ALL_LANES ((1u << KERNEL_LANES) - 1)
+
+/**
+ * @brief the instructions a kernel uses
+ *
+ */
+enum KERNEL_TYPE
+{
+    SCALAR_KERNEL = 0,
+    SSE2_KERNEL,
+    AVX2_KERNEL,
+    END_KERNEL_TYPES
+};
+
+/**
+ * @brief the kernel's interface - a batch holds KERNEL_LANES markings place by place: the tokens of place 'p' in
+ *        lane 'l' are 'batch[p * KERNEL_LANES + l]'. A kernel is chosen at run time from the instructions the
+ *        processor supports (the scalar kernel runs everywhere)
+ *
+ */
+typedef struct _KERNEL
+{
+
+    /**
+     * @brief the lanes of the batch in which the transition is enabled (a mask)
+     *
+     */
+    unsigned int (*enabled)(struct _KERNEL *kernel, const unsigned int *batch, int transition);
+
+    /**
+     * @brief add the transition's change to every lane of the batch ('times' is 1 to fire, -1 to undo a firing) -
+     *        the lanes in which the transition is not enabled are meaningless until the firing is undone
+     *
+     */
+    void (*fire)(struct _KERNEL *kernel, unsigned int *batch, int transition, int times);
+
+    /**
+     * @brief release the kernel and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _KERNEL *kernel);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the instructions used and their name
+     *
+     */
+    enum KERNEL_TYPE type;
+    const char *name;
+
+} KERNEL, *KERNEL_P;
+
+extern KERNEL *create_kernel(MODEL *model, enum KERNEL_TYPE type);
+
+extern KERNEL *create_fastest_kernel(MODEL *model);
+
+extern const char *kernel_name(enum KERNEL_TYPE type);
+
+extern int kernel_is_supported(enum KERNEL_TYPE type);
+
+extern void kernel_load(unsigned int *batch, int lane, const unsigned int *marking, int places);
+
+extern void kernel_store(const unsigned int *batch, int lane, unsigned int *marking, int places);
+
+#endif // KERNEL_H_INCLUDED
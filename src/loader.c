@@ -0,0 +1,236 @@
+/**
+ * @file loader.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  loads a saved net (see writer) directly into a compiled model - places and transitions are indexed
+ *         in the order they appear in the file
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+
+#include "model.h"
+#include "loader.h"
+
+#define PLACE_ELEMENT "place"
+#define TRANSITION_ELEMENT "transition"
+#define ARC_ELEMENT "arc"
+
+#define NODE_ID_ATTRIBUTE "id"
+#define NODE_NAME_ATTRIBUTE "name"
+#define TOKENS_ATTRIBUTE "tokens"
+#define SOURCE_ATTRIBUTE "source"
+#define TARGET_ATTRIBUTE "target"
+#define WEIGHT_ATTRIBUTE "weight"
+
+/**
+ * @brief the node types - as generated in a reference ([type]-[id])
+ *
+ */
+#define LOADER_PLACE 0
+#define LOADER_TRANSITION 1
+
+/**
+ * @brief private structure - a node's identifier and its index in the model
+ *
+ */
+typedef struct _LOADER_NODE
+{
+    int id;
+    int index;
+
+} LOADER_NODE, *LOADER_NODE_P;
+
+/**
+ * @brief private structure - the nodes found (by type) while loading
+ *
+ */
+typedef struct _LOADER
+{
+    LOADER_NODE *nodes[2];
+    int counts[2];
+    int capacities[2];
+
+} LOADER, *LOADER_P;
+
+/**
+ * @brief order the nodes by identifier
+ *
+ */
+int loader_compare_nodes(const void *a, const void *b)
+{
+    const LOADER_NODE *first = a;
+    const LOADER_NODE *second = b;
+
+    return first->id < second->id ? -1 : first->id > second->id ? 1 : 0;
+}
+
+/**
+ * @brief get an integer attribute (the fallback if the attribute is missing)
+ *
+ */
+int loader_get_integer(xmlNode *node, const char *name, int fallback)
+{
+    xmlChar *value = xmlGetProp(node, BAD_CAST name);
+    int result = value == NULL ? fallback : atoi((char *)value);
+
+    xmlFree(value);
+
+    return result;
+}
+
+/**
+ * @brief collect the places or transitions (in document order)
+ *
+ */
+void loader_collect_nodes(LOADER *loader, xmlNode *parent, int type, const char *element)
+{
+
+    for (xmlNode *node = parent; node; node = node->next)
+    {
+        if (node->type == XML_ELEMENT_NODE && strcmp((char *)node->name, element) == 0)
+        {
+            if (loader->counts[type] == loader->capacities[type])
+            {
+                loader->capacities[type] = loader->capacities[type] == 0 ? 64 : loader->capacities[type] * 2;
+                loader->nodes[type] = realloc(loader->nodes[type], sizeof(LOADER_NODE) * loader->capacities[type]);
+            }
+
+            loader->nodes[type][loader->counts[type]].id = loader_get_integer(node, NODE_ID_ATTRIBUTE, 0);
+            loader->nodes[type][loader->counts[type]].index = loader->counts[type];
+            loader->counts[type] += 1;
+        }
+
+        loader_collect_nodes(loader, node->children, type, element);
+    }
+}
+
+/**
+ * @brief resolve a reference ([type]-[id]) - returns the node's index, -1 if the node is unknown
+ *
+ */
+int loader_resolve(LOADER *loader, xmlChar *reference, int *type)
+{
+    LOADER_NODE key;
+    LOADER_NODE *node = NULL;
+
+    if (reference == NULL || sscanf((char *)reference, "%d-%d", type, &key.id) != 2 || *type < 0 || *type > 1)
+    {
+        return -1;
+    }
+
+    node = bsearch(&key, loader->nodes[*type], loader->counts[*type], sizeof(LOADER_NODE), loader_compare_nodes);
+
+    return node == NULL ? -1 : node->index;
+}
+
+/**
+ * @brief set the places, transitions and arcs of the model
+ *
+ */
+void loader_process_elements(LOADER *loader, MODEL *model, xmlNode *parent, int *places, int *transitions)
+{
+
+    for (xmlNode *node = parent; node; node = node->next)
+    {
+        if (node->type == XML_ELEMENT_NODE)
+        {
+            if (strcmp((char *)node->name, PLACE_ELEMENT) == 0 || strcmp((char *)node->name, TRANSITION_ELEMENT) == 0)
+            {
+                xmlChar *name = xmlGetProp(node, BAD_CAST NODE_NAME_ATTRIBUTE);
+
+                if (strcmp((char *)node->name, PLACE_ELEMENT) == 0)
+                {
+                    model->setBound(model, *places, loader_get_integer(node, BOUND_ATTRIBUTE, 0));
+                    model->setPlace(model, (*places)++, (char *)name, loader_get_integer(node, TOKENS_ATTRIBUTE, 0));
+                }
+                else
+                {
+                    model->setTransition(model, (*transitions)++, (char *)name,
+                                         loader_get_integer(node, DURATION_ATTRIBUTE, 0));
+                }
+
+                xmlFree(name);
+            }
+
+            if (strcmp((char *)node->name, ARC_ELEMENT) == 0)
+            {
+                xmlChar *source = xmlGetProp(node, BAD_CAST SOURCE_ATTRIBUTE);
+                xmlChar *target = xmlGetProp(node, BAD_CAST TARGET_ATTRIBUTE);
+                int sourceType = -1;
+                int targetType = -1;
+                int from = loader_resolve(loader, source, &sourceType);
+                int to = loader_resolve(loader, target, &targetType);
+
+                if (from >= 0 && to >= 0 && sourceType != targetType)
+                {
+                    if (sourceType == LOADER_PLACE)
+                    {
+                        model->connect(model, from, to, loader_get_integer(node, WEIGHT_ATTRIBUTE, 1), INPUT_FLOW);
+                    }
+                    else
+                    {
+                        model->connect(model, to, from, loader_get_integer(node, WEIGHT_ATTRIBUTE, 1), OUTPUT_FLOW);
+                    }
+                }
+                else
+                {
+                    fprintf(stderr, "ignoring arc %s -> %s\n", source == NULL ? "?" : (char *)source,
+                            target == NULL ? "?" : (char *)target);
+                }
+
+                xmlFree(source);
+                xmlFree(target);
+            }
+        }
+
+        loader_process_elements(loader, model, node->children, places, transitions);
+    }
+}
+
+/**
+ * @brief load a saved net into a compiled model - returns NULL if the file can't be parsed
+ *
+ */
+MODEL *create_model_from_file(const char *filename)
+{
+    LOADER loader;
+    MODEL *model = NULL;
+    xmlDoc *document = xmlReadFile(filename, NULL, 0);
+    int places = 0;
+    int transitions = 0;
+
+    if (document == NULL)
+    {
+        return NULL;
+    }
+
+    memset(&loader, 0, sizeof(LOADER));
+
+    loader_collect_nodes(&loader, xmlDocGetRootElement(document), LOADER_PLACE, PLACE_ELEMENT);
+    loader_collect_nodes(&loader, xmlDocGetRootElement(document), LOADER_TRANSITION, TRANSITION_ELEMENT);
+
+    qsort(loader.nodes[LOADER_PLACE], loader.counts[LOADER_PLACE], sizeof(LOADER_NODE), loader_compare_nodes);
+    qsort(loader.nodes[LOADER_TRANSITION], loader.counts[LOADER_TRANSITION], sizeof(LOADER_NODE), loader_compare_nodes);
+
+    model = create_model(loader.counts[LOADER_PLACE], loader.counts[LOADER_TRANSITION]);
+
+    loader_process_elements(&loader, model, xmlDocGetRootElement(document), &places, &transitions);
+
+    model->compile(model);
+
+    free(loader.nodes[LOADER_PLACE]);
+    free(loader.nodes[LOADER_TRANSITION]);
+
+    xmlFreeDoc(document);
+
+    return model;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file loader.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - loads a saved net directly into a compiled model (no GTK dependency)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef LOADER_H_INCLUDED
+#define LOADER_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief the transition attribute holding the duration (optional - zero if missing)
+ *
+ */
+#define DURATION_ATTRIBUTE "duration"
+
+/**
+ * @brief the place attribute declaring the most tokens the place holds (optional - unknown if missing)
+ *
+ */
+#define BOUND_ATTRIBUTE "bound"
+
+extern MODEL *create_model_from_file(const char *filename);
+
+#endif // LOADER_H_INCLUDED
@@ -0,0 +1,334 @@
+/**
+ * @file model.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  a compiled (dense, index based) representation of a petri-net used by the analysers
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+
+/**
+ * @brief order the arcs by transition, direction and place
+ *
+ */
+int model_compare_arcs(const void *a, const void *b)
+{
+    const MODEL_ARC *first = a;
+    const MODEL_ARC *second = b;
+
+    if (first->transition != second->transition)
+    {
+        return first->transition < second->transition ? -1 : 1;
+    }
+
+    if (first->flow != second->flow)
+    {
+        return first->flow < second->flow ? -1 : 1;
+    }
+
+    return first->place < second->place ? -1 : first->place > second->place ? 1 : 0;
+}
+
+/**
+ * @brief copy a name (a missing name is stored as an empty string)
+ *
+ */
+char *model_copy_name(const char *name)
+{
+    char *copy = malloc(name == NULL ? 1 : strlen(name) + 1);
+
+    strcpy(copy, name == NULL ? "" : name);
+
+    return copy;
+}
+
+/**
+ * @brief name a place and set its initial marking
+ *
+ */
+void model_set_place(MODEL *model, int place, const char *name, int marking)
+{
+
+    free(model->placeNames[place]);
+
+    model->placeNames[place] = model_copy_name(name);
+    model->marking[place] = marking;
+}
+
+/**
+ * @brief declare the bound of a place
+ *
+ */
+void model_set_bound(MODEL *model, int place, int bound)
+{
+
+    model->bounds[place] = bound;
+}
+
+/**
+ * @brief name a transition and set its duration
+ *
+ */
+void model_set_transition(MODEL *model, int transition, const char *name, int duration)
+{
+
+    free(model->transitionNames[transition]);
+
+    model->transitionNames[transition] = model_copy_name(name);
+    model->durations[transition] = duration;
+}
+
+/**
+ * @brief collect an arc
+ *
+ */
+void model_connect(MODEL *model, int place, int transition, int weight, enum FLOW flow)
+{
+
+    if (model->arcCount == model->arcCapacity)
+    {
+        model->arcCapacity = model->arcCapacity == 0 ? 64 : model->arcCapacity * 2;
+        model->arcs = realloc(model->arcs, sizeof(MODEL_ARC) * model->arcCapacity);
+    }
+
+    model->arcs[model->arcCount].place = place;
+    model->arcs[model->arcCount].transition = transition;
+    model->arcs[model->arcCount].weight = weight;
+    model->arcs[model->arcCount].flow = flow;
+
+    model->arcCount += 1;
+}
+
+/**
+ * @brief build the compressed rows for one direction (the arcs are sorted)
+ *
+ */
+void model_compile_flow(MODEL *model, enum FLOW flow, int **start, int **places, int **weights)
+{
+    int count = 0;
+
+    *start = calloc(model->transitions + 1, sizeof(int));
+    *places = malloc(sizeof(int) * (model->arcCount + 1));
+    *weights = malloc(sizeof(int) * (model->arcCount + 1));
+
+    for (int iArc = 0; iArc < model->arcCount; iArc++)
+    {
+        MODEL_ARC *arc = &model->arcs[iArc];
+
+        if (arc->flow != flow)
+        {
+            continue;
+        }
+
+        if (count > 0 && (*places)[count - 1] == arc->place &&
+            iArc > 0 && model->arcs[iArc - 1].transition == arc->transition && model->arcs[iArc - 1].flow == flow)
+        {
+            (*weights)[count - 1] += arc->weight;
+
+            continue;
+        }
+
+        (*places)[count] = arc->place;
+        (*weights)[count] = arc->weight;
+        (*start)[arc->transition + 1] += 1;
+
+        count += 1;
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        (*start)[iTransition + 1] += (*start)[iTransition];
+    }
+}
+
+/**
+ * @brief build the change rows by merging each transition's (sorted) input and output rows
+ *
+ */
+void model_compile_change(MODEL *model)
+{
+    int count = 0;
+
+    model->changeStart = calloc(model->transitions + 1, sizeof(int));
+    model->changePlaces = malloc(sizeof(int) * (model->arcCount + 1));
+    model->changeValues = malloc(sizeof(int) * (model->arcCount + 1));
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        int iInput = model->inputStart[iTransition];
+        int iOutput = model->outputStart[iTransition];
+
+        while (iInput < model->inputStart[iTransition + 1] || iOutput < model->outputStart[iTransition + 1])
+        {
+            int input = iInput < model->inputStart[iTransition + 1] ? model->inputPlaces[iInput] : model->places;
+            int output = iOutput < model->outputStart[iTransition + 1] ? model->outputPlaces[iOutput] : model->places;
+            int place = input < output ? input : output;
+            int value = 0;
+
+            if (input == place)
+            {
+                value -= model->inputWeights[iInput++];
+            }
+
+            if (output == place)
+            {
+                value += model->outputWeights[iOutput++];
+            }
+
+            if (value != 0)
+            {
+                model->changePlaces[count] = place;
+                model->changeValues[count] = value;
+
+                count += 1;
+            }
+        }
+
+        model->changeStart[iTransition + 1] = count;
+    }
+}
+
+/**
+ * @brief build the consumer rows (per place) by transposing the input rows
+ *
+ */
+void model_compile_consumers(MODEL *model)
+{
+    int count = model->inputStart[model->transitions];
+    int *next = malloc(sizeof(int) * (model->places + 1));
+
+    model->consumerStart = calloc(model->places + 1, sizeof(int));
+    model->consumerTransitions = malloc(sizeof(int) * (count + 1));
+    model->consumerWeights = malloc(sizeof(int) * (count + 1));
+
+    for (int iArc = 0; iArc < count; iArc++)
+    {
+        model->consumerStart[model->inputPlaces[iArc] + 1] += 1;
+    }
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        model->consumerStart[iPlace + 1] += model->consumerStart[iPlace];
+    }
+
+    memcpy(next, model->consumerStart, sizeof(int) * (model->places + 1));
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1]; iArc++)
+        {
+            int slot = next[model->inputPlaces[iArc]]++;
+
+            model->consumerTransitions[slot] = iTransition;
+            model->consumerWeights[slot] = model->inputWeights[iArc];
+        }
+    }
+
+    free(next);
+}
+
+/**
+ * @brief build the compressed rows from the collected arcs
+ *
+ */
+void model_compile(MODEL *model)
+{
+
+    free(model->inputStart);
+    free(model->inputPlaces);
+    free(model->inputWeights);
+    free(model->outputStart);
+    free(model->outputPlaces);
+    free(model->outputWeights);
+    free(model->changeStart);
+    free(model->changePlaces);
+    free(model->changeValues);
+    free(model->consumerStart);
+    free(model->consumerTransitions);
+    free(model->consumerWeights);
+
+    qsort(model->arcs, model->arcCount, sizeof(MODEL_ARC), model_compare_arcs);
+
+    model_compile_flow(model, INPUT_FLOW, &model->inputStart, &model->inputPlaces, &model->inputWeights);
+    model_compile_flow(model, OUTPUT_FLOW, &model->outputStart, &model->outputPlaces, &model->outputWeights);
+
+    model_compile_change(model);
+    model_compile_consumers(model);
+}
+
+/**
+ * @brief release/free the model object
+ *
+ */
+void model_release(MODEL *model)
+{
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        free(model->placeNames[iPlace]);
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        free(model->transitionNames[iTransition]);
+    }
+
+    free(model->placeNames);
+    free(model->transitionNames);
+    free(model->marking);
+    free(model->bounds);
+    free(model->durations);
+
+    free(model->inputStart);
+    free(model->inputPlaces);
+    free(model->inputWeights);
+    free(model->outputStart);
+    free(model->outputPlaces);
+    free(model->outputWeights);
+    free(model->changeStart);
+    free(model->changePlaces);
+    free(model->changeValues);
+    free(model->consumerStart);
+    free(model->consumerTransitions);
+    free(model->consumerWeights);
+
+    free(model->arcs);
+
+    free(model);
+}
+
+/**
+ * @brief model constructor
+ *
+ */
+MODEL *create_model(int places, int transitions)
+{
+    MODEL *model = calloc(1, sizeof(MODEL));
+
+    model->places = places;
+    model->transitions = transitions;
+
+    model->marking = calloc(places + 1, sizeof(int));
+    model->bounds = calloc(places + 1, sizeof(int));
+    model->durations = calloc(transitions + 1, sizeof(int));
+    model->placeNames = calloc(places + 1, sizeof(char *));
+    model->transitionNames = calloc(transitions + 1, sizeof(char *));
+
+    model->setPlace = model_set_place;
+    model->setBound = model_set_bound;
+    model->setTransition = model_set_transition;
+    model->connect = model_connect;
+    model->compile = model_compile;
+    model->release = model_release;
+
+    model->compile(model);
+
+    return model;
+}
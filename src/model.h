@@ -0,0 +1,183 @@
+/**
+ * @file model.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - a compiled (dense, index based) representation of a petri-net used by the analysers
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef MODEL_H_INCLUDED
+#define MODEL_H_INCLUDED
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+/**
+ * @brief casts an object to a model
+ *
+ */
+#define TO_MODEL(model) ((MODEL *)(model))
+
+/**
+ * @brief the direction of an arc relative to its transition
+ *
+ */
+enum FLOW
+{
+    INPUT_FLOW = 0,
+    OUTPUT_FLOW,
+    END_FLOW_TYPES
+};
+
+/**
+ * @brief private structure - an arc collected before the model is compiled
+ *
+ */
+typedef struct _MODEL_ARC
+{
+    int place;
+    int transition;
+    int weight;
+    enum FLOW flow;
+
+} MODEL_ARC, *MODEL_ARC_P;
+
+/**
+ * @brief the model's interface - places and transitions are identified by their index,
+ *        the arcs are held per transition in compressed rows (start[t] .. start[t + 1])
+ *
+ */
+typedef struct _MODEL
+{
+
+    /**
+     * @brief name a place and set its initial marking
+     *
+     */
+    void (*setPlace)(struct _MODEL *model, int place, const char *name, int marking);
+
+    /**
+     * @brief name a transition and set its duration
+     *
+     */
+    void (*setTransition)(struct _MODEL *model, int transition, const char *name, int duration);
+
+    /**
+     * @brief declare the most tokens a place is expected to hold (zero if unknown)
+     *
+     */
+    void (*setBound)(struct _MODEL *model, int place, int bound);
+
+    /**
+     * @brief join a place and a transition (arcs with the same ends and direction are merged)
+     *
+     */
+    void (*connect)(struct _MODEL *model, int place, int transition, int weight, enum FLOW flow);
+
+    /**
+     * @brief build the compressed rows from the arcs - must be called before the model is used
+     *
+     */
+    void (*compile)(struct _MODEL *model);
+
+    /**
+     * @brief release the model and deallocate resources
+     *
+     */
+    void (*release)(struct _MODEL *model);
+
+    /**
+     * @brief the number of places
+     *
+     */
+    int places;
+
+    /**
+     * @brief the number of transitions
+     *
+     */
+    int transitions;
+
+    /**
+     * @brief the initial marking (one entry per place)
+     *
+     */
+    int *marking;
+
+    /**
+     * @brief the declared bound of each place (zero if unknown)
+     *
+     */
+    int *bounds;
+
+    /**
+     * @brief the duration of each transition
+     *
+     */
+    int *durations;
+
+    /**
+     * @brief the name of each place
+     *
+     */
+    char **placeNames;
+
+    /**
+     * @brief the name of each transition
+     *
+     */
+    char **transitionNames;
+
+    /**
+     * @brief the input (pre) arcs - the places consumed from and the weights
+     *
+     */
+    int *inputStart;
+    int *inputPlaces;
+    int *inputWeights;
+
+    /**
+     * @brief the output (post) arcs - the places produced to and the weights
+     *
+     */
+    int *outputStart;
+    int *outputPlaces;
+    int *outputWeights;
+
+    /**
+     * @brief the change (post - pre) to each place the transition touches - zero changes are omitted
+     *
+     */
+    int *changeStart;
+    int *changePlaces;
+    int *changeValues;
+
+    /**
+     * @brief the consumers of each place - the transitions (and the weights) the place is an input of
+     *
+     */
+    int *consumerStart;
+    int *consumerTransitions;
+    int *consumerWeights;
+
+    /**
+     * @brief private (the arcs collected before compilation)
+     *
+     */
+    MODEL_ARC *arcs;
+    int arcCount;
+    int arcCapacity;
+
+} MODEL, *MODEL_P;
+
+extern MODEL *create_model(int places, int transitions);
+
+#endif // MODEL_H_INCLUDED
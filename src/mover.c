@@ -51,7 +51,7 @@ void mover_source_arc_iterator(gpointer artifact, gpointer node)
 
     VERTEX *vertex = g_ptr_array_index(TO_ARC(artifact)->vertices, 0);
 
-    copy_point(&TO_NODE(node)->position, &vertex->point);
+    vertex->operations->setPoint(vertex, &TO_NODE(node)->position);
 }
 
 /**
@@ -62,7 +62,7 @@ void mover_target_arc_iterator(gpointer artifact, gpointer node)
 {
     VERTEX *vertex = g_ptr_array_index(TO_ARC(artifact)->vertices, TO_ARC(artifact)->vertices->len - 1);
 
-    copy_point(&TO_NODE(node)->position, &vertex->point);
+    vertex->operations->setPoint(vertex, &TO_NODE(node)->position);
 }
 
 /**
@@ -82,7 +82,7 @@ void mover_node_event_handler(EVENT *event, void *processor)
             int x = TO_MOVER(processor)->offset.x + event->events.update_drag_event.offset_x;
             int y = TO_MOVER(processor)->offset.y + event->events.update_drag_event.offset_y;
 
-            node->setPosition(node, x, y);
+            node->operations->setPosition(node, x, y);
 
             g_ptr_array_foreach(TO_MOVER(processor)->sources, mover_source_arc_iterator, node);
             g_ptr_array_foreach(TO_MOVER(processor)->targets, mover_target_arc_iterator, node);
@@ -106,7 +106,7 @@ void mover_node_event_handler(EVENT *event, void *processor)
 
             adjust_point(&point, 8);
 
-            node->setPosition(node, point.x, point.y);
+            node->operations->setPosition(node, point.x, point.y);
 
             g_ptr_array_foreach(TO_MOVER(processor)->sources, mover_source_arc_iterator, node);
             g_ptr_array_foreach(TO_MOVER(processor)->targets, mover_target_arc_iterator, node);
@@ -143,7 +143,7 @@ void mover_vertex_event_handler(EVENT *event, void *processor)
 
             adjust_point(&point, 4);
 
-            vertix->setPoint(vertix, &point);
+            vertix->operations->setPoint(vertix, &point);
 
         }
 
@@ -163,7 +163,7 @@ void mover_vertex_event_handler(EVENT *event, void *processor)
 
             POINT point;
 
-            vertix->setPoint(vertix, set_point(&point, (long)x, (long)y));
+            vertix->operations->setPoint(vertix, set_point(&point, (long)x, (long)y));
             vertix->artifact.selected = FALSE;
 
         }
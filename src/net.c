@@ -41,23 +41,26 @@
 #include "connector.h"
 #include "mover.h"
 #include "selector.h"
+#include "grid.h"
+#include "extent.h"
+#include "pool.h"
+#include "model.h"
+#include "simulator.h"
+#include "store.h"
+#include "coverability.h"
+#include "invariants.h"
+#include "siphons.h"
 
 #define TO_CONTEXT(context) ((CONTEXT *)(context))
 
 enum ACTION
 {
     DRAW_NODE = 0,
-    UNSELECT_ALL_NODES,
     SELECT_NODE_BY_POINT,
     NODE_AT_POINT,
-    GET_NEXT_NODE_ID,
     DRAW_ARC,
     POINT_IN_ARC,
-    UNSELECT_ALL_ARCS,
     SELECT_ARC_BY_POINT,
-    GET_NODE_VIEW_SIZE,
-    GET_ARC_VIEW_SIZE,
-    GET_ARCS_FOR_NODE,
     SELECT_NODE_BY_BOUNDS,
     GET_SELECTED_NODES,
     GET_SELECTED_ARCS,
@@ -87,20 +90,6 @@ typedef struct _CONTEXT
 
         } point_context;
         struct
-        {
-            int id;
-        } id_context;
-        struct
-        {
-            SIZE size;
-        } view_size;
-        struct
-        {
-            NODE *node;
-            GPtrArray *sources;
-            GPtrArray *targets;
-        } node_arcs;
-        struct
         {
             GPtrArray *nodes;
             BOUNDS bounds;
@@ -123,39 +112,91 @@ GPtrArray *nodes = NULL;
 
 void (*actions[EOF_ACTIONS])(gpointer artifact, gpointer context);
 
+/**
+ * @brief select a node and add it to the net's selection
+ *
+ */
+void net_select_node(NET *net, NODE *node)
+{
+
+    node->artifact.selected = TRUE;
+
+    g_hash_table_add(net->selectedNodes, node);
+}
+
+/**
+ * @brief select an arc and add it to the net's selection
+ *
+ */
+void net_select_arc(NET *net, ARC *arc)
+{
+
+    arc->artifact.selected = TRUE;
+
+    g_hash_table_add(net->selectedArcs, arc);
+}
+
+/**
+ * @brief unselect the selected nodes and arcs and clear the net's selection
+ *
+ */
+void net_unselect_all(NET *net)
+{
+    GHashTableIter iterator;
+    gpointer artifact;
+
+    g_hash_table_iter_init(&iterator, net->selectedNodes);
+
+    while (g_hash_table_iter_next(&iterator, &artifact, NULL))
+    {
+        TO_NODE(artifact)->artifact.selected = FALSE;
+    }
+
+    g_hash_table_iter_init(&iterator, net->selectedArcs);
+
+    while (g_hash_table_iter_next(&iterator, &artifact, NULL))
+    {
+        TO_ARC(artifact)->artifact.selected = FALSE;
+    }
+
+    g_hash_table_remove_all(net->selectedNodes);
+    g_hash_table_remove_all(net->selectedArcs);
+}
+
 /**
  * @brief select the node at a given point
  *
  */
 void net_select_node_by_point(gpointer artifact, gpointer context)
 {
-    if (TO_NODE(artifact)->isNodeAtPoint(TO_NODE(artifact), &TO_CONTEXT(context)->point_context.point))
+    if (TO_NODE(artifact)->operations->isNodeAtPoint(TO_NODE(artifact), &TO_CONTEXT(context)->point_context.point))
     {
-        TO_NODE(artifact)->artifact.selected = TRUE;
+        net_select_node(TO_NODE(artifact)->net, TO_NODE(artifact));
         g_ptr_array_add(TO_CONTEXT(context)->point_context.nodes, artifact);
         TO_CONTEXT(context)->point_context.found += 1;
     }
-    else
-    {
-        TO_NODE(artifact)->artifact.selected = FALSE;
-    }
 }
 
 /**
- * @brief select the arc at a given point
+ * @brief select the arc at a given point (the artifact is a vertex - the start of the arc's segment)
  *
  */
 void net_select_arc_by_point(gpointer artifact, gpointer context)
 {
+    ARC *arc = TO_VERTEX(artifact)->arc;
+    guint index;
 
-    if (TO_ARC(artifact)->isArcAtPoint(TO_ARC(artifact), &TO_CONTEXT(context)->point_context.point))
+    if (arc->artifact.selected || !g_ptr_array_find(arc->vertices, artifact, &index) ||
+        index + 1 >= arc->vertices->len)
     {
-        g_ptr_array_add(TO_CONTEXT(context)->point_context.arcs, artifact);
-        TO_ARC(artifact)->artifact.selected = TRUE;
+        return;
     }
-    else
+
+    if (point_on_line(&TO_VERTEX(artifact)->point, &TO_VERTEX(g_ptr_array_index(arc->vertices, index + 1))->point,
+                      &TO_CONTEXT(context)->point_context.point, 4))
     {
-        TO_ARC(artifact)->artifact.selected = FALSE;
+        g_ptr_array_add(TO_CONTEXT(context)->point_context.arcs, arc);
+        net_select_arc(arc->net, arc);
     }
 }
 
@@ -193,187 +234,202 @@ void net_draw_node(gpointer artifact, gpointer context)
 }
 
 /**
- * @brief unselect all nodes
+ * @brief select the node by bounding rectangle
  *
  */
-void net_unselect_all_nodes(gpointer artifact, gpointer context)
+void net_select_node_by_bounds(gpointer artifact, gpointer context)
 {
+    if (point_in_bounds(&TO_NODE(artifact)->position, &TO_CONTEXT(context)->node_selector.bounds))
+    {
+
+        g_ptr_array_add(TO_CONTEXT(context)->node_selector.nodes, TO_NODE(artifact));
 
-    TO_NODE(artifact)->artifact.selected = FALSE;
+        net_select_node(TO_NODE(artifact)->net, TO_NODE(artifact));
+    }
 }
 
 /**
- * @brief unselect all arcs
+ * @brief return all selected nodes into an array
  *
  */
-void net_unselect_all_arcs(gpointer artifact, gpointer context)
+void net_get_selected_nodes(gpointer artifact, gpointer context)
 {
 
-    TO_ARC(artifact)->artifact.selected = FALSE;
+    if (TO_NODE(artifact)->artifact.selected == TRUE)
+    {
+        g_ptr_array_add(TO_NODE(artifact)->operations->isPlace(TO_NODE(artifact)) ? 
+                        TO_CONTEXT(context)->node_arc_selector.container->places : 
+                        TO_CONTEXT(context)->node_arc_selector.container->transitions,  
+                        TO_NODE(artifact));
+
+        g_ptr_array_extend(TO_CONTEXT(context)->node_arc_selector.container->sources,
+                           TO_NODE(artifact)->outputs, NULL, NULL);
+        g_ptr_array_extend(TO_CONTEXT(context)->node_arc_selector.container->targets,
+                           TO_NODE(artifact)->inputs, NULL, NULL);
+    }
 }
 
 /**
- * @brief get the next node identifier
+ * @brief return all selected arcs into an array
  *
  */
-void net_get_next_node_id(gpointer artifact, gpointer context)
+void net_get_selected_arcs(gpointer artifact, gpointer context)
 {
 
-    TO_CONTEXT(context)->id_context.id = TO_NODE(artifact)->id >= TO_CONTEXT(context)->id_context.id
-                                             ? TO_NODE(artifact)->id + 1
-                                             : TO_CONTEXT(context)->id_context.id;
+    if (TO_ARC(artifact)->artifact.selected == TRUE)
+    {
+        g_ptr_array_add(TO_CONTEXT(context)->arc_selector.arcs, TO_ARC(artifact));
+    }
 }
 
 /**
- * @brief recalculate the view size considering nodes
+ * @brief find a node (place or transition)
  *
  */
-void net_get_node_view_size(gpointer artifact, gpointer context)
+gboolean net_node_find_by_point(gconstpointer node, gconstpointer point)
 {
-    double w = TO_NODE(artifact)->bounds.point.x + TO_NODE(artifact)->bounds.size.w;
-    double h = TO_NODE(artifact)->bounds.point.y + TO_NODE(artifact)->bounds.size.h;
 
-    if (TO_CONTEXT(context)->view_size.size.w < w)
-    {
-        TO_CONTEXT(context)->view_size.size.w = w;
-    }
-    if (TO_CONTEXT(context)->view_size.size.h < h)
-    {
-        TO_CONTEXT(context)->view_size.size.h = h;
-    }
+    return TO_NODE(node)->operations->isNodeAtPoint(TO_NODE(node), TO_POINT(point));
 }
 
 /**
- * @brief recalculate the view size considering arcs
+ * @brief find the arc by a given point
  *
  */
-void net_get_arc_view_size(gpointer artifact, gpointer context)
+gboolean net_arc_find_by_point(gconstpointer node, gconstpointer point)
 {
-    POINT point;
-
-    TO_ARC(artifact)->getPathBounds(TO_ARC(artifact), &point);
 
-    if (TO_CONTEXT(context)->view_size.size.w < point.x)
-    {
-        TO_CONTEXT(context)->view_size.size.w = point.x;
-    }
-    if (TO_CONTEXT(context)->view_size.size.h < point.y)
-    {
-        TO_CONTEXT(context)->view_size.size.h = point.y;
-    }
+    return TO_NODE(node)->operations->isNodeAtPoint(TO_NODE(node), TO_POINT(point));
 }
 
 /**
- * @brief get the arcs for a node
+ * @brief a transition has become enabled or disabled in the simulation
  *
  */
-void net_get_arcs_for_node(gpointer artifact, gpointer context)
+void net_simulation_listener(void *data, int transition, int enabled)
 {
-    if (TO_ARC(artifact)->source == TO_CONTEXT(context)->node_arcs.node)
-    {
-        g_ptr_array_add(TO_CONTEXT(context)->node_arcs.sources, TO_ARC(artifact));
-    }
+    NODE *node = g_ptr_array_index(TO_NET(data)->transitions, transition);
 
-    if (TO_ARC(artifact)->target == TO_CONTEXT(context)->node_arcs.node)
-    {
-        g_ptr_array_add(TO_CONTEXT(context)->node_arcs.targets, TO_ARC(artifact));
-    }
+    node->artifact.enabled = enabled;
 }
 
 /**
- * @brief select the node by bounding rectangle
+ * @brief show the simulation's marking - the place's 'occupied' tokens
  *
  */
-void net_select_node_by_bounds(gpointer artifact, gpointer context)
+void net_show_marking(NET *net)
 {
-    if (point_in_bounds(&TO_NODE(artifact)->position, &TO_CONTEXT(context)->node_selector.bounds))
-    {
 
-        g_ptr_array_add(TO_CONTEXT(context)->node_selector.nodes, TO_NODE(artifact));
-    }
+    for (int iPlace = 0; iPlace < net->places->len; iPlace++)
     {
-        TO_NODE(artifact)->artifact.selected = FALSE;
+        NODE *place = g_ptr_array_index(net->places, iPlace);
+
+        place->place.occupied = net->simulator->marking[place->slot];
     }
 }
 
 /**
- * @brief return all selected nodes into an array
+ * @brief set the state of every node - the nodes are ACTIVE while simulating
  *
  */
-void net_get_selected_nodes(gpointer artifact, gpointer context)
+void net_set_state(NET *net, enum STATE state)
 {
 
-    if (TO_NODE(artifact)->artifact.selected == TRUE)
+    for (int iNode = 0; iNode < net->places->len; iNode++)
     {
-        g_ptr_array_add(TO_NODE(artifact)->isPlace(TO_NODE(artifact)) ? 
-                        TO_CONTEXT(context)->node_arc_selector.container->places : 
-                        TO_CONTEXT(context)->node_arc_selector.container->transitions,  
-                        TO_NODE(artifact));
-        {
-            CONTEXT selector;
+        NODE *node = g_ptr_array_index(net->places, iNode);
 
-            selector.action = GET_ARCS_FOR_NODE;
-            selector.node_arcs.node = TO_NODE(artifact);
-            selector.node_arcs.sources = TO_CONTEXT(context)->node_arc_selector.container->sources;
-            selector.node_arcs.targets = TO_CONTEXT(context)->node_arc_selector.container->targets;
+        node->artifact.state = state;
+        node->artifact.enabled = FALSE;
+    }
 
-            g_ptr_array_foreach(TO_CONTEXT(context)->node_arc_selector.net->arcs,
-                                actions[GET_ARCS_FOR_NODE], &selector);
-        }
+    for (int iNode = 0; iNode < net->transitions->len; iNode++)
+    {
+        NODE *node = g_ptr_array_index(net->transitions, iNode);
+
+        node->artifact.state = state;
+        node->artifact.enabled = FALSE;
     }
 }
 
 /**
- * @brief return all selected arcs into an array
+ * @brief stop the simulation (if any) and restore the editing state
  *
  */
-void net_get_selected_arcs(gpointer artifact, gpointer context)
+void net_stop_simulation(NET *net)
 {
 
-    if (TO_ARC(artifact)->artifact.selected == TRUE)
+    if (net->simulator != NULL)
     {
-        g_ptr_array_add(TO_CONTEXT(context)->arc_selector.arcs, TO_ARC(artifact));
+        net->simulator->release(net->simulator);
+        net->model->release(net->model);
+
+        net->simulator = NULL;
+        net->model = NULL;
+
+        net_set_state(net, INACTIVE);
     }
 }
 
 /**
- * @brief find a node (place or transition)
+ * @brief release the invariants (if any) and the net they were computed from
  *
  */
-gboolean net_node_find_by_id(gconstpointer node, gconstpointer id)
+void net_stop_invariants(NET *net)
 {
 
-    return TO_NODE(node)->id == *(int *)id;
+    if (net->placeInvariants != NULL)
+    {
+        net->placeInvariants->release(net->placeInvariants);
+        net->transitionInvariants->release(net->transitionInvariants);
+        net->model->release(net->model);
+
+        net->placeInvariants = NULL;
+        net->transitionInvariants = NULL;
+        net->model = NULL;
+    }
 }
 
 /**
- * @brief find a node (place or transition)
+ * @brief release the siphons and traps (if any) and the net they were computed from
  *
  */
-gboolean net_node_find_by_point(gconstpointer node, gconstpointer point)
+void net_stop_siphons(NET *net)
 {
 
-    return TO_NODE(node)->isNodeAtPoint(TO_NODE(node), TO_POINT(point));
+    if (net->siphons != NULL)
+    {
+        net->siphons->release(net->siphons);
+        net->traps->release(net->traps);
+        net->model->release(net->model);
+
+        net->siphons = NULL;
+        net->traps = NULL;
+        net->model = NULL;
+    }
 }
 
 /**
- * @brief find the arc by a given point
+ * @brief returns true if the net is being simulated or analysed (its nodes' slots are in use), false otherwise
  *
  */
-gboolean net_arc_find_by_point(gconstpointer node, gconstpointer point)
+int net_analysing(NET *net)
 {
 
-    return TO_NODE(node)->isNodeAtPoint(TO_NODE(node), TO_POINT(point));
+    return net->simulator != NULL || net->tool == COVER_TOOL || net->tool == INVARIANT_TOOL ||
+           net->tool == SIPHON_TOOL;
 }
 
 /**
- * @brief update the users tool selection
+ * @brief stop the simulation and release the results of every analysis
  *
  */
-void net_tool_event_processor(NET *net, EVENT *event)
+void net_stop_analyses(NET *net)
 {
 
-    net->tool = event->events.button_event.tool;
+    net_stop_simulation(net);
+    net_stop_invariants(net);
+    net_stop_siphons(net);
 }
 
 /**
@@ -382,19 +438,24 @@ void net_tool_event_processor(NET *net, EVENT *event)
  */
 VERTEX *net_find_vertex_by_point(NET *net, POINT *point)
 {
-    for (int iArc = 0; iArc < net->arcs->len; iArc++)
-    {
-        ARC *arc = g_ptr_array_index(net->arcs, iArc);
+    VERTEX *vertex = NULL;
+    GPtrArray *candidates = g_ptr_array_new();
+
+    net->arcGrid->query(net->arcGrid, point, candidates);
 
-        VERTEX *vertex = arc->getVertex(arc, point);
+    for (int iVertex = 0; iVertex < candidates->len && vertex == NULL; iVertex++)
+    {
+        VERTEX *candidate = g_ptr_array_index(candidates, iVertex);
 
-        if (vertex != NULL)
+        if (candidate->position == CONTROL_POSITION && point_on_point(&candidate->point, point, 4))
         {
-            return vertex;
+            vertex = candidate;
         }
     }
 
-    return NULL;
+    g_ptr_array_unref(candidates);
+
+    return vertex;
 }
 
 /**
@@ -404,25 +465,23 @@ VERTEX *net_find_vertex_by_point(NET *net, POINT *point)
 NODE *net_find_node_by_point(NET *net, POINT *point)
 {
     NODE *node = NULL;
-    guint index;
+    GPtrArray *candidates = g_ptr_array_new();
 
-    if (g_ptr_array_find_with_equal_func(net->places,
-                                         point,
-                                         net_node_find_by_point,
-                                         &index))
-    {
-        return g_ptr_array_index(net->places, index);
-    }
+    net->nodeGrid->query(net->nodeGrid, point, candidates);
 
-    if (g_ptr_array_find_with_equal_func(net->transitions,
-                                         point,
-                                         net_node_find_by_point,
-                                         &index))
+    for (int iNode = 0; iNode < candidates->len; iNode++)
     {
-        return g_ptr_array_index(net->transitions, index);
+        NODE *candidate = g_ptr_array_index(candidates, iNode);
+
+        if (net_node_find_by_point(candidate, point) && (node == NULL || candidate->type < node->type))
+        {
+            node = candidate;
+        }
     }
 
-    return NULL;
+    g_ptr_array_unref(candidates);
+
+    return node;
 }
 
 /**
@@ -448,6 +507,40 @@ void net_apply_context_all_arcs(NET *net, CONTEXT *context)
                         actions[context->action], context);
 }
 
+/**
+ * @brief apply a context to the selected transitions and places (the action must not change the selection)
+ *
+ */
+void net_apply_context_selected_nodes(NET *net, CONTEXT *context)
+{
+    GHashTableIter iterator;
+    gpointer artifact;
+
+    g_hash_table_iter_init(&iterator, net->selectedNodes);
+
+    while (g_hash_table_iter_next(&iterator, &artifact, NULL))
+    {
+        actions[context->action](artifact, context);
+    }
+}
+
+/**
+ * @brief apply a context to the selected arcs (the action must not change the selection)
+ *
+ */
+void net_apply_context_selected_arcs(NET *net, CONTEXT *context)
+{
+    GHashTableIter iterator;
+    gpointer artifact;
+
+    g_hash_table_iter_init(&iterator, net->selectedArcs);
+
+    while (g_hash_table_iter_next(&iterator, &artifact, NULL))
+    {
+        actions[context->action](artifact, context);
+    }
+}
+
 /**
  * @brief apply an action on all the nodes (transitions and places)
  *
@@ -514,45 +607,424 @@ void net_draw_event_processor(NET *net, EVENT *event)
 void net_reset(NET *net)
 {
 
-    for (int iNode = 0; net->places->len != 0;)
+    net_stop_analyses(net);
+
+    for (int iNode = 0; iNode < net->places->len; iNode++)
     {
         NODE *node = g_ptr_array_index(net->places, iNode);
 
-        g_ptr_array_remove(net->places, node);
+        node->operations->release(node);
+    }
+
+    for (int iNode = 0; iNode < net->transitions->len; iNode++)
+    {
+        NODE *node = g_ptr_array_index(net->transitions, iNode);
+
+        node->operations->release(node);
+    }
+
+    for (int iArc = 0; iArc < net->arcs->len; iArc++)
+    {
+        ARC *arc = g_ptr_array_index(net->arcs, iArc);
+
+        arc->operations->release(arc);
+    }
+
+    g_ptr_array_set_size(net->places, 0);
+    g_ptr_array_set_size(net->transitions, 0);
+    g_ptr_array_set_size(net->arcs, 0);
+
+    net->nodePool->clear(net->nodePool);
+    net->arcPool->clear(net->arcPool);
+    net->vertexPool->clear(net->vertexPool);
+
+    net->nodeGrid->clear(net->nodeGrid);
+    net->arcGrid->clear(net->arcGrid);
+
+    g_hash_table_remove_all(net->references);
+
+    g_hash_table_remove_all(net->selectedNodes);
+    g_hash_table_remove_all(net->selectedArcs);
+
+    net->extent->clear(net->extent);
+
+    for (int iType = 0; iType < END_NODE_TYPES; iType++)
+    {
+        net->identifiers[iType] = 0;
+
+        g_array_set_size(net->released[iType], 0);
+    }
+}
+
+/**
+ * @brief activate the net
+ *
+ */
+void net_activate(NET *net, enum NOTIFICATION notification, int status)
+{
+    EVENT *activate = create_event(notification, status);
+
+    net->controller->send(net->controller, activate);
+
+    activate->release(activate);
+}
+
+/**
+ * @brief tell the user something (in a dialog)
+ *
+ */
+void net_inform(NET *net, char *message)
+{
+    EVENT *inform = create_event(SHOW_MESSAGE, message);
+
+    net->controller->send(net->controller, inform);
+
+    inform->release(inform);
+}
+
+/**
+ * @brief (re)start the simulation from the initial marking if the 'simulate' tool is selected
+ *
+ */
+void net_simulate(NET *net)
+{
+
+    net_stop_simulation(net);
+
+    if (net->tool == SIMULATE_TOOL)
+    {
+        net_unselect_all(net);
+
+        net->controller->message(net->controller, CLEAR_EDITOR);
+
+        net_activate(net, ACTIVATE_DELETE, FALSE);
+
+        net_set_state(net, ACTIVE);
+
+        net->model = net->compile(net);
+        net->simulator = create_simulator(net->model);
+
+        net->simulator->listen(net->simulator, net_simulation_listener, net);
+
+        net_show_marking(net);
+    }
+
+    net->redraw(net);
+}
+
+/**
+ * @brief clear the highlights of the places and transitions
+ *
+ */
+void net_clear_highlights(NET *net)
+{
+
+    for (int iPlace = 0; iPlace < net->places->len; iPlace++)
+    {
+        NODE *place = g_ptr_array_index(net->places, iPlace);
+
+        place->artifact.highlighted = FALSE;
+    }
+
+    for (int iTransition = 0; iTransition < net->transitions->len; iTransition++)
+    {
+        NODE *transition = g_ptr_array_index(net->transitions, iTransition);
+
+        transition->artifact.highlighted = FALSE;
+    }
+}
+
+/**
+ * @brief highlight the unbounded places (found by the net's coverability tree) if the 'coverability' tool is
+ *        selected, otherwise clear the highlights - the caller redraws the net
+ *
+ */
+void net_cover(NET *net)
+{
+
+    net_clear_highlights(net);
+
+    if (net->tool == COVER_TOOL)
+    {
+        MODEL *model = NULL;
+        COVERABILITY *coverability = NULL;
+
+        net_unselect_all(net);
+
+        net->controller->message(net->controller, CLEAR_EDITOR);
+
+        net_activate(net, ACTIVATE_DELETE, FALSE);
+
+        model = net->compile(net);
+        coverability = create_coverability(model);
+
+        // an omega place is unbounded even if the tree is incomplete
+        coverability->build(coverability, NET_COVERABILITY_LIMIT);
+
+        for (int iPlace = 0; iPlace < net->places->len; iPlace++)
+        {
+            NODE *place = g_ptr_array_index(net->places, iPlace);
+
+            place->artifact.highlighted = coverability->unbounded[place->slot];
+        }
+
+        if (!coverability->complete)
+        {
+            net_inform(net, "The coverability tree reached its limit - the places shown are unbounded, "
+                            "but other places may be unbounded too");
+        }
+
+        coverability->release(coverability);
+        model->release(model);
+    }
+}
+
+/**
+ * @brief highlight the support of the invariant selected - the places of a P-invariant or the transitions of a
+ *        T-invariant
+ *
+ */
+void net_show_invariant(NET *net)
+{
+    INVARIANTS *invariants = net->placeInvariants;
+    GPtrArray *nodes = net->places;
+    int invariant = net->invariant;
+    int *support = NULL;
+
+    net_clear_highlights(net);
+
+    if (invariant >= invariants->count)
+    {
+        invariant -= invariants->count;
+        invariants = net->transitionInvariants;
+        nodes = net->transitions;
+    }
+
+    if (invariant >= invariants->count)
+    {
+        return;
+    }
+
+    support = calloc(invariants->nodes + 1, sizeof(int));
+
+    for (int iMember = invariants->start[invariant]; iMember < invariants->start[invariant + 1]; iMember++)
+    {
+        support[invariants->members[iMember]] = TRUE;
+    }
+
+    for (int iNode = 0; iNode < nodes->len; iNode++)
+    {
+        NODE *node = g_ptr_array_index(nodes, iNode);
 
-        node->release(node);
+        node->artifact.highlighted = support[node->slot];
     }
 
-    for (int iNode = 0; net->transitions->len != 0;)
+    free(support);
+}
+
+/**
+ * @brief compute the net's P- and T-invariants and highlight the first if the 'invariants' tool is selected - the
+ *        caller redraws the net
+ *
+ */
+void net_invariants(NET *net)
+{
+
+    net_stop_invariants(net);
+
+    if (net->tool == INVARIANT_TOOL)
+    {
+        net_unselect_all(net);
+
+        net->controller->message(net->controller, CLEAR_EDITOR);
+
+        net_activate(net, ACTIVATE_DELETE, FALSE);
+
+        net->model = net->compile(net);
+        net->placeInvariants = create_invariants(net->model, PLACE_INVARIANTS);
+        net->transitionInvariants = create_invariants(net->model, TRANSITION_INVARIANTS);
+
+        // the invariants found are minimal even if the computation stopped early
+        net->placeInvariants->compute(net->placeInvariants, NET_INVARIANT_LIMIT);
+        net->transitionInvariants->compute(net->transitionInvariants, NET_INVARIANT_LIMIT);
+
+        net->invariant = 0;
+
+        net_show_invariant(net);
+
+        if (!net->placeInvariants->complete || !net->transitionInvariants->complete)
+        {
+            net_inform(net, "The invariants computation reached its limit - the invariants shown are minimal, "
+                            "but not every minimal invariant was found");
+        }
+    }
+}
+
+/**
+ * @brief highlight the next invariant's support (after the last the first is highlighted again)
+ *
+ */
+void net_next_invariant(NET *net)
+{
+    int count = net->placeInvariants->count + net->transitionInvariants->count;
+
+    if (count > 0)
+    {
+        net->invariant = (net->invariant + 1) % count;
+
+        net_show_invariant(net);
+
+        net->redraw(net);
+    }
+}
+
+/**
+ * @brief highlight the places of the siphon (or trap) selected
+ *
+ */
+void net_show_siphon(NET *net)
+{
+    SIPHONS *siphons = net->siphons;
+    int siphon = net->siphon;
+    int *members = NULL;
+
+    net_clear_highlights(net);
+
+    if (siphon >= siphons->count)
+    {
+        siphon -= siphons->count;
+        siphons = net->traps;
+    }
+
+    if (siphon >= siphons->count)
+    {
+        return;
+    }
+
+    members = calloc(net->model->places + 1, sizeof(int));
+
+    for (int iMember = siphons->start[siphon]; iMember < siphons->start[siphon + 1]; iMember++)
+    {
+        members[siphons->members[iMember]] = TRUE;
+    }
+
+    for (int iPlace = 0; iPlace < net->places->len; iPlace++)
+    {
+        NODE *place = g_ptr_array_index(net->places, iPlace);
+
+        place->artifact.highlighted = members[place->slot];
+    }
+
+    free(members);
+}
+
+/**
+ * @brief find the net's minimal siphons and traps and highlight a siphon if the 'siphons' tool is selected - the first
+ *        siphon holding no marked trap (one that could be emptied), otherwise the first siphon; the caller redraws the
+ *        net
+ *
+ */
+void net_siphons(NET *net)
+{
+
+    net_stop_siphons(net);
+
+    if (net->tool == SIPHON_TOOL)
+    {
+        net_unselect_all(net);
+
+        net->controller->message(net->controller, CLEAR_EDITOR);
+
+        net_activate(net, ACTIVATE_DELETE, FALSE);
+
+        net->model = net->compile(net);
+        net->siphons = create_siphons(net->model, SIPHON_SETS);
+        net->traps = create_siphons(net->model, TRAP_SETS);
+
+        // the sets found are minimal even if the search stopped early
+        net->siphons->compute(net->siphons, NET_SIPHON_LIMIT);
+        net->traps->compute(net->traps, NET_SIPHON_LIMIT);
+
+        net->siphon = 0;
+
+        while (net->siphon < net->siphons->count && net->siphons->marked[net->siphon])
+        {
+            net->siphon += 1;
+        }
+
+        net->siphon = net->siphon < net->siphons->count ? net->siphon : 0;
+
+        net_show_siphon(net);
+
+        if (!net->siphons->complete || !net->traps->complete)
+        {
+            net_inform(net, "The search for siphons and traps reached its limit - the sets shown are minimal, "
+                            "but not every minimal siphon and trap was found");
+        }
+    }
+}
+
+/**
+ * @brief highlight the next siphon (or trap) - the siphons are followed by the traps and after the last the first is
+ *        highlighted again
+ *
+ */
+void net_next_siphon(NET *net)
+{
+    int count = net->siphons->count + net->traps->count;
+
+    if (count > 0)
+    {
+        net->siphon = (net->siphon + 1) % count;
+
+        net_show_siphon(net);
+
+        net->redraw(net);
+    }
+}
+
+/**
+ * @brief fire the transition at the point (if any and if enabled)
+ *
+ */
+void net_fire_by_point(NET *net, POINT *point)
+{
+    NODE *node = net_find_node_by_point(net, point);
+
+    if (node != NULL && node->type == TRANSITION_NODE && net->simulator->fire(net->simulator, node->slot))
     {
-        NODE *node = g_ptr_array_index(net->transitions, iNode);
-
-        g_ptr_array_remove(net->transitions, node);
+        net_show_marking(net);
 
-        node->release(node);
+        net->redraw(net);
     }
+}
 
-    for (int iArc = 0; net->arcs->len != 0;)
-    {
-        ARC *arc = g_ptr_array_index(net->arcs, iArc);
+/**
+ * @brief stop every analysis and (re)start the one of the tool selected - each analysis releases only its own
+ *        results, so the one started is not released by the others
+ *
+ */
+void net_analyse(NET *net)
+{
 
-        g_ptr_array_remove(net->arcs, g_ptr_array_index(net->arcs, iArc));
+    net_stop_analyses(net);
 
-        arc->release(arc);
-    }
+    net_cover(net);
+    net_invariants(net);
+    net_siphons(net);
+    net_simulate(net);
 }
 
 /**
- * @brief activate the net
+ * @brief update the users tool selection
  *
  */
-void net_activate(NET *net, enum NOTIFICATION notification, int status)
+void net_tool_event_processor(NET *net, EVENT *event)
 {
-    EVENT *activate = create_event(notification, status);
 
-    net->controller->send(net->controller, activate);
+    net->tool = event->events.button_event.tool;
 
-    activate->release(activate);
+    net_analyse(net);
 }
 
 /**
@@ -561,20 +1033,11 @@ void net_activate(NET *net, enum NOTIFICATION notification, int status)
  */
 void net_resize(NET *net)
 {
-    CONTEXT context;
+    SIZE size;
 
-    context.action = GET_NODE_VIEW_SIZE;
-    context.view_size.size.w = 0;
-    context.view_size.size.h = 0;
+    net->extent->get(net->extent, &size);
 
-    net_apply_context_all_nodes(net, &context);
-
-    context.action = GET_ARC_VIEW_SIZE;
-
-    g_ptr_array_foreach(net->arcs,
-                        actions[context.action], &context);
-
-    EVENT *resize = create_event(SET_VIEW_SIZE, &context.view_size.size);
+    EVENT *resize = create_event(SET_VIEW_SIZE, &size);
 
     net->controller->send(net->controller, resize);
 
@@ -588,22 +1051,48 @@ void net_resize(NET *net)
 void net_select(NET *net, BOUNDS *bounds, GPtrArray *nodes)
 {
 
-    net_apply_action_all_arcs(net, UNSELECT_ALL_ARCS);
+    net_unselect_all(net);
 
     {
         CONTEXT context;
+        GPtrArray *candidates = g_ptr_array_new();
 
         context.action = SELECT_NODE_BY_BOUNDS;
         context.node_selector.nodes = nodes;
 
         set_bounds(bounds, &context.node_selector.bounds);
 
-        g_ptr_array_foreach(net->places,
-                            actions[context.action], &context);
+        net->nodeGrid->search(net->nodeGrid, bounds, candidates);
 
-        g_ptr_array_foreach(net->transitions,
-                            actions[context.action], &context);
+        g_ptr_array_foreach(candidates, actions[context.action], &context);
+
+        g_ptr_array_unref(candidates);
+    }
+}
+
+/**
+ * @brief allocate an unused node identifier - a released identifier is reused when available
+ *
+ */
+int net_allocate_id(NET *net, enum TYPE type)
+{
+    char reference[36];
+
+    while (net->released[type]->len > 0)
+    {
+        int id = g_array_index(net->released[type], int, net->released[type]->len - 1);
+
+        g_array_set_size(net->released[type], net->released[type]->len - 1);
+
+        snprintf(reference, sizeof(reference), "%d-%d", type, id);
+
+        if (!g_hash_table_contains(net->references, reference))
+        {
+            return id;
+        }
     }
+
+    return net->identifiers[type]++;
 }
 
 /**
@@ -617,8 +1106,36 @@ void net_select_node_processor(NET *net, EVENT *event)
 
     set_point(&point, event->events.create_node.x, event->events.create_node.y);
 
-    net_apply_action_all_nodes(net, UNSELECT_ALL_NODES);
-    net_apply_action_all_arcs(net, UNSELECT_ALL_ARCS);
+    if (net->simulator != NULL)
+    {
+        net_fire_by_point(net, &point);
+
+        return;
+    }
+
+    // the net is not edited while its unbounded places are highlighted
+    if (net->tool == COVER_TOOL)
+    {
+        return;
+    }
+
+    // a click shows the next invariant
+    if (net->tool == INVARIANT_TOOL)
+    {
+        net_next_invariant(net);
+
+        return;
+    }
+
+    // a click shows the next siphon (or trap)
+    if (net->tool == SIPHON_TOOL)
+    {
+        net_next_siphon(net);
+
+        return;
+    }
+
+    net_unselect_all(net);
 
     if (net->tool == SELECT_TOOL)
     {
@@ -631,7 +1148,15 @@ void net_select_node_processor(NET *net, EVENT *event)
         context.point_context.point.x = event->events.create_node.x;
         context.point_context.point.y = event->events.create_node.y;
 
-        net_apply_context_all_nodes(net, &context);
+        {
+            GPtrArray *candidates = g_ptr_array_new();
+
+            net->nodeGrid->query(net->nodeGrid, &point, candidates);
+
+            g_ptr_array_foreach(candidates, actions[context.action], &context);
+
+            g_ptr_array_unref(candidates);
+        }
 
         if (context.point_context.found == 1)
         {
@@ -642,7 +1167,7 @@ void net_select_node_processor(NET *net, EVENT *event)
             for (int iNode = 0; iNode < context.point_context.nodes->len; iNode++)
             {
                 NODE *node = g_ptr_array_index(context.point_context.nodes, iNode);
-                node->edit(node, editor);
+                node->operations->edit(node, editor);
             }
         }
         else if (!context.point_context.found)
@@ -652,7 +1177,15 @@ void net_select_node_processor(NET *net, EVENT *event)
             context.action = SELECT_ARC_BY_POINT;
             context.point_context.found = 0;
             context.point_context.arcs = g_ptr_array_new();
-            net_apply_context_all_arcs(net, &context);
+            {
+                GPtrArray *candidates = g_ptr_array_new();
+
+                net->arcGrid->query(net->arcGrid, &point, candidates);
+
+                g_ptr_array_foreach(candidates, actions[context.action], &context);
+
+                g_ptr_array_unref(candidates);
+            }
             {
                 EDITOR *editor = net->controller->edit(net->controller);
                 int iArc = 0;
@@ -661,7 +1194,7 @@ void net_select_node_processor(NET *net, EVENT *event)
                 {
                     ARC *arc = g_ptr_array_index(context.point_context.arcs, iArc);
 
-                    arc->edit(arc, editor);
+                    arc->operations->edit(arc, editor);
                 }
             }
 
@@ -673,7 +1206,7 @@ void net_select_node_processor(NET *net, EVENT *event)
                 {
                     ARC *arc = g_ptr_array_index(context.point_context.arcs, iArc);
 
-                    arc->setVertex(arc, &point);
+                    arc->operations->setVertex(arc, &point);
                 }
             }
         }
@@ -692,15 +1225,10 @@ void net_select_node_processor(NET *net, EVENT *event)
 
             CONTEXT context;
 
-            context.action = GET_NEXT_NODE_ID;
-            context.id_context.id = 0;
-
             node = create_node(net->tool == PLACE_TOOL ? PLACE_NODE : TRANSITION_NODE, net);
 
-            g_ptr_array_foreach((net->tool == PLACE_TOOL) ? net->places : net->transitions,
-                                actions[context.action], &context);
-            node->id = context.id_context.id;
-            node->setDefaultName(node);
+            node->id = net_allocate_id(net, node->type);
+            node->operations->setDefaultName(node);
 
             POINT point;
 
@@ -708,15 +1236,15 @@ void net_select_node_processor(NET *net, EVENT *event)
 
             adjust_point(&point, 8);
 
-            node->setPosition(node, point.x, point.y);
+            node->operations->setPosition(node, point.x, point.y);
 
             context.action = DRAW_NODE;
 
             EDITOR *editor = net->controller->edit(net->controller);
 
-            node->edit(node, editor);
+            node->operations->edit(node, editor);
 
-            g_ptr_array_add(node->type == PLACE_NODE ? net->places : net->transitions, node);
+            net->addNode(net, node);
 
             net->resize(net);
 
@@ -734,9 +1262,9 @@ void net_select_node_processor(NET *net, EVENT *event)
 
             EDITOR *editor = net->controller->edit(net->controller);
 
-            node->edit(node, editor);
+            node->operations->edit(node, editor);
 
-            node->artifact.selected = TRUE;
+            net_select_node(net, node);
         }
 
         net_activate(net, ACTIVATE_DELETE, TRUE);
@@ -757,6 +1285,13 @@ void net_start_drag_processor(NET *net, EVENT *event)
     set_point(&point, event->events.start_drag_event.x, event->events.start_drag_event.y);
 
     NODE *node = net_find_node_by_point(net, &point);
+    int analysing = net_analysing(net);
+
+    // while the net is analysed a node or vertex may be moved, but nothing is selected
+    if (analysing && event->events.start_drag_event.mode != MOVE)
+    {
+        return;
+    }
 
     if (event->events.start_drag_event.mode == CONNECT && node != NULL)
     {
@@ -766,26 +1301,20 @@ void net_start_drag_processor(NET *net, EVENT *event)
     {
         MOVER *mover = create_mover(MOVING_NODE, net->controller, &point, net);
 
-        CONTEXT context;
-
-        context.action = GET_ARCS_FOR_NODE;
-        context.node_arcs.node = node;
-
         mover->addNode(mover, node);
-        context.node_arcs.sources = mover->sources;
-        context.node_arcs.targets = mover->targets;
 
-        net_apply_context_all_arcs(net, &context);
+        g_ptr_array_extend(mover->sources, node->outputs, NULL, NULL);
+        g_ptr_array_extend(mover->targets, node->inputs, NULL, NULL);
     }
     else if (node == NULL)
     {
         VERTEX *vertex = net_find_vertex_by_point(net, &point);
 
-        if (vertex == NULL)
+        if (vertex == NULL && !analysing)
         {
             create_selector(net->controller, &point, net);
         }
-        else
+        else if (vertex != NULL)
         {
 
             MOVER *mover = create_mover(MOVING_VERTEX, net->controller, &point, net);
@@ -807,8 +1336,7 @@ void net_connect_processor(NET *net, EVENT *event)
 
     if (target != NULL && event->events.connect_event.source->type != target->type)
     {
-        net_apply_action_all_nodes(net, UNSELECT_ALL_NODES);
-        net_apply_action_all_arcs(net, UNSELECT_ALL_ARCS);
+        net_unselect_all(net);
 
         ARC *arc = create_arc(net, event->events.connect_event.source, target);
 
@@ -818,9 +1346,9 @@ void net_connect_processor(NET *net, EVENT *event)
 
         EDITOR *editor = net->controller->edit(net->controller);
 
-        arc->edit(arc, editor);
+        arc->operations->edit(arc, editor);
 
-        g_ptr_array_add(net->arcs, arc);
+        net->addArc(net, arc);
 
         net->controller->mode = FINALISE;
 
@@ -830,11 +1358,99 @@ void net_connect_processor(NET *net, EVENT *event)
 }
 
 /**
- * @brief delete all the selected nodes
+ * @brief remove a node from the net (the node is not released)
+ *
+ */
+void net_remove_node(NET *net, NODE *node)
+{
+    GPtrArray *nodes = node->type == PLACE_NODE ? net->places : net->transitions;
+    char reference[36];
+
+    if (node->slot == NO_SLOT || node->slot >= nodes->len || g_ptr_array_index(nodes, node->slot) != node)
+    {
+        return;
+    }
+
+    g_ptr_array_remove_index_fast(nodes, node->slot);
+
+    if (node->slot < nodes->len)
+    {
+        TO_NODE(g_ptr_array_index(nodes, node->slot))->slot = node->slot;
+    }
+
+    node->slot = NO_SLOT;
+
+    node->operations->generate(node, sizeof(reference), reference);
+
+    if (g_hash_table_lookup(net->references, reference) == node)
+    {
+        g_hash_table_remove(net->references, reference);
+    }
+
+    g_array_append_val(net->released[node->type], node->id);
+
+    net->nodeGrid->remove(net->nodeGrid, node);
+
+    g_hash_table_remove(net->selectedNodes, node);
+
+    net->extent->remove(net->extent, node->bounds.point.x + node->bounds.size.w,
+                        node->bounds.point.y + node->bounds.size.h);
+}
+
+/**
+ * @brief remove an arc from the net (the arc is not released)
+ *
+ */
+void net_remove_arc(NET *net, ARC *arc)
+{
+
+    if (arc->slot == NO_SLOT || arc->slot >= net->arcs->len || g_ptr_array_index(net->arcs, arc->slot) != arc)
+    {
+        return;
+    }
+
+    g_ptr_array_remove_index_fast(net->arcs, arc->slot);
+
+    if (arc->slot < net->arcs->len)
+    {
+        TO_ARC(g_ptr_array_index(net->arcs, arc->slot))->slot = arc->slot;
+    }
+
+    arc->slot = NO_SLOT;
+
+    g_hash_table_remove(net->selectedArcs, arc);
+
+    if (arc->source != NULL)
+    {
+        g_ptr_array_remove_fast(arc->source->outputs, arc);
+    }
+
+    if (arc->target != NULL)
+    {
+        g_ptr_array_remove_fast(arc->target->inputs, arc);
+    }
+
+    for (int iVertex = 0; iVertex < arc->vertices->len; iVertex++)
+    {
+        VERTEX *vertex = g_ptr_array_index(arc->vertices, iVertex);
+
+        net->arcGrid->remove(net->arcGrid, vertex);
+
+        net->extent->remove(net->extent, vertex->point.x, vertex->point.y);
+    }
+}
+
+/**
+ * @brief delete all the selected nodes - removing a node moves another into its slot, so an analysis under way is
+ *        stopped first and restarted on the edited net
  *
  */
 void net_delete_selected(NET *net, EVENT *event)
 {
+    int analysing = net_analysing(net);
+
+    net_stop_analyses(net);
+
     {
         CONTEXT context;
         CONTAINER * container = create_container();
@@ -843,34 +1459,33 @@ void net_delete_selected(NET *net, EVENT *event)
         context.node_arc_selector.net = net;
 
         context.node_arc_selector.container = container;
-        ;
 
-        net_apply_context_all_nodes(net, &context);
+        net_apply_context_selected_nodes(net, &context);
 
         for (int iPlace = 0; iPlace < container->places->len; iPlace++)
         {
             NODE *place = g_ptr_array_index(container->places, iPlace);
 
-            g_ptr_array_remove(net->places, place);
+            net_remove_node(net, place);
         }
 
         for (int iTransition = 0; iTransition < container->transitions->len; iTransition++)
         {
             NODE *transition = g_ptr_array_index(container->transitions, iTransition);
 
-            g_ptr_array_remove(net->transitions, transition);
+            net_remove_node(net, transition);
         }
 
         for (int iArc = 0; iArc < container->sources->len; iArc++)
         {
 
-            g_ptr_array_remove(net->arcs, g_ptr_array_index(container->sources, iArc));
+            net_remove_arc(net, g_ptr_array_index(container->sources, iArc));
         }
 
         for (int iArc = 0; iArc < container->targets->len; iArc++)
         {
 
-            g_ptr_array_remove(net->arcs, g_ptr_array_index(container->targets, iArc));
+            net_remove_arc(net, g_ptr_array_index(container->targets, iArc));
         }
     }
     {
@@ -879,11 +1494,11 @@ void net_delete_selected(NET *net, EVENT *event)
         context.action = GET_SELECTED_ARCS;
         context.arc_selector.arcs = g_ptr_array_new();
 
-        g_ptr_array_foreach(net->arcs, actions[context.action], &context);
+        net_apply_context_selected_arcs(net, &context);
 
         for (int iArc = 0; iArc < context.arc_selector.arcs->len; iArc++)
         {
-            g_ptr_array_remove(net->arcs, g_ptr_array_index(context.arc_selector.arcs, iArc));
+            net_remove_arc(net, g_ptr_array_index(context.arc_selector.arcs, iArc));
         }
     }
 
@@ -892,6 +1507,12 @@ void net_delete_selected(NET *net, EVENT *event)
     net_activate(net, ACTIVATE_DELETE, FALSE);
 
     net->resize(net);
+
+    if (analysing)
+    {
+        net_analyse(net);
+    }
+
     net->redraw(net);
 }
 
@@ -909,7 +1530,7 @@ void net_cut(NET *net, EVENT *event)
     context.node_arc_selector.net = net;
     context.node_arc_selector.container = container;
 
-    net_apply_context_all_nodes(net, &context);
+    net_apply_context_selected_nodes(net, &context);
 
     container->clean(container);
     writer->snap(writer, container);
@@ -929,11 +1550,11 @@ void net_read_net(NET *net, EVENT *event)
 
     event->events.read_net.reader->read(event->events.read_net.reader, net);
 
-    net_apply_action_all_nodes(net, UNSELECT_ALL_NODES);
-    net_apply_action_all_arcs(net, UNSELECT_ALL_ARCS);
+    net_unselect_all(net);
 
     net->resize(net);
-    net->redraw(net);
+
+    net_analyse(net);
 
     EVENT *activate = create_event(ACTIVATE_TOOLBAR, TRUE);
 
@@ -952,7 +1573,8 @@ void net_clear(NET *net, EVENT *event)
     net_reset(net);
 
     net->resize(net);
-    net->redraw(net);
+
+    net_analyse(net);
 }
 
 /**
@@ -971,29 +1593,23 @@ void net_write_net(NET *net, EVENT *event)
 }
 
 /**
- * @brief resize the net
+ * @brief find a node by its reference - the format generated by the node ([type]-[id])
  *
  */
 NODE *net_find_node(NET *net, char *buffer)
 {
+    char reference[36];
     int type;
     int id;
 
-    sscanf(buffer, "%d-%d", &type, &id);
-
-    NODE *node = NULL;
-    guint index;
-
-    if (g_ptr_array_find_with_equal_func((type == PLACE_NODE) ? net->places : net->transitions,
-                                         &id,
-                                         net_node_find_by_id,
-                                         &index))
+    if (sscanf(buffer, "%d-%d", &type, &id) != 2)
     {
-
-        return g_ptr_array_index((type == PLACE_NODE) ? net->places : net->transitions, index);
+        return NULL;
     }
 
-    return NULL;
+    snprintf(reference, sizeof(reference), "%d-%d", type, id);
+
+    return g_hash_table_lookup(net->references, reference);
 }
 
 /**
@@ -1035,8 +1651,87 @@ void net_redraw(NET *net)
  */
 void net_add_node(NET *net, NODE *node)
 {
+    GPtrArray *nodes = node->type == PLACE_NODE ? net->places : net->transitions;
+    char reference[36];
+
+    node->slot = nodes->len;
+
+    g_ptr_array_add(nodes, node);
+
+    g_hash_table_replace(net->references,
+                         g_strdup(node->operations->generate(node, sizeof(reference), reference)), node);
+
+    if (node->id >= net->identifiers[node->type])
+    {
+        net->identifiers[node->type] = node->id + 1;
+    }
+
+    net->nodeGrid->insert(net->nodeGrid, node, &node->bounds);
+
+    if (node->artifact.selected)
+    {
+        g_hash_table_add(net->selectedNodes, node);
+    }
+
+    net->extent->add(net->extent, node->bounds.point.x + node->bounds.size.w,
+                     node->bounds.point.y + node->bounds.size.h);
+}
+
+/**
+ * @brief a node has changed position - update the node's index entry and the net's extent
+ *
+ */
+void net_reposition(NET *net, NODE *node, BOUNDS *previous)
+{
+
+    if (net->nodeGrid->move(net->nodeGrid, node, &node->bounds))
+    {
+        net->extent->remove(net->extent, previous->point.x + previous->size.w,
+                            previous->point.y + previous->size.h);
+        net->extent->add(net->extent, node->bounds.point.x + node->bounds.size.w,
+                         node->bounds.point.y + node->bounds.size.h);
+    }
+}
+
+/**
+ * @brief register each of the arc's segments - a segment is keyed on its first vertex
+ *
+ */
+void net_index_arc(NET *net, ARC *arc)
+{
+
+    for (int iVertex = 0; iVertex < arc->vertices->len; iVertex++)
+    {
+        VERTEX *vertex = g_ptr_array_index(arc->vertices, iVertex);
+        VERTEX *next = iVertex + 1 < arc->vertices->len ? g_ptr_array_index(arc->vertices, iVertex + 1) : vertex;
+
+        BOUNDS bounds;
+
+        get_line_bounds(&vertex->point, &next->point, 4, &bounds);
+
+        net->arcGrid->insert(net->arcGrid, vertex, &bounds);
+    }
+}
+
+/**
+ * @brief an arc's vertex has been added or moved - update the arc's index entries and the net's extent
+ *        (if the arc is part of the net)
+ *
+ */
+void net_reshape(NET *net, ARC *arc, VERTEX *vertex, POINT *previous)
+{
+
+    if (arc->vertices->len > 0 && net->arcGrid->contains(net->arcGrid, g_ptr_array_index(arc->vertices, 0)))
+    {
+        net_index_arc(net, arc);
 
-    g_ptr_array_add(node->type == PLACE_NODE ? net->places : net->transitions, node);
+        if (previous != NULL)
+        {
+            net->extent->remove(net->extent, previous->x, previous->y);
+        }
+
+        net->extent->add(net->extent, vertex->point.x, vertex->point.y);
+    }
 }
 
 /**
@@ -1046,7 +1741,80 @@ void net_add_node(NET *net, NODE *node)
 void net_add_arc(NET *net, ARC *arc)
 {
 
+    arc->slot = net->arcs->len;
+
     g_ptr_array_add(net->arcs, arc);
+
+    if (arc->artifact.selected)
+    {
+        g_hash_table_add(net->selectedArcs, arc);
+    }
+
+    if (arc->source != NULL)
+    {
+        g_ptr_array_add(arc->source->outputs, arc);
+    }
+
+    if (arc->target != NULL)
+    {
+        g_ptr_array_add(arc->target->inputs, arc);
+    }
+
+    net_index_arc(net, arc);
+
+    for (int iVertex = 0; iVertex < arc->vertices->len; iVertex++)
+    {
+        VERTEX *vertex = g_ptr_array_index(arc->vertices, iVertex);
+
+        net->extent->add(net->extent, vertex->point.x, vertex->point.y);
+    }
+}
+
+/**
+ * @brief compile the net into a model
+ *
+ */
+MODEL *net_compile(NET *net)
+{
+    MODEL *model = create_model(net->places->len, net->transitions->len);
+
+    for (int iPlace = 0; iPlace < net->places->len; iPlace++)
+    {
+        NODE *place = g_ptr_array_index(net->places, iPlace);
+
+        model->setPlace(model, place->slot, place->name->str, place->place.marked);
+        model->setBound(model, place->slot, place->place.bound);
+    }
+
+    for (int iTransition = 0; iTransition < net->transitions->len; iTransition++)
+    {
+        NODE *transition = g_ptr_array_index(net->transitions, iTransition);
+
+        model->setTransition(model, transition->slot, transition->name->str, transition->transition.duration);
+    }
+
+    for (int iArc = 0; iArc < net->arcs->len; iArc++)
+    {
+        ARC *arc = g_ptr_array_index(net->arcs, iArc);
+
+        if (arc->source == NULL || arc->target == NULL)
+        {
+            continue;
+        }
+
+        if (arc->source->type == PLACE_NODE)
+        {
+            model->connect(model, arc->source->slot, arc->target->slot, arc->weight, INPUT_FLOW);
+        }
+        else
+        {
+            model->connect(model, arc->target->slot, arc->source->slot, arc->weight, OUTPUT_FLOW);
+        }
+    }
+
+    model->compile(model);
+
+    return model;
 }
 
 /**
@@ -1055,6 +1823,28 @@ void net_add_arc(NET *net, ARC *arc)
  */
 void net_release(NET *net)
 {
+
+    net_stop_analyses(net);
+
+    net->nodeGrid->release(net->nodeGrid);
+    net->arcGrid->release(net->arcGrid);
+
+    g_hash_table_destroy(net->references);
+
+    g_hash_table_destroy(net->selectedNodes);
+    g_hash_table_destroy(net->selectedArcs);
+
+    net->extent->release(net->extent);
+
+    net->nodePool->release(net->nodePool);
+    net->arcPool->release(net->arcPool);
+    net->vertexPool->release(net->vertexPool);
+
+    for (int iType = 0; iType < END_NODE_TYPES; iType++)
+    {
+        g_array_unref(net->released[iType]);
+    }
+
     g_free(net);
 }
 
@@ -1076,8 +1866,11 @@ NET *net_create(CONTROLLER *controller)
 
     net->addNode = net_add_node;
     net->addArc = net_add_arc;
+    net->reposition = net_reposition;
+    net->reshape = net_reshape;
 
     net->findNode = net_find_node;
+    net->compile = net_compile;
 
     net->processors[DRAW_REQUESTED] = net_draw_event_processor;
     net->processors[TOOL_SELECTED] = net_tool_event_processor;
@@ -1099,16 +1892,39 @@ NET *net_create(CONTROLLER *controller)
     net->transitions = g_ptr_array_new();
     net->arcs = g_ptr_array_new();
 
+    net->nodeGrid = create_grid(GRID_CELL_SIZE);
+    net->arcGrid = create_grid(GRID_CELL_SIZE);
+
+    net->references = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+    net->selectedNodes = g_hash_table_new(g_direct_hash, g_direct_equal);
+    net->selectedArcs = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    net->extent = create_extent();
+
+    net->model = NULL;
+    net->simulator = NULL;
+    net->placeInvariants = NULL;
+    net->transitionInvariants = NULL;
+    net->invariant = 0;
+    net->siphons = NULL;
+    net->traps = NULL;
+    net->siphon = 0;
+
+    net->nodePool = create_pool(sizeof(NODE), POOL_CHUNK_SIZE);
+    net->arcPool = create_pool(sizeof(ARC), POOL_CHUNK_SIZE);
+    net->vertexPool = create_pool(sizeof(VERTEX), POOL_CHUNK_SIZE);
+
+    for (int iType = 0; iType < END_NODE_TYPES; iType++)
+    {
+        net->identifiers[iType] = 0;
+        net->released[iType] = g_array_new(FALSE, FALSE, sizeof(int));
+    }
+
     actions[SELECT_NODE_BY_POINT] = net_select_node_by_point;
     actions[SELECT_ARC_BY_POINT] = net_select_arc_by_point;
     actions[DRAW_ARC] = net_draw_arc;
     actions[DRAW_NODE] = net_draw_node;
-    actions[UNSELECT_ALL_NODES] = net_unselect_all_nodes;
-    actions[UNSELECT_ALL_ARCS] = net_unselect_all_arcs;
-    actions[GET_NEXT_NODE_ID] = net_get_next_node_id;
-    actions[GET_NODE_VIEW_SIZE] = net_get_node_view_size;
-    actions[GET_ARC_VIEW_SIZE] = net_get_arc_view_size;
-    actions[GET_ARCS_FOR_NODE] = net_get_arcs_for_node;
     actions[SELECT_NODE_BY_BOUNDS] = net_select_node_by_bounds;
     actions[GET_SELECTED_NODES] = net_get_selected_nodes;
     actions[GET_SELECTED_ARCS] = net_get_selected_arcs;
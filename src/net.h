@@ -17,6 +17,24 @@
 
 #define TO_NET(net) ((NET*)(net))
 
+/**
+ * @brief the most nodes of the coverability tree built by the 'coverability' tool (keeps the editor responsive)
+ * 
+ */
+#define NET_COVERABILITY_LIMIT (1 << 16)
+
+/**
+ * @brief the most rows held while the 'invariants' tool computes the invariants (keeps the editor responsive)
+ * 
+ */
+#define NET_INVARIANT_LIMIT (1 << 16)
+
+/**
+ * @brief the most problems searched while the 'siphons' tool finds the siphons and traps (keeps the editor responsive)
+ * 
+ */
+#define NET_SIPHON_LIMIT (1 << 16)
+
 /**
  * @brief the Net's interface
  * 
@@ -27,6 +45,103 @@ typedef struct _NET {
     GPtrArray * transitions;
     GPtrArray * arcs;
 
+    /**
+     * @brief spatial index of the places and transitions (keyed on the node's bounds)
+     * 
+     */
+    struct _GRID * nodeGrid;
+
+    /**
+     * @brief spatial index of the arcs' segments (each vertex is keyed on the segment to its successor)
+     * 
+     */
+    struct _GRID * arcGrid;
+
+    /**
+     * @brief the places and transitions keyed by their reference ([type]-[id] - see node 'generate')
+     * 
+     */
+    GHashTable * references;
+
+    /**
+     * @brief the extent of the nodes' bounds and the arcs' vertices (used to size the view)
+     * 
+     */
+    struct _EXTENT * extent;
+
+    /**
+     * @brief the next unused identifier for each node type (seeded as nodes are added)
+     * 
+     */
+    int identifiers[END_NODE_TYPES];
+
+    /**
+     * @brief the identifiers released by delete/cut for each node type (reused before a new one is issued)
+     * 
+     */
+    GArray * released[END_NODE_TYPES];
+
+    /**
+     * @brief the selected places and transitions (a set)
+     * 
+     */
+    GHashTable * selectedNodes;
+
+    /**
+     * @brief the selected arcs (a set)
+     * 
+     */
+    GHashTable * selectedArcs;
+
+    /**
+     * @brief the storage of the net's places and transitions
+     * 
+     */
+    struct _POOL * nodePool;
+
+    /**
+     * @brief the storage of the net's arcs
+     * 
+     */
+    struct _POOL * arcPool;
+
+    /**
+     * @brief the storage of the arcs' vertices
+     * 
+     */
+    struct _POOL * vertexPool;
+
+    /**
+     * @brief the compiled net being simulated or analysed (NULL unless the 'simulate', 'invariants' or 'siphons'
+     *        tool is selected)
+     * 
+     */
+    struct _MODEL * model;
+
+    /**
+     * @brief the P- and T-invariants whose supports are highlighted in turn (NULL unless the 'invariants' tool is
+     *        selected) and the invariant highlighted (the P-invariants are counted first)
+     * 
+     */
+    struct _INVARIANTS * placeInvariants;
+    struct _INVARIANTS * transitionInvariants;
+    int invariant;
+
+    /**
+     * @brief the minimal siphons and traps whose places are highlighted in turn (NULL unless the 'siphons' tool is
+     *        selected) and the set highlighted (the siphons are counted first)
+     * 
+     */
+    struct _SIPHONS * siphons;
+    struct _SIPHONS * traps;
+    int siphon;
+
+    /**
+     * @brief the token game played on the compiled net (NULL unless the 'simulate' tool is selected)
+     * 
+     */
+    struct _SIMULATOR * simulator;
+
     enum TOOL tool;
 
     HANDLER handler;
@@ -34,6 +149,18 @@ typedef struct _NET {
     void (*addNode) (struct _NET * net, NODE * node);
     void (*addArc) (struct _NET * net, ARC * arc);
 
+    /**
+     * @brief called by a node when its position changes (previous is the node's former bounds) - keeps the indexes current
+     * 
+     */
+    void (*reposition) (struct _NET * net, NODE * node, BOUNDS * previous);
+
+    /**
+     * @brief called when an arc's vertex is added or moved (previous is NULL for an added vertex) - keeps the indexes current
+     * 
+     */
+    void (*reshape) (struct _NET * net, ARC * arc, VERTEX * vertex, POINT * previous);
+
     void (*connect) (struct _NET * net, NODE * source, POINT * point);
 
     void (*processors[END_NOTIFICATION]) (struct _NET * net, EVENT * event);
@@ -43,6 +170,12 @@ typedef struct _NET {
     void (*resize) (struct _NET * net);
     NODE * (*findNode) (struct _NET * net, char * buffer);
 
+    /**
+     * @brief compile the net into a model - place/transition indexes are the nodes' slots (the caller releases the model)
+     * 
+     */
+    struct _MODEL * (*compile) (struct _NET * net);
+
     void (*release) (struct _NET * net);
 
 } NET, * NET_P;
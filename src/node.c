@@ -37,6 +37,7 @@
 #include "handler.h"
 #include "controller.h"
 #include "net.h"
+#include "pool.h"
 
 void node_edit_handler(int id, void *value, void *object)
 {
@@ -45,7 +46,7 @@ void node_edit_handler(int id, void *value, void *object)
     {
     case 0:
     {
-        TO_NODE(object)->setName(TO_NODE(object), (char *)value);
+        TO_NODE(object)->operations->setName(TO_NODE(object), (char *)value);
         TO_NODE(object)->net->redraw(TO_NODE(object)->net);
     }
     break;
@@ -65,6 +66,20 @@ void node_edit_handler(int id, void *value, void *object)
         TO_NODE(object)->net->redraw(TO_NODE(object)->net);
     }
     break;
+
+    case 3:
+    {
+        int *duration = (int *)value;
+        TO_NODE(object)->transition.duration = *duration;
+    }
+    break;
+
+    case 4:
+    {
+        int *bound = (int *)value;
+        TO_NODE(object)->place.bound = *bound;
+    }
+    break;
     }
 }
 
@@ -80,7 +95,10 @@ void release_node(NODE *node)
         g_string_free(node->name, TRUE);
     }
 
-    g_free(node);
+    g_ptr_array_unref(node->inputs);
+    g_ptr_array_unref(node->outputs);
+
+    node->net->nodePool->free(node->net->nodePool, node);
 }
 
 /**
@@ -129,6 +147,9 @@ gint is_node_in_bounds(NODE *node, BOUNDS *bounds)
  */
 void set_position(NODE *node, double x, double y)
 {
+    BOUNDS previous;
+
+    set_bounds(&node->bounds, &previous);
 
     node->position.x = x;
     node->position.y = y;
@@ -138,6 +159,11 @@ void set_position(NODE *node, double x, double y)
 
     node->bounds.size.w = 30;
     node->bounds.size.h = 30;
+
+    if (node->net != NULL)
+    {
+        node->net->reposition(node->net, node, &previous);
+    }
 }
 
 /**
@@ -175,7 +201,7 @@ void set_default_name(NODE *node)
 
     g_string_printf(name, "%c-%d", node->type == TRANSITION_NODE ? 't' : 'p', node->id);
 
-    node->setName(node, name->str);
+    node->operations->setName(node, name->str);
 
     g_string_free(name, TRUE);
 }
@@ -197,30 +223,28 @@ void get_bounds(NODE *node, BOUNDS *bounds)
  * @brief create an initialised node common to both a place and transition node
  *
  */
-NODE *new_node()
+NODE *new_node(NET *net)
 {
-    NODE *node = g_malloc(sizeof(NODE));
+    NODE *node = net->nodePool->allocate(net->nodePool);
 
+    node->net = net;
     node->id = 0;
 
-    node->release = release_node;
-    node->setPosition = set_position;
-    node->getBounds = get_bounds;
-    node->isNodeAtPoint = is_node_at_point;
-    node->generate = node_generate;
-
-    node->isTransition = is_transition;
-    node->isPlace = is_place;
+    set_point(&node->position, 0, 0);
+    set_point(&node->bounds.point, 0, 0);
+    set_size(&node->bounds.size, 0, 0);
 
     setup_artifact(&node->artifact, FALSE, ACTIVE, TRUE);
 
     node->textLength = 0;
 
-    node->setName = set_name;
-    node->setDefaultName = set_default_name;
-
     node->alignment = BOTTOM;
 
+    node->inputs = g_ptr_array_new();
+    node->outputs = g_ptr_array_new();
+
+    node->slot = NO_SLOT;
+
     return node;
 }
 
@@ -235,10 +259,27 @@ void node_place_editor(NODE *node, EDITOR *editor)
     editor->init(editor, node, node_edit_handler,
                  TEXT_FIELD, 0, "Name", node->name->str,
                  SPIN_BUTTON, 1, "Tokens", node->place.marked,
+                 SPIN_BUTTON, 4, "Bound", node->place.bound,
                  ALIGNMENT_BOX, 2, "Align", 1,
                  END_FIELD);
 }
 
+/**
+ * @brief the place operations
+ *
+ */
+const NODE_OPERATIONS place_operations = {
+    .release = release_node,
+    .setPosition = set_position,
+    .isTransition = is_transition,
+    .isPlace = is_place,
+    .generate = node_generate,
+    .setName = set_name,
+    .setDefaultName = set_default_name,
+    .getBounds = get_bounds,
+    .isNodeAtPoint = is_node_at_point,
+    .edit = node_place_editor};
+
 /**
  * @brief create an initialised "place" node
  *
@@ -246,15 +287,17 @@ void node_place_editor(NODE *node, EDITOR *editor)
 NODE *new_place(NODE *node)
 {
 
+    node->operations = &place_operations;
+
     node->place.marked = 0;
     node->place.occupied = FALSE;
+    node->place.bound = 0;
 
     node->artifact.state = INACTIVE;
     node->type = PLACE_NODE;
 
     node->painter.type = PLACE_PAINTER;
     node->painter.painters.place_painter.node = node;
-    node->edit = node_place_editor;
 
     set_default_name(node);
 
@@ -270,10 +313,27 @@ void node_transition_editor(NODE *node, EDITOR *editor)
 {
     editor->init(editor, node, node_edit_handler,
                  TEXT_FIELD, 0, "Name", node->name->str,
+                 SPIN_BUTTON, 3, "Duration", node->transition.duration,
                  ALIGNMENT_BOX, 2, "Align", 1,
                  END_FIELD);
 }
 
+/**
+ * @brief the transition operations
+ *
+ */
+const NODE_OPERATIONS transition_operations = {
+    .release = release_node,
+    .setPosition = set_position,
+    .isTransition = is_transition,
+    .isPlace = is_place,
+    .generate = node_generate,
+    .setName = set_name,
+    .setDefaultName = set_default_name,
+    .getBounds = get_bounds,
+    .isNodeAtPoint = is_node_at_point,
+    .edit = node_transition_editor};
+
 /**
  * @brief create an initialised "transition" node
  *
@@ -281,6 +341,8 @@ void node_transition_editor(NODE *node, EDITOR *editor)
 NODE *new_transition(NODE *node)
 {
 
+    node->operations = &transition_operations;
+
     node->transition.duration = 0;
 
     node->artifact.state = INACTIVE;
@@ -289,31 +351,18 @@ NODE *new_transition(NODE *node)
     node->painter.type = TRANSITION_PAINTER;
     node->painter.painters.transition_painter.node = node;
 
-    node->edit = node_transition_editor;
-
     set_default_name(node);
 
     return node;
 }
 
-/**
- * @brief release/free the node object
- *
- */
-void node_release(NODE *node)
-{
-    g_free(node);
-}
-
 /**
  * @brief create an initialised node common to both a place and transition node
  *
  */
 NODE *create_node(int type, NET *net)
 {
-    NODE *node = new_node();
-
-    node->net = net;
+    NODE *node = new_node(net);
 
     return type == PLACE_NODE ? new_place(node) : new_transition(node);
 }
\ No newline at end of file
@@ -64,6 +64,7 @@ typedef struct
 
     int marked;
     int occupied;
+    int bound;
 
 } PLACE;
 
@@ -78,21 +79,13 @@ typedef struct
 
 } TRANSITION;
 
-typedef struct _NODE
+/**
+ * @brief the operations of a node - one (constant) table for places and one for transitions
+ * 
+ */
+typedef struct _NODE_OPERATIONS
 {
-    
-    /**  
-     * @brief base structure for a node and arc
-     * 
-     */
-    struct _ARTIFACT artifact;
 
-    /**  
-     * @brief define how the painter should draw the node
-     * 
-     */
-    struct _PAINTER painter;
-    
     /**
      * @brief node's destructor
      * 
@@ -153,6 +146,29 @@ typedef struct _NODE
      */
     void (*edit)(struct _NODE *node,  EDITOR * editor);
 
+} NODE_OPERATIONS, *NODE_OPERATIONS_P;
+
+typedef struct _NODE
+{
+    
+    /**  
+     * @brief base structure for a node and arc
+     * 
+     */
+    struct _ARTIFACT artifact;
+
+    /**  
+     * @brief define how the painter should draw the node
+     * 
+     */
+    struct _PAINTER painter;
+    
+    /**
+     * @brief the node's operations (shared by all the nodes of the same type)
+     * 
+     */
+    const struct _NODE_OPERATIONS * operations;
+
     /**
      * @brief the owning 'net'
      * 
@@ -201,6 +217,24 @@ typedef struct _NODE
      */
     BOUNDS bounds;
 
+    /**
+     * @brief the arcs whose target is this node (maintained by the net)
+     * 
+     */
+    GPtrArray *inputs;
+
+    /**
+     * @brief the arcs whose source is this node (maintained by the net)
+     * 
+     */
+    GPtrArray *outputs;
+
+    /**
+     * @brief the node's index within the net's places or transitions (NO_SLOT if not held by the net)
+     * 
+     */
+    int slot;
+
     /**
      * @brief a node can be one type - PLACE or TRANSITION
      * 
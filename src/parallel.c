@@ -0,0 +1,765 @@
+/**
+ * @file parallel.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  explores the reachable markings of a compiled model with a pool of work stealing threads
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "explorer.h"
+#include "parallel.h"
+
+/**
+ * @brief private structure - a thread's unexpanded states (the owner works at the back, thieves at the front)
+ *
+ */
+typedef struct _PARALLEL_DEQUE
+{
+    pthread_mutex_t lock;
+    long *items;
+    long head;
+    long tail;
+    long capacity;
+
+    /**
+     * @brief keep each deque on its own cache line
+     *
+     */
+    char padding[64];
+
+} PARALLEL_DEQUE, *PARALLEL_DEQUE_P;
+
+/**
+ * @brief private structure - the state shared by the threads during an exploration
+ *
+ */
+typedef struct _PARALLEL_RUN
+{
+    PARALLEL_EXPLORER *explorer;
+    PARALLEL_DEQUE *deques;
+
+    /**
+     * @brief the states held but not yet expanded - exploration is finished once this reaches zero
+     *
+     */
+    atomic_long pending;
+
+    atomic_long states;
+    atomic_long edges;
+    atomic_long expanded;
+    atomic_int stop;
+
+    int limit;
+
+    /**
+     * @brief set if a marking overflowed the codec - the largest overflowing tokens of each place are kept
+     *
+     */
+    int overflowed;
+    unsigned int *overflow;
+    pthread_mutex_t overflowLock;
+
+} PARALLEL_RUN, *PARALLEL_RUN_P;
+
+/**
+ * @brief private structure - a thread's context
+ *
+ */
+typedef struct _PARALLEL_WORKER
+{
+    PARALLEL_RUN *run;
+    pthread_t thread;
+    int index;
+    unsigned long long random;
+
+} PARALLEL_WORKER, *PARALLEL_WORKER_P;
+
+/**
+ * @brief private structure - a thread's working markings
+ *
+ */
+typedef struct _PARALLEL_BUFFERS
+{
+    unsigned int *marking;
+    unsigned int *successor;
+    unsigned int *packed;
+
+    int *chosen;
+    int *work;
+
+} PARALLEL_BUFFERS, *PARALLEL_BUFFERS_P;
+
+/**
+ * @brief push states onto the back of a deque
+ *
+ */
+void parallel_push(PARALLEL_DEQUE *deque, const long *states, int count)
+{
+
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->tail + count > deque->capacity)
+    {
+        // reclaim the space left by thieves before growing
+        memmove(deque->items, deque->items + deque->head, sizeof(long) * (deque->tail - deque->head));
+
+        deque->tail -= deque->head;
+        deque->head = 0;
+
+        while (deque->tail + count > deque->capacity)
+        {
+            deque->capacity *= 2;
+            deque->items = realloc(deque->items, sizeof(long) * deque->capacity);
+        }
+    }
+
+    memcpy(deque->items + deque->tail, states, sizeof(long) * count);
+
+    deque->tail += count;
+
+    pthread_mutex_unlock(&deque->lock);
+}
+
+/**
+ * @brief pop a state from the back of a deque - returns false if the deque is empty
+ *
+ */
+int parallel_pop(PARALLEL_DEQUE *deque, long *state)
+{
+    int found = FALSE;
+
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->tail > deque->head)
+    {
+        *state = deque->items[--deque->tail];
+        found = TRUE;
+    }
+
+    if (deque->tail == deque->head)
+    {
+        deque->head = 0;
+        deque->tail = 0;
+    }
+
+    pthread_mutex_unlock(&deque->lock);
+
+    return found;
+}
+
+/**
+ * @brief steal half of the states from the front of another thread's deque - returns the number stolen
+ *
+ */
+int parallel_steal(PARALLEL_WORKER *worker, long *stolen, int room)
+{
+    PARALLEL_RUN *run = worker->run;
+    int threads = run->explorer->threads;
+
+    for (int iAttempt = 0; iAttempt < threads; iAttempt++)
+    {
+        PARALLEL_DEQUE *victim = NULL;
+        int count = 0;
+
+        worker->random ^= worker->random >> 12;
+        worker->random ^= worker->random << 25;
+        worker->random ^= worker->random >> 27;
+
+        victim = &run->deques[(worker->random * 0x2545F4914F6CDD1DULL >> 33) % threads];
+
+        if (victim == &run->deques[worker->index])
+        {
+            continue;
+        }
+
+        pthread_mutex_lock(&victim->lock);
+
+        count = (int)((victim->tail - victim->head + 1) / 2);
+        count = count > room ? room : count;
+
+        memcpy(stolen, victim->items + victim->head, sizeof(long) * count);
+
+        victim->head += count;
+
+        pthread_mutex_unlock(&victim->lock);
+
+        if (count > 0)
+        {
+            return count;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief add a dead state
+ *
+ */
+void parallel_add_deadlock(PARALLEL_EXPLORER *explorer, long state)
+{
+
+    pthread_mutex_lock(&explorer->deadlockLock);
+
+    if (explorer->deadlockCount == explorer->deadlockCapacity)
+    {
+        explorer->deadlockCapacity *= 2;
+        explorer->deadlocks = realloc(explorer->deadlocks, sizeof(long) * explorer->deadlockCapacity);
+    }
+
+    explorer->deadlocks[explorer->deadlockCount++] = state;
+
+    pthread_mutex_unlock(&explorer->deadlockLock);
+}
+
+/**
+ * @brief insert a packed marking - returns true (and the state) if the marking was not already held
+ *
+ */
+int parallel_insert(PARALLEL_EXPLORER *explorer, const unsigned int *packed, long *state)
+{
+    unsigned int hash = store_hash(packed, explorer->codec->words);
+    int segment = explorer->segmentBits == 0 ? 0 : (int)(hash >> (32 - explorer->segmentBits));
+    int created = FALSE;
+    int index = 0;
+
+    pthread_mutex_lock(&explorer->locks[segment]);
+
+    index = explorer->segments[segment]->insertHashed(explorer->segments[segment], packed, hash, &created);
+
+    pthread_mutex_unlock(&explorer->locks[segment]);
+
+    *state = ((long)index << explorer->segmentBits) | segment;
+
+    return created;
+}
+
+/**
+ * @brief copy the packed marking of a state (the segment may move its states as it grows)
+ *
+ */
+void parallel_copy_packed(PARALLEL_EXPLORER *explorer, long state, unsigned int *packed)
+{
+    int segment = (int)(state & ((1L << explorer->segmentBits) - 1));
+
+    pthread_mutex_lock(&explorer->locks[segment]);
+
+    memcpy(packed, explorer->segments[segment]->get(explorer->segments[segment], (int)(state >> explorer->segmentBits)),
+           sizeof(unsigned int) * explorer->codec->words);
+
+    pthread_mutex_unlock(&explorer->locks[segment]);
+}
+
+/**
+ * @brief record a marking that overflows the codec and stop the threads - the codec is widened once they finish
+ *
+ */
+void parallel_overflow(PARALLEL_RUN *run, const unsigned int *marking)
+{
+
+    pthread_mutex_lock(&run->overflowLock);
+
+    for (int iPlace = 0; iPlace < run->explorer->model->places; iPlace++)
+    {
+        run->overflow[iPlace] = marking[iPlace] > run->overflow[iPlace] ? marking[iPlace] : run->overflow[iPlace];
+    }
+
+    run->overflowed = TRUE;
+
+    pthread_mutex_unlock(&run->overflowLock);
+
+    atomic_store(&run->stop, TRUE);
+}
+
+/**
+ * @brief fire an enabled transition - returns true if the successor is a new state (added to 'created'), false
+ *        if it was already held, -1 if it overflows the codec
+ *
+ */
+int parallel_fire(PARALLEL_RUN *run, const unsigned int *marking, int transition, PARALLEL_BUFFERS *buffers,
+                  long *created)
+{
+    MODEL *model = run->explorer->model;
+    CODEC *codec = run->explorer->codec;
+    unsigned int *successor = buffers->successor;
+
+    memcpy(successor, marking, sizeof(unsigned int) * model->places);
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        successor[model->changePlaces[iChange]] += model->changeValues[iChange];
+    }
+
+    if (!codec->fits(codec, successor))
+    {
+        parallel_overflow(run, successor);
+
+        return -1;
+    }
+
+    codec->encode(codec, successor, buffers->packed);
+
+    return parallel_insert(run->explorer, buffers->packed, created);
+}
+
+/**
+ * @brief private structure - the state whose stubborn sets are being considered
+ *
+ */
+typedef struct _PARALLEL_CANDIDATE
+{
+    PARALLEL_EXPLORER *explorer;
+    PARALLEL_BUFFERS *buffers;
+
+} PARALLEL_CANDIDATE, *PARALLEL_CANDIDATE_P;
+
+/**
+ * @brief accept a stubborn set if none of its successors is already held - a cycle's state that is expanded first
+ *        is held when its predecessor on the cycle is expanded, so every cycle of the reduced graph holds a fully
+ *        expanded state (the cycle proviso)
+ *
+ */
+int parallel_accept(void *data, const int *transitions, int count)
+{
+    PARALLEL_CANDIDATE *candidate = data;
+    PARALLEL_EXPLORER *explorer = candidate->explorer;
+    PARALLEL_BUFFERS *buffers = candidate->buffers;
+    MODEL *model = explorer->model;
+
+    for (int iTransition = 0; iTransition < count; iTransition++)
+    {
+        unsigned int hash = 0;
+        int segment = 0;
+        int found = 0;
+
+        memcpy(buffers->successor, buffers->marking, sizeof(unsigned int) * model->places);
+
+        for (int iChange = model->changeStart[transitions[iTransition]];
+             iChange < model->changeStart[transitions[iTransition] + 1]; iChange++)
+        {
+            buffers->successor[model->changePlaces[iChange]] += model->changeValues[iChange];
+        }
+
+        if (!explorer->codec->fits(explorer->codec, buffers->successor))
+        {
+            continue;
+        }
+
+        explorer->codec->encode(explorer->codec, buffers->successor, buffers->packed);
+
+        hash = store_hash(buffers->packed, explorer->codec->words);
+        segment = explorer->segmentBits == 0 ? 0 : (int)(hash >> (32 - explorer->segmentBits));
+
+        pthread_mutex_lock(&explorer->locks[segment]);
+
+        found = explorer->segments[segment]->find(explorer->segments[segment], buffers->packed);
+
+        pthread_mutex_unlock(&explorer->locks[segment]);
+
+        if (found >= 0)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief generate the successors of a state - returns the number of new states (added to 'created'); with a
+ *        reduction only a stubborn set is fired (all enabled transitions if no set is accepted)
+ *
+ */
+int parallel_expand(PARALLEL_WORKER *worker, long state, PARALLEL_BUFFERS *buffers, long *created)
+{
+    PARALLEL_RUN *run = worker->run;
+    PARALLEL_EXPLORER *explorer = run->explorer;
+    MODEL *model = explorer->model;
+    REDUCTION *reduction = explorer->reduction;
+    PARALLEL_CANDIDATE candidate = {explorer, buffers};
+    unsigned int *marking = buffers->marking;
+    int chosen = 0;
+    int count = 0;
+    long edges = 0;
+
+    parallel_copy_packed(explorer, state, buffers->packed);
+
+    explorer->codec->decode(explorer->codec, buffers->packed, marking);
+
+    if (reduction != NULL)
+    {
+        chosen = reduction->select(reduction, marking, buffers->chosen, buffers->work,
+                                   reduction->mode == SAFETY_REDUCTION ? parallel_accept : NULL, &candidate);
+    }
+
+    for (int iChosen = 0; iChosen < chosen; iChosen++)
+    {
+        int fired = parallel_fire(run, marking, buffers->chosen[iChosen], buffers, &created[count]);
+
+        if (fired < 0)
+        {
+            return count;
+        }
+
+        count += fired;
+        edges += 1;
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions && chosen == 0; iTransition++)
+    {
+        int fired = 0;
+
+        if (!reduction_is_enabled(model, marking, iTransition))
+        {
+            continue;
+        }
+
+        fired = parallel_fire(run, marking, iTransition, buffers, &created[count]);
+
+        if (fired < 0)
+        {
+            return count;
+        }
+
+        count += fired;
+        edges += 1;
+    }
+
+    if (edges == 0)
+    {
+        parallel_add_deadlock(explorer, state);
+    }
+
+    atomic_fetch_add_explicit(&run->edges, edges, memory_order_relaxed);
+
+    return count;
+}
+
+/**
+ * @brief a thread's main loop - expand states until none are pending (or the limit is reached)
+ *
+ */
+void *parallel_work(void *data)
+{
+    PARALLEL_WORKER *worker = data;
+    PARALLEL_RUN *run = worker->run;
+    MODEL *model = run->explorer->model;
+    PARALLEL_DEQUE *deque = &run->deques[worker->index];
+    PARALLEL_BUFFERS buffers;
+    int room = model->transitions > PARALLEL_DEQUE_CAPACITY ? model->transitions : PARALLEL_DEQUE_CAPACITY;
+    long *created = malloc(sizeof(long) * room);
+    long state = 0;
+
+    buffers.marking = malloc(sizeof(unsigned int) * (model->places + 1));
+    buffers.successor = malloc(sizeof(unsigned int) * (model->places + 1));
+    buffers.packed = malloc(sizeof(unsigned int) * (run->explorer->codec->words + 1));
+    buffers.chosen = malloc(sizeof(int) * (model->transitions + 1));
+    buffers.work = malloc(sizeof(int) * REDUCTION_WORK_SIZE(model->transitions));
+
+    while (!atomic_load_explicit(&run->stop, memory_order_relaxed))
+    {
+        if (!parallel_pop(deque, &state))
+        {
+            int stolen = 0;
+
+            if (atomic_load(&run->pending) == 0)
+            {
+                break;
+            }
+
+            stolen = parallel_steal(worker, created, room);
+
+            if (stolen == 0)
+            {
+                sched_yield();
+            }
+            else
+            {
+                parallel_push(deque, created, stolen);
+            }
+
+            continue;
+        }
+
+        int count = parallel_expand(worker, state, &buffers, created);
+
+        if (count > 0)
+        {
+            long states = atomic_fetch_add(&run->states, count) + count;
+
+            // the new states are pending before the expanded state is retired - so pending can't reach zero early
+            atomic_fetch_add(&run->pending, count);
+
+            parallel_push(deque, created, count);
+
+            if (run->limit > 0 && states >= run->limit)
+            {
+                atomic_store(&run->stop, TRUE);
+            }
+        }
+
+        atomic_fetch_add_explicit(&run->expanded, 1, memory_order_relaxed);
+        atomic_fetch_sub(&run->pending, 1);
+    }
+
+    free(buffers.marking);
+    free(buffers.successor);
+    free(buffers.packed);
+    free(buffers.chosen);
+    free(buffers.work);
+    free(created);
+
+    return NULL;
+}
+
+/**
+ * @brief allocate the segments of the marking table (sized by the codec)
+ *
+ */
+void parallel_create_segments(PARALLEL_EXPLORER *explorer)
+{
+
+    for (int iSegment = 0; iSegment < (1 << explorer->segmentBits); iSegment++)
+    {
+        explorer->segments[iSegment] = create_store(explorer->codec->words);
+    }
+}
+
+/**
+ * @brief release the segments of the marking table
+ *
+ */
+void parallel_release_segments(PARALLEL_EXPLORER *explorer)
+{
+
+    for (int iSegment = 0; iSegment < (1 << explorer->segmentBits); iSegment++)
+    {
+        explorer->segments[iSegment]->release(explorer->segments[iSegment]);
+    }
+}
+
+/**
+ * @brief explore from the initial marking once - returns false if a marking overflowed the codec
+ *
+ */
+int parallel_run(PARALLEL_EXPLORER *explorer, PARALLEL_RUN *run)
+{
+    MODEL *model = explorer->model;
+    PARALLEL_WORKER *workers = malloc(sizeof(PARALLEL_WORKER) * explorer->threads);
+    unsigned int *initial = malloc(sizeof(unsigned int) * (model->places + 1));
+    unsigned int *packed = malloc(sizeof(unsigned int) * (explorer->codec->words + 1));
+    long state = 0;
+
+    for (int iSegment = 0; iSegment < (1 << explorer->segmentBits); iSegment++)
+    {
+        explorer->segments[iSegment]->clear(explorer->segments[iSegment]);
+    }
+
+    explorer->deadlockCount = 0;
+
+    atomic_init(&run->pending, 1);
+    atomic_init(&run->states, 1);
+    atomic_init(&run->edges, 0);
+    atomic_init(&run->expanded, 0);
+    atomic_init(&run->stop, FALSE);
+
+    run->overflowed = FALSE;
+
+    for (int iThread = 0; iThread < explorer->threads; iThread++)
+    {
+        run->deques[iThread].head = 0;
+        run->deques[iThread].tail = 0;
+    }
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        initial[iPlace] = model->marking[iPlace];
+        run->overflow[iPlace] = 0;
+    }
+
+    explorer->codec->encode(explorer->codec, initial, packed);
+
+    parallel_insert(explorer, packed, &state);
+    parallel_push(&run->deques[0], &state, 1);
+
+    for (int iThread = 0; iThread < explorer->threads; iThread++)
+    {
+        workers[iThread].run = run;
+        workers[iThread].index = iThread;
+        workers[iThread].random = 0x9E3779B97F4A7C15ULL * (iThread + 1);
+
+        pthread_create(&workers[iThread].thread, NULL, parallel_work, &workers[iThread]);
+    }
+
+    for (int iThread = 0; iThread < explorer->threads; iThread++)
+    {
+        pthread_join(workers[iThread].thread, NULL);
+    }
+
+    free(workers);
+    free(initial);
+    free(packed);
+
+    return !run->overflowed;
+}
+
+/**
+ * @brief explore the reachable markings with the explorer's threads - if a marking overflows the codec, the codec
+ *        is widened and the exploration restarted (each restart at least doubles the overflowing fields)
+ *
+ */
+int parallel_explore(PARALLEL_EXPLORER *explorer, int limit)
+{
+    MODEL *model = explorer->model;
+    PARALLEL_RUN run;
+    double started = explorer_clock();
+
+    run.explorer = explorer;
+    run.deques = malloc(sizeof(PARALLEL_DEQUE) * explorer->threads);
+    run.overflow = malloc(sizeof(unsigned int) * (model->places + 1));
+    run.limit = limit;
+
+    pthread_mutex_init(&run.overflowLock, NULL);
+
+    for (int iThread = 0; iThread < explorer->threads; iThread++)
+    {
+        pthread_mutex_init(&run.deques[iThread].lock, NULL);
+
+        run.deques[iThread].capacity = PARALLEL_DEQUE_CAPACITY;
+        run.deques[iThread].items = malloc(sizeof(long) * PARALLEL_DEQUE_CAPACITY);
+    }
+
+    while (!parallel_run(explorer, &run))
+    {
+        CODEC *codec = explorer->codec->widen(explorer->codec, run.overflow);
+
+        parallel_release_segments(explorer);
+
+        explorer->codec->release(explorer->codec);
+        explorer->codec = codec;
+        explorer->widenings += 1;
+
+        parallel_create_segments(explorer);
+    }
+
+    explorer->states = atomic_load(&run.states);
+    explorer->edges = atomic_load(&run.edges);
+    explorer->expanded = atomic_load(&run.expanded);
+    explorer->complete = atomic_load(&run.pending) == 0;
+    explorer->seconds = explorer_clock() - started;
+
+    for (int iThread = 0; iThread < explorer->threads; iThread++)
+    {
+        pthread_mutex_destroy(&run.deques[iThread].lock);
+        free(run.deques[iThread].items);
+    }
+
+    pthread_mutex_destroy(&run.overflowLock);
+
+    free(run.deques);
+    free(run.overflow);
+
+    return explorer->complete;
+}
+
+/**
+ * @brief the marking of a state
+ *
+ */
+const unsigned int *parallel_get_marking(PARALLEL_EXPLORER *explorer, long state)
+{
+    STORE *segment = explorer->segments[state & ((1L << explorer->segmentBits) - 1)];
+
+    explorer->codec->decode(explorer->codec, segment->get(segment, (int)(state >> explorer->segmentBits)), explorer->view);
+
+    return explorer->view;
+}
+
+/**
+ * @brief release/free the parallel explorer object
+ *
+ */
+void parallel_release(PARALLEL_EXPLORER *explorer)
+{
+
+    parallel_release_segments(explorer);
+
+    for (int iSegment = 0; iSegment < (1 << explorer->segmentBits); iSegment++)
+    {
+        pthread_mutex_destroy(&explorer->locks[iSegment]);
+    }
+
+    pthread_mutex_destroy(&explorer->deadlockLock);
+
+    explorer->codec->release(explorer->codec);
+
+    free(explorer->segments);
+    free(explorer->locks);
+    free(explorer->deadlocks);
+    free(explorer->view);
+
+    free(explorer);
+}
+
+/**
+ * @brief parallel explorer constructor
+ *
+ */
+PARALLEL_EXPLORER *create_parallel_explorer(MODEL *model, int threads)
+{
+    PARALLEL_EXPLORER *explorer = malloc(sizeof(PARALLEL_EXPLORER));
+
+    explorer->model = model;
+    explorer->threads = threads < 1 ? 1 : threads;
+
+    explorer->states = 0;
+    explorer->edges = 0;
+    explorer->expanded = 0;
+    explorer->deadlockCount = 0;
+    explorer->complete = FALSE;
+    explorer->seconds = 0;
+
+    explorer->codec = create_codec_for_model(model);
+    explorer->widenings = 0;
+    explorer->reduction = NULL;
+    explorer->view = malloc(sizeof(unsigned int) * (model->places + 1));
+
+    explorer->segmentBits = 0;
+
+    while ((1 << explorer->segmentBits) < explorer->threads * PARALLEL_SEGMENTS_PER_THREAD)
+    {
+        explorer->segmentBits += 1;
+    }
+
+    explorer->segments = malloc(sizeof(STORE *) << explorer->segmentBits);
+    explorer->locks = malloc(sizeof(pthread_mutex_t) << explorer->segmentBits);
+
+    parallel_create_segments(explorer);
+
+    for (int iSegment = 0; iSegment < (1 << explorer->segmentBits); iSegment++)
+    {
+        pthread_mutex_init(&explorer->locks[iSegment], NULL);
+    }
+
+    explorer->deadlockCapacity = 64;
+    explorer->deadlocks = malloc(sizeof(long) * explorer->deadlockCapacity);
+    pthread_mutex_init(&explorer->deadlockLock, NULL);
+
+    explorer->explore = parallel_explore;
+    explorer->getMarking = parallel_get_marking;
+    explorer->release = parallel_release;
+
+    return explorer;
+}
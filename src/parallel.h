@@ -0,0 +1,154 @@
+/**
+ * @file parallel.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - explores the reachable markings of a compiled model with a pool of work stealing threads
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef PARALLEL_H_INCLUDED
+#define PARALLEL_H_INCLUDED
+
+#include <pthread.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+
+/**
+ * @brief casts an object to a parallel explorer
+ *
+ */
+#define TO_PARALLEL_EXPLORER(explorer) ((PARALLEL_EXPLORER *)(explorer))
+
+/**
+ * @brief the number of segments (of the marking table) per thread - a segment is locked while it is searched
+ *
+ */
+#define PARALLEL_SEGMENTS_PER_THREAD 16
+
+/**
+ * @brief the initial capacity of a thread's deque
+ *
+ */
+#define PARALLEL_DEQUE_CAPACITY 1024
+
+/**
+ * @brief the parallel explorer's interface - the marking table is split into segments (chosen by the high
+ *        bits of the marking's hash) each with its own lock, and each thread keeps a deque of unexpanded
+ *        states; a thread takes from the back of its own deque and, once empty, steals half of another's
+ *        from the front. A state is identified by its index within its segment and the segment
+ *        ((index << segmentBits) | segment) - the initial marking is state 0; markings are held packed by
+ *        the codec
+ *
+ */
+typedef struct _PARALLEL_EXPLORER
+{
+
+    /**
+     * @brief explore the reachable markings - exploration stops once 'limit' states are held (0 is no limit),
+     *        returns true if every reachable state has been expanded, false otherwise
+     *
+     */
+    int (*explore)(struct _PARALLEL_EXPLORER *explorer, int limit);
+
+    /**
+     * @brief the marking of a state (one entry per place) - only valid once exploration has finished and
+     *        until the next call
+     *
+     */
+    const unsigned int *(*getMarking)(struct _PARALLEL_EXPLORER *explorer, long state);
+
+    /**
+     * @brief release the explorer and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _PARALLEL_EXPLORER *explorer);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the number of threads
+     *
+     */
+    int threads;
+
+    /**
+     * @brief packs the markings held by the segments
+     *
+     */
+    CODEC *codec;
+
+    /**
+     * @brief the stubborn set reduction applied to each state (NULL - every enabled transition is expanded)
+     *
+     */
+    REDUCTION *reduction;
+
+    /**
+     * @brief the number of times the codec has been widened (each restarts the exploration)
+     *
+     */
+    int widenings;
+
+    /**
+     * @brief the number of states, edges and expanded states found by the last exploration
+     *
+     */
+    long states;
+    long edges;
+    long expanded;
+
+    /**
+     * @brief the states without an enabled transition
+     *
+     */
+    long *deadlocks;
+    int deadlockCount;
+
+    /**
+     * @brief true if every reachable state has been expanded
+     *
+     */
+    int complete;
+
+    /**
+     * @brief the time taken by the last exploration (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief private (the segments of the marking table and their locks)
+     *
+     */
+    STORE **segments;
+    pthread_mutex_t *locks;
+    int segmentBits;
+
+    /**
+     * @brief private (the deadlock array's capacity and lock)
+     *
+     */
+    int deadlockCapacity;
+    pthread_mutex_t deadlockLock;
+
+    /**
+     * @brief private (the marking returned by getMarking)
+     *
+     */
+    unsigned int *view;
+
+} PARALLEL_EXPLORER, *PARALLEL_EXPLORER_P;
+
+extern PARALLEL_EXPLORER *create_parallel_explorer(MODEL *model, int threads);
+
+#endif // PARALLEL_H_INCLUDED
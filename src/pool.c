@@ -0,0 +1,105 @@
+/**
+ * @file pool.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  a pool of fixed size objects allocated in contiguous chunks
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <glib.h>
+#include <gtk/gtk.h>
+#include <gdk/gdk.h>
+
+#include "pool.h"
+
+/**
+ * @brief allocate an object - reuse a freed object, otherwise take the next object from the last chunk
+ *
+ */
+gpointer pool_allocate(POOL *pool)
+{
+    gpointer object = pool->available;
+
+    if (object != NULL)
+    {
+        pool->available = *(gpointer *)object;
+
+        return object;
+    }
+
+    if (pool->chunks->len == 0 || pool->used == pool->count)
+    {
+        g_ptr_array_add(pool->chunks, g_malloc(pool->size * pool->count));
+
+        pool->used = 0;
+    }
+
+    object = (char *)g_ptr_array_index(pool->chunks, pool->chunks->len - 1) + pool->size * pool->used;
+
+    pool->used += 1;
+
+    return object;
+}
+
+/**
+ * @brief return an object to the pool
+ *
+ */
+void pool_free(POOL *pool, gpointer object)
+{
+
+    *(gpointer *)object = pool->available;
+
+    pool->available = object;
+}
+
+/**
+ * @brief return every object to the pool and free the chunks
+ *
+ */
+void pool_clear(POOL *pool)
+{
+
+    g_ptr_array_set_size(pool->chunks, 0);
+
+    pool->used = 0;
+    pool->available = NULL;
+}
+
+/**
+ * @brief release/free the pool object
+ *
+ */
+void pool_release(POOL *pool)
+{
+
+    g_ptr_array_unref(pool->chunks);
+
+    g_free(pool);
+}
+
+/**
+ * @brief pool constructor
+ *
+ */
+POOL *create_pool(gsize size, guint count)
+{
+    POOL *pool = g_malloc(sizeof(POOL));
+
+    pool->size = (MAX(size, sizeof(gpointer)) + POOL_ALIGNMENT - 1) & ~(gsize)(POOL_ALIGNMENT - 1);
+    pool->count = count;
+    pool->used = 0;
+    pool->available = NULL;
+
+    pool->chunks = g_ptr_array_new_with_free_func(g_free);
+
+    pool->allocate = pool_allocate;
+    pool->free = pool_free;
+    pool->clear = pool_clear;
+    pool->release = pool_release;
+
+    return pool;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file pool.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - a pool of fixed size objects allocated in contiguous chunks
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef POOL_H_INCLUDED
+#define POOL_H_INCLUDED
+
+/**
+ * @brief casts an object to a pool
+ *
+ */
+#define TO_POOL(pool) ((POOL *)(pool))
+
+/**
+ * @brief the default number of objects in a chunk
+ *
+ */
+#define POOL_CHUNK_SIZE 256
+
+/**
+ * @brief the alignment of each object within a chunk
+ *
+ */
+#define POOL_ALIGNMENT 16
+
+/**
+ * @brief the pool's interface - freed objects are reused before a chunk is extended
+ *
+ */
+typedef struct _POOL
+{
+
+    /**
+     * @brief allocate an (uninitialised) object
+     *
+     */
+    gpointer (*allocate)(struct _POOL *pool);
+
+    /**
+     * @brief return an object to the pool
+     *
+     */
+    void (*free)(struct _POOL *pool, gpointer object);
+
+    /**
+     * @brief return every object to the pool and free the chunks
+     *
+     */
+    void (*clear)(struct _POOL *pool);
+
+    /**
+     * @brief release the pool and deallocate resources (including all the objects)
+     *
+     */
+    void (*release)(struct _POOL *pool);
+
+    /**
+     * @brief the size of an object (rounded up to the alignment)
+     *
+     */
+    gsize size;
+
+    /**
+     * @brief the number of objects in a chunk
+     *
+     */
+    guint count;
+
+    /**
+     * @brief private (the number of objects issued from the last chunk)
+     *
+     */
+    guint used;
+
+    /**
+     * @brief private (the chunks - each holds 'count' objects)
+     *
+     */
+    GPtrArray *chunks;
+
+    /**
+     * @brief private (the freed objects - each freed object holds the next)
+     *
+     */
+    gpointer available;
+
+} POOL, *POOL_P;
+
+extern POOL *create_pool(gsize size, guint count);
+
+#endif // POOL_H_INCLUDED
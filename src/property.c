@@ -0,0 +1,889 @@
+/**
+ * @file property.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  parses a temporal property (CTL or LTL) of a compiled model and evaluates its atomic propositions
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "property.h"
+
+/**
+ * @brief the longest name (or number) read
+ *
+ */
+#define PROPERTY_NAME_SIZE 128
+
+/**
+ * @brief private - the tokens of a property
+ *
+ */
+enum PROPERTY_TOKEN
+{
+    END_TOKEN = 0,
+    NAME_TOKEN,
+    NUMBER_TOKEN,
+    OPEN_TOKEN,
+    CLOSE_TOKEN,
+    OPEN_BRACKET_TOKEN,
+    CLOSE_BRACKET_TOKEN,
+    NOT_TOKEN,
+    AND_TOKEN,
+    OR_TOKEN,
+    IMPLIES_TOKEN,
+    LESS_TOKEN,
+    LESS_EQUAL_TOKEN,
+    GREATER_TOKEN,
+    GREATER_EQUAL_TOKEN,
+    EQUAL_TOKEN,
+    NOT_EQUAL_TOKEN,
+    PLUS_TOKEN,
+    MINUS_TOKEN,
+    TIMES_TOKEN,
+    UNKNOWN_TOKEN
+};
+
+/**
+ * @brief private structure - the text being parsed and the current token (a quoted name is never a keyword)
+ *
+ */
+typedef struct _PROPERTY_PARSER
+{
+    PROPERTY *property;
+    const char *text;
+    int position;
+
+    enum PROPERTY_TOKEN token;
+    int start;
+    char name[PROPERTY_NAME_SIZE];
+    int quoted;
+
+    /**
+     * @brief true while parsing the operands of A[f U g] or E[f U g] ('U' closes the left operand)
+     *
+     */
+    int quantified;
+
+} PROPERTY_PARSER, *PROPERTY_PARSER_P;
+
+/**
+ * @brief the symbols and their tokens (longest first)
+ *
+ */
+static const struct
+{
+    const char *symbol;
+    enum PROPERTY_TOKEN token;
+
+} property_symbols[] = {{"&&", AND_TOKEN},
+                        {"||", OR_TOKEN},
+                        {"->", IMPLIES_TOKEN},
+                        {"<=", LESS_EQUAL_TOKEN},
+                        {">=", GREATER_EQUAL_TOKEN},
+                        {"==", EQUAL_TOKEN},
+                        {"!=", NOT_EQUAL_TOKEN},
+                        {"(", OPEN_TOKEN},
+                        {")", CLOSE_TOKEN},
+                        {"[", OPEN_BRACKET_TOKEN},
+                        {"]", CLOSE_BRACKET_TOKEN},
+                        {"!", NOT_TOKEN},
+                        {"<", LESS_TOKEN},
+                        {">", GREATER_TOKEN},
+                        {"=", EQUAL_TOKEN},
+                        {"+", PLUS_TOKEN},
+                        {"-", MINUS_TOKEN},
+                        {"*", TIMES_TOKEN},
+                        {NULL, UNKNOWN_TOKEN}};
+
+/**
+ * @brief record the first parse error (at the current token)
+ *
+ */
+int property_fail(PROPERTY_PARSER *parser, const char *message, const char *name)
+{
+    PROPERTY *property = parser->property;
+
+    if (property->error[0] == '\0')
+    {
+        snprintf(property->error, PROPERTY_ERROR_SIZE, message, name);
+        property->position = parser->start;
+    }
+
+    return -1;
+}
+
+/**
+ * @brief read the next token
+ *
+ */
+void property_next(PROPERTY_PARSER *parser)
+{
+    const char *text = parser->text;
+    int length = 0;
+
+    while (isspace((unsigned char)text[parser->position]))
+    {
+        parser->position += 1;
+    }
+
+    parser->start = parser->position;
+    parser->quoted = FALSE;
+    parser->name[0] = '\0';
+
+    if (text[parser->position] == '\0')
+    {
+        parser->token = END_TOKEN;
+
+        return;
+    }
+
+    if (text[parser->position] == '"')
+    {
+        parser->position += 1;
+
+        while (text[parser->position] != '\0' && text[parser->position] != '"')
+        {
+            if (length < PROPERTY_NAME_SIZE - 1)
+            {
+                parser->name[length++] = text[parser->position];
+            }
+
+            parser->position += 1;
+        }
+
+        parser->token = text[parser->position] == '"' ? NAME_TOKEN : UNKNOWN_TOKEN;
+        parser->position += text[parser->position] == '"' ? 1 : 0;
+        parser->name[length] = '\0';
+        parser->quoted = TRUE;
+
+        return;
+    }
+
+    if (isalnum((unsigned char)text[parser->position]) || text[parser->position] == '_')
+    {
+        parser->token = isdigit((unsigned char)text[parser->position]) ? NUMBER_TOKEN : NAME_TOKEN;
+
+        while (isalnum((unsigned char)text[parser->position]) || text[parser->position] == '_' ||
+               (parser->token == NAME_TOKEN && text[parser->position] == '.'))
+        {
+            if (length < PROPERTY_NAME_SIZE - 1)
+            {
+                parser->name[length++] = text[parser->position];
+            }
+
+            parser->position += 1;
+        }
+
+        parser->name[length] = '\0';
+
+        return;
+    }
+
+    for (int iSymbol = 0; property_symbols[iSymbol].symbol != NULL; iSymbol++)
+    {
+        size_t size = strlen(property_symbols[iSymbol].symbol);
+
+        if (strncmp(&text[parser->position], property_symbols[iSymbol].symbol, size) == 0)
+        {
+            parser->token = property_symbols[iSymbol].token;
+            parser->position += size;
+
+            return;
+        }
+    }
+
+    parser->token = UNKNOWN_TOKEN;
+}
+
+/**
+ * @brief the token after the current one
+ *
+ */
+enum PROPERTY_TOKEN property_peek(PROPERTY_PARSER *parser)
+{
+    PROPERTY_PARSER lookahead = *parser;
+
+    property_next(&lookahead);
+
+    return lookahead.token;
+}
+
+/**
+ * @brief returns true if the current token is the (unquoted) keyword
+ *
+ */
+int property_is_keyword(PROPERTY_PARSER *parser, const char *keyword)
+{
+
+    return parser->token == NAME_TOKEN && !parser->quoted && strcmp(parser->name, keyword) == 0;
+}
+
+/**
+ * @brief returns true if a token continues a sum or compares it - a keyword followed by one is read as a name
+ *
+ */
+int property_is_arithmetic(enum PROPERTY_TOKEN token)
+{
+
+    return token >= LESS_TOKEN && token <= TIMES_TOKEN;
+}
+
+/**
+ * @brief add a node - returns its index
+ *
+ */
+int property_add(PROPERTY *property, enum PROPERTY_OPERATOR operator, int left, int right)
+{
+    PROPERTY_NODE *node = NULL;
+
+    if (left < 0 && operator >= NOT_OPERATOR)
+    {
+        return -1;
+    }
+
+    if (right < 0 && (operator == AND_OPERATOR || operator == OR_OPERATOR || operator == EU_OPERATOR ||
+                      operator == UNTIL_OPERATOR || operator == RELEASE_OPERATOR))
+    {
+        return -1;
+    }
+
+    if (property->count == property->capacity)
+    {
+        property->capacity *= 2;
+        property->nodes = realloc(property->nodes, sizeof(PROPERTY_NODE) * property->capacity);
+    }
+
+    node = &property->nodes[property->count];
+
+    node->operator = operator;
+    node->left = left;
+    node->right = right;
+    node->comparison = EQUAL_COMPARISON;
+    node->termStart = 0;
+    node->termEnd = 0;
+    node->constant = 0;
+    node->transition = -1;
+
+    return property->count++;
+}
+
+/**
+ * @brief add a term to the comparison being parsed
+ *
+ */
+void property_add_term(PROPERTY *property, int place, long long coefficient)
+{
+
+    if (property->termCount == property->termCapacity)
+    {
+        property->termCapacity *= 2;
+        property->termPlaces = realloc(property->termPlaces, sizeof(int) * property->termCapacity);
+        property->termCoefficients = realloc(property->termCoefficients, sizeof(long long) * property->termCapacity);
+    }
+
+    property->termPlaces[property->termCount] = place;
+    property->termCoefficients[property->termCount++] = coefficient;
+}
+
+/**
+ * @brief find a place (or transition) by name - returns -1 if there is none
+ *
+ */
+int property_find(char **names, int count, const char *name)
+{
+
+    for (int iName = 0; iName < count; iName++)
+    {
+        if (names[iName] != NULL && strcmp(names[iName], name) == 0)
+        {
+            return iName;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * @brief parse a sum of places and integers - the terms are added with the sign given, returns false on an error
+ *
+ */
+int property_parse_sum(PROPERTY_PARSER *parser, long long sign, long long *constant)
+{
+    PROPERTY *property = parser->property;
+
+    for (;;)
+    {
+        long long termSign = sign;
+        long long coefficient = 1;
+        int place = -1;
+
+        while (parser->token == MINUS_TOKEN)
+        {
+            termSign = -termSign;
+            property_next(parser);
+        }
+
+        if (parser->token == NUMBER_TOKEN)
+        {
+            coefficient = atoll(parser->name);
+            property_next(parser);
+
+            if (parser->token != TIMES_TOKEN)
+            {
+                *constant += termSign * coefficient;
+                place = -2;
+            }
+            else
+            {
+                property_next(parser);
+            }
+        }
+
+        if (place == -1)
+        {
+            if (parser->token != NAME_TOKEN)
+            {
+                property_fail(parser, "expected a place", NULL);
+
+                return FALSE;
+            }
+
+            if ((place = property_find(property->model->placeNames, property->model->places, parser->name)) < 0)
+            {
+                property_fail(parser, "unknown place '%s'", parser->name);
+
+                return FALSE;
+            }
+
+            property_add_term(property, place, termSign * coefficient);
+            property_next(parser);
+        }
+
+        // a '-' is read as the next term's sign
+        if (parser->token == PLUS_TOKEN)
+        {
+            property_next(parser);
+        }
+        else if (parser->token != MINUS_TOKEN)
+        {
+            return TRUE;
+        }
+    }
+}
+
+/**
+ * @brief parse a comparison of two sums
+ *
+ */
+int property_parse_comparison(PROPERTY_PARSER *parser)
+{
+    PROPERTY *property = parser->property;
+    int termStart = property->termCount;
+    long long constant = 0;
+    int comparison = 0;
+    int node = -1;
+
+    if (parser->token != NAME_TOKEN && parser->token != NUMBER_TOKEN && parser->token != MINUS_TOKEN)
+    {
+        return property_fail(parser, "expected a proposition", NULL);
+    }
+
+    if (!property_parse_sum(parser, 1, &constant))
+    {
+        return -1;
+    }
+
+    if (parser->token < LESS_TOKEN || parser->token > NOT_EQUAL_TOKEN)
+    {
+        return property_fail(parser, "expected a comparison", NULL);
+    }
+
+    comparison = LESS_COMPARISON + (parser->token - LESS_TOKEN);
+
+    property_next(parser);
+
+    if (!property_parse_sum(parser, -1, &constant))
+    {
+        return -1;
+    }
+
+    node = property_add(property, COMPARE_OPERATOR, -1, -1);
+
+    property->nodes[node].comparison = comparison;
+    property->nodes[node].termStart = termStart;
+    property->nodes[node].termEnd = property->termCount;
+    property->nodes[node].constant = constant;
+
+    return node;
+}
+
+int property_parse_implication(PROPERTY_PARSER *parser);
+
+/**
+ * @brief parse the operand of a unary operator
+ *
+ */
+int property_parse_unary(PROPERTY_PARSER *parser);
+
+/**
+ * @brief parse A[f U g] or E[f U g] - A[f U g] is !E[!g U (!f && !g)] && !EG !g
+ *
+ */
+int property_parse_quantified(PROPERTY_PARSER *parser, int universal)
+{
+    PROPERTY *property = parser->property;
+    int quantified = parser->quantified;
+    int left = -1;
+    int right = -1;
+
+    property_next(parser);
+    property_next(parser);
+
+    parser->quantified = TRUE;
+
+    left = property_parse_implication(parser);
+
+    if (left >= 0 && !property_is_keyword(parser, "U"))
+    {
+        left = property_fail(parser, "expected 'U'", NULL);
+    }
+
+    if (left >= 0)
+    {
+        property_next(parser);
+
+        right = property_parse_implication(parser);
+    }
+
+    parser->quantified = quantified;
+
+    if (right >= 0 && parser->token != CLOSE_BRACKET_TOKEN)
+    {
+        right = property_fail(parser, "expected ']'", NULL);
+    }
+
+    if (right < 0)
+    {
+        return -1;
+    }
+
+    property_next(parser);
+
+    if (!universal)
+    {
+        return property_add(property, EU_OPERATOR, left, right);
+    }
+
+    right = property_add(property, NOT_OPERATOR, right, -1);
+    left = property_add(property, AND_OPERATOR, property_add(property, NOT_OPERATOR, left, -1), right);
+
+    return property_add(
+        property, AND_OPERATOR,
+        property_add(property, NOT_OPERATOR, property_add(property, EU_OPERATOR, right, left), -1),
+        property_add(property, NOT_OPERATOR, property_add(property, EG_OPERATOR, right, -1), -1));
+}
+
+/**
+ * @brief parse a prefix temporal operator (CTL or LTL) and its operand
+ *
+ */
+int property_parse_temporal(PROPERTY_PARSER *parser)
+{
+    PROPERTY *property = parser->property;
+    char keyword[3];
+    int operand = -1;
+
+    strcpy(keyword, parser->name);
+
+    property_next(parser);
+
+    if ((operand = property_parse_unary(parser)) < 0)
+    {
+        return -1;
+    }
+
+    if (strcmp(keyword, "EX") == 0)
+    {
+        return property_add(property, EX_OPERATOR, operand, -1);
+    }
+    else if (strcmp(keyword, "EF") == 0)
+    {
+        return property_add(property, EU_OPERATOR, property_add(property, TRUE_OPERATOR, -1, -1), operand);
+    }
+    else if (strcmp(keyword, "EG") == 0)
+    {
+        return property_add(property, EG_OPERATOR, operand, -1);
+    }
+    else if (strcmp(keyword, "X") == 0)
+    {
+        return property_add(property, NEXT_OPERATOR, operand, -1);
+    }
+    else if (strcmp(keyword, "F") == 0)
+    {
+        return property_add(property, UNTIL_OPERATOR, property_add(property, TRUE_OPERATOR, -1, -1), operand);
+    }
+    else if (strcmp(keyword, "G") == 0)
+    {
+        return property_add(property, RELEASE_OPERATOR, property_add(property, FALSE_OPERATOR, -1, -1), operand);
+    }
+
+    // the universal operators are the negated existential ones - AX f is !EX !f, AF f is !EG !f, AG f is !EF !f
+    operand = property_add(property, NOT_OPERATOR, operand, -1);
+
+    if (strcmp(keyword, "AX") == 0)
+    {
+        operand = property_add(property, EX_OPERATOR, operand, -1);
+    }
+    else if (strcmp(keyword, "AF") == 0)
+    {
+        operand = property_add(property, EG_OPERATOR, operand, -1);
+    }
+    else
+    {
+        operand = property_add(property, EU_OPERATOR, property_add(property, TRUE_OPERATOR, -1, -1), operand);
+    }
+
+    return property_add(property, NOT_OPERATOR, operand, -1);
+}
+
+/**
+ * @brief parse a constant, dead, enabled(t), a parenthesised property or a comparison
+ *
+ */
+int property_parse_primary(PROPERTY_PARSER *parser)
+{
+    PROPERTY *property = parser->property;
+    int arithmetic = property_is_arithmetic(property_peek(parser));
+    int node = -1;
+
+    if (parser->token == OPEN_TOKEN)
+    {
+        int quantified = parser->quantified;
+
+        property_next(parser);
+
+        parser->quantified = FALSE;
+        node = property_parse_implication(parser);
+        parser->quantified = quantified;
+
+        if (node >= 0 && parser->token != CLOSE_TOKEN)
+        {
+            return property_fail(parser, "expected ')'", NULL);
+        }
+
+        property_next(parser);
+
+        return node;
+    }
+
+    if (!arithmetic && (property_is_keyword(parser, "true") || property_is_keyword(parser, "false") ||
+                        property_is_keyword(parser, "dead")))
+    {
+        node = property_add(property,
+                            parser->name[0] == 't'   ? TRUE_OPERATOR
+                            : parser->name[0] == 'f' ? FALSE_OPERATOR
+                                                     : DEAD_OPERATOR,
+                            -1, -1);
+
+        property_next(parser);
+
+        return node;
+    }
+
+    if (property_is_keyword(parser, "enabled") && property_peek(parser) == OPEN_TOKEN)
+    {
+        int transition = -1;
+
+        property_next(parser);
+        property_next(parser);
+
+        if (parser->token != NAME_TOKEN)
+        {
+            return property_fail(parser, "expected a transition", NULL);
+        }
+
+        if ((transition = property_find(property->model->transitionNames, property->model->transitions,
+                                        parser->name)) < 0)
+        {
+            return property_fail(parser, "unknown transition '%s'", parser->name);
+        }
+
+        property_next(parser);
+
+        if (parser->token != CLOSE_TOKEN)
+        {
+            return property_fail(parser, "expected ')'", NULL);
+        }
+
+        property_next(parser);
+
+        node = property_add(property, ENABLED_OPERATOR, -1, -1);
+        property->nodes[node].transition = transition;
+
+        return node;
+    }
+
+    return property_parse_comparison(parser);
+}
+
+/**
+ * @brief parse a negation, a prefix temporal operator or a primary
+ *
+ */
+int property_parse_unary(PROPERTY_PARSER *parser)
+{
+    static const char *temporal[] = {"AG", "AF", "AX", "EG", "EF", "EX", "G", "F", "X", NULL};
+    enum PROPERTY_TOKEN next = property_peek(parser);
+
+    if (parser->token == NOT_TOKEN)
+    {
+        property_next(parser);
+
+        return property_add(parser->property, NOT_OPERATOR, property_parse_unary(parser), -1);
+    }
+
+    if ((property_is_keyword(parser, "A") || property_is_keyword(parser, "E")) && next == OPEN_BRACKET_TOKEN)
+    {
+        return property_parse_quantified(parser, parser->name[0] == 'A');
+    }
+
+    for (int iKeyword = 0; temporal[iKeyword] != NULL && !property_is_arithmetic(next); iKeyword++)
+    {
+        if (property_is_keyword(parser, temporal[iKeyword]))
+        {
+            return property_parse_temporal(parser);
+        }
+    }
+
+    return property_parse_primary(parser);
+}
+
+/**
+ * @brief parse f U g or f R g (right associative) - not while parsing the left operand of A[f U g]
+ *
+ */
+int property_parse_until(PROPERTY_PARSER *parser)
+{
+    int left = property_parse_unary(parser);
+
+    if (left >= 0 && !parser->quantified && (property_is_keyword(parser, "U") || property_is_keyword(parser, "R")))
+    {
+        enum PROPERTY_OPERATOR operator = parser->name[0] == 'U' ? UNTIL_OPERATOR : RELEASE_OPERATOR;
+
+        property_next(parser);
+
+        return property_add(parser->property, operator, left, property_parse_until(parser));
+    }
+
+    return left;
+}
+
+/**
+ * @brief parse a conjunction
+ *
+ */
+int property_parse_and(PROPERTY_PARSER *parser)
+{
+    int left = property_parse_until(parser);
+
+    while (left >= 0 && parser->token == AND_TOKEN)
+    {
+        property_next(parser);
+
+        left = property_add(parser->property, AND_OPERATOR, left, property_parse_until(parser));
+    }
+
+    return left;
+}
+
+/**
+ * @brief parse a disjunction
+ *
+ */
+int property_parse_or(PROPERTY_PARSER *parser)
+{
+    int left = property_parse_and(parser);
+
+    while (left >= 0 && parser->token == OR_TOKEN)
+    {
+        property_next(parser);
+
+        left = property_add(parser->property, OR_OPERATOR, left, property_parse_and(parser));
+    }
+
+    return left;
+}
+
+/**
+ * @brief parse an implication (right associative) - f -> g is !f || g
+ *
+ */
+int property_parse_implication(PROPERTY_PARSER *parser)
+{
+    int left = property_parse_or(parser);
+
+    if (left >= 0 && parser->token == IMPLIES_TOKEN)
+    {
+        property_next(parser);
+
+        return property_add(parser->property, OR_OPERATOR, property_add(parser->property, NOT_OPERATOR, left, -1),
+                            property_parse_implication(parser));
+    }
+
+    return left;
+}
+
+/**
+ * @brief returns true if an atomic proposition holds of a marking (false for any other node)
+ *
+ */
+int property_holds(PROPERTY *property, int node, const unsigned int *marking)
+{
+    PROPERTY_NODE *atom = &property->nodes[node];
+    MODEL *model = property->model;
+    long long sum = atom->constant;
+
+    switch (atom->operator)
+    {
+    case TRUE_OPERATOR:
+        return TRUE;
+    case COMPARE_OPERATOR:
+        for (int iTerm = atom->termStart; iTerm < atom->termEnd; iTerm++)
+        {
+            sum += property->termCoefficients[iTerm] * marking[property->termPlaces[iTerm]];
+        }
+
+        switch (atom->comparison)
+        {
+        case LESS_COMPARISON:
+            return sum < 0;
+        case LESS_EQUAL_COMPARISON:
+            return sum <= 0;
+        case GREATER_COMPARISON:
+            return sum > 0;
+        case GREATER_EQUAL_COMPARISON:
+            return sum >= 0;
+        case EQUAL_COMPARISON:
+            return sum == 0;
+        default:
+            return sum != 0;
+        }
+    case ENABLED_OPERATOR:
+        for (int iArc = model->inputStart[atom->transition]; iArc < model->inputStart[atom->transition + 1]; iArc++)
+        {
+            if (marking[model->inputPlaces[iArc]] < (unsigned int)model->inputWeights[iArc])
+            {
+                return FALSE;
+            }
+        }
+
+        return TRUE;
+    case DEAD_OPERATOR:
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            int enabled = TRUE;
+
+            for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1] && enabled;
+                 iArc++)
+            {
+                enabled = marking[model->inputPlaces[iArc]] >= (unsigned int)model->inputWeights[iArc];
+            }
+
+            if (enabled)
+            {
+                return FALSE;
+            }
+        }
+
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief release/free the property object
+ *
+ */
+void property_release(PROPERTY *property)
+{
+
+    free(property->nodes);
+    free(property->termPlaces);
+    free(property->termCoefficients);
+
+    free(property);
+}
+
+/**
+ * @brief property constructor - the text is parsed (see error if the root is -1)
+ *
+ */
+PROPERTY *create_property(MODEL *model, const char *text)
+{
+    PROPERTY *property = malloc(sizeof(PROPERTY));
+    PROPERTY_PARSER parser;
+    int ctl = FALSE;
+    int ltl = FALSE;
+
+    property->model = model;
+    property->capacity = 16;
+    property->count = 0;
+    property->nodes = malloc(sizeof(PROPERTY_NODE) * property->capacity);
+    property->termCapacity = 16;
+    property->termCount = 0;
+    property->termPlaces = malloc(sizeof(int) * property->termCapacity);
+    property->termCoefficients = malloc(sizeof(long long) * property->termCapacity);
+    property->logic = CTL_LOGIC;
+    property->error[0] = '\0';
+    property->position = 0;
+
+    parser.property = property;
+    parser.text = text;
+    parser.position = 0;
+    parser.quantified = FALSE;
+
+    property_next(&parser);
+
+    property->root = property_parse_implication(&parser);
+
+    if (property->root >= 0 && parser.token != END_TOKEN)
+    {
+        property->root = property_fail(&parser, "unexpected '%s'", parser.name[0] != '\0' ? parser.name : "symbol");
+    }
+
+    for (int iNode = 0; iNode < property->count && property->root >= 0; iNode++)
+    {
+        enum PROPERTY_OPERATOR operator = property->nodes[iNode].operator;
+
+        ctl = ctl || operator == EX_OPERATOR || operator == EU_OPERATOR || operator == EG_OPERATOR;
+        ltl = ltl || operator == NEXT_OPERATOR || operator == UNTIL_OPERATOR || operator == RELEASE_OPERATOR;
+    }
+
+    if (ctl && ltl)
+    {
+        parser.start = 0;
+        property->root = property_fail(&parser, "the property mixes CTL and LTL operators", NULL);
+    }
+
+    if (property->root < 0 && property->error[0] == '\0')
+    {
+        property_fail(&parser, "unable to parse the property", NULL);
+    }
+
+    property->logic = ltl ? LTL_LOGIC : CTL_LOGIC;
+
+    property->holds = property_holds;
+    property->release = property_release;
+
+    return property;
+}
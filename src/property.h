@@ -0,0 +1,186 @@
+/**
+ * @file property.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - a temporal property (CTL or LTL) of a compiled model, parsed from text
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef PROPERTY_H_INCLUDED
+#define PROPERTY_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a property
+ *
+ */
+#define TO_PROPERTY(property) ((PROPERTY *)(property))
+
+/**
+ * @brief the size of a parse error message
+ *
+ */
+#define PROPERTY_ERROR_SIZE 256
+
+/**
+ * @brief the operators of a property's nodes - the CTL operators are reduced to EX, EU and EG (AG f is !E[true U !f]
+ *        and so on), the LTL operators G and F to R and U (G f is false R f, F f is true U f)
+ *
+ */
+enum PROPERTY_OPERATOR
+{
+    TRUE_OPERATOR = 0,
+    FALSE_OPERATOR,
+    /**
+     * @brief a linear sum of the places' tokens compared to zero
+     *
+     */
+    COMPARE_OPERATOR,
+    /**
+     * @brief a transition is enabled
+     *
+     */
+    ENABLED_OPERATOR,
+    /**
+     * @brief no transition is enabled
+     *
+     */
+    DEAD_OPERATOR,
+    NOT_OPERATOR,
+    AND_OPERATOR,
+    OR_OPERATOR,
+    EX_OPERATOR,
+    EU_OPERATOR,
+    EG_OPERATOR,
+    NEXT_OPERATOR,
+    UNTIL_OPERATOR,
+    RELEASE_OPERATOR,
+    END_PROPERTY_OPERATORS
+};
+
+/**
+ * @brief the comparison of an atomic proposition's sum with zero
+ *
+ */
+enum PROPERTY_COMPARISON
+{
+    LESS_COMPARISON = 0,
+    LESS_EQUAL_COMPARISON,
+    GREATER_COMPARISON,
+    GREATER_EQUAL_COMPARISON,
+    EQUAL_COMPARISON,
+    NOT_EQUAL_COMPARISON,
+    END_PROPERTY_COMPARISONS
+};
+
+/**
+ * @brief the logic a property is written in - a property without temporal operators holds of the initial marking
+ *        and is checked as CTL
+ *
+ */
+enum PROPERTY_LOGIC
+{
+    CTL_LOGIC = 0,
+    LTL_LOGIC,
+    END_PROPERTY_LOGICS
+};
+
+/**
+ * @brief a node of a property - its operands are the nodes 'left' and 'right' (-1 if none), a comparison's sum is
+ *        the places terms[termStart] .. terms[termEnd] weighted by their coefficients plus the constant
+ *
+ */
+typedef struct _PROPERTY_NODE
+{
+    enum PROPERTY_OPERATOR operator;
+    int left;
+    int right;
+
+    enum PROPERTY_COMPARISON comparison;
+    int termStart;
+    int termEnd;
+    long long constant;
+
+    int transition;
+
+} PROPERTY_NODE, *PROPERTY_NODE_P;
+
+/**
+ * @brief the property's interface - the syntax (loosest first):
+ *          f -> g                      implication (right associative)
+ *          f || g, f && g              disjunction, conjunction
+ *          f U g, f R g                until, release (LTL - right associative)
+ *          !f, AG f, AF f, AX f, EG f, EF f, EX f, A[f U g], E[f U g]     (CTL)
+ *          G f, F f, X f                                                   (LTL)
+ *          true, false, dead, enabled(t), (f)
+ *          a < b, a <= b, a > b, a >= b, a = b, a != b     a and b are sums of places and integers ('2*p + q - 1')
+ *        Names are those of the places and transitions (a name that is not an identifier is quoted - "a name");
+ *        a property mixing CTL and LTL operators is rejected
+ *
+ */
+typedef struct _PROPERTY
+{
+
+    /**
+     * @brief returns true if an atomic proposition (a comparison, enabled or dead) holds of a marking
+     *
+     */
+    int (*holds)(struct _PROPERTY *property, int node, const unsigned int *marking);
+
+    /**
+     * @brief release the property and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _PROPERTY *property);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the nodes and the root (-1 if the text could not be parsed)
+     *
+     */
+    PROPERTY_NODE *nodes;
+    int count;
+    int root;
+
+    /**
+     * @brief the logic of the property
+     *
+     */
+    enum PROPERTY_LOGIC logic;
+
+    /**
+     * @brief the terms of the comparisons - a place and its coefficient
+     *
+     */
+    int *termPlaces;
+    long long *termCoefficients;
+    int termCount;
+
+    /**
+     * @brief why the text could not be parsed and where (empty if it was parsed)
+     *
+     */
+    char error[PROPERTY_ERROR_SIZE];
+    int position;
+
+    /**
+     * @brief private (the capacity of the nodes and the terms)
+     *
+     */
+    int capacity;
+    int termCapacity;
+
+} PROPERTY, *PROPERTY_P;
+
+extern PROPERTY *create_property(MODEL *model, const char *text);
+
+#endif // PROPERTY_H_INCLUDED
@@ -37,6 +37,7 @@
 #include "controller.h"
 
 #include "net.h"
+#include "loader.h"
 
 #include "connector.h"
 #include "mover.h"
@@ -74,7 +75,7 @@ void reader_process_graphics(READER *reader, xmlNode *parent, NODE *node)
             attribute = attribute->next;
         }
 
-        node->setPosition(node, x, y);
+        node->operations->setPosition(node, x, y);
     }
 }
 
@@ -82,7 +83,7 @@ void reader_process_graphics(READER *reader, xmlNode *parent, NODE *node)
  * Process the vertex nodes
  *
  */
-VERTEX * reader_process_vertix(READER *reader, enum POSITION position,  xmlNode *node)
+VERTEX * reader_process_vertix(READER *reader, enum POSITION position,  xmlNode *node, NET *net)
 {
     POINT point;
 
@@ -112,7 +113,7 @@ VERTEX * reader_process_vertix(READER *reader, enum POSITION position,  xmlNode
 
     }
 
-    return create_vertex(position, &point);
+    return create_vertex(position, &point, net);
 
 }
 
@@ -133,9 +134,9 @@ void reader_process_vertices(READER *reader, ARC * arc, int nVertices, xmlNode *
             if (strcmp(node->name, VERTEX_ELEMENT) == 0)
             {
                 vertex = reader_process_vertix(reader, iVertex == 0 ? SOURCE_POSITION : 
-                    iVertex == nVertices ? TARGET_POSITION : CONTROL_POSITION, node);
+                    iVertex == nVertices ? TARGET_POSITION : CONTROL_POSITION, node, arc->net);
 
-                arc->addVertex(arc, vertex);
+                arc->operations->addVertex(arc, vertex);
             }
 
         }
@@ -233,7 +234,7 @@ void reader_process_transition(READER *reader, NET *net, xmlNode *node)
 
         if (strcmp(attribute->name, "name") == 0)
         {
-            transition->setName(transition, value);
+            transition->operations->setName(transition, value);
         }
 
         if (strcmp(attribute->name, "id") == 0)
@@ -246,6 +247,11 @@ void reader_process_transition(READER *reader, NET *net, xmlNode *node)
             transition->alignment = atoi(value);
         }
 
+        if (strcmp(attribute->name, DURATION_ATTRIBUTE) == 0)
+        {
+            transition->transition.duration = atoi(value);
+        }
+
         xmlFree(value);
 
         attribute = attribute->next;
@@ -276,7 +282,7 @@ void reader_process_place(READER *reader, NET *net, xmlNode *node)
 
         if (strcmp(attribute->name, "name") == 0)
         {
-            place->setName(place, value);
+            place->operations->setName(place, value);
         }
 
         if (strcmp(attribute->name, "id") == 0)
@@ -294,6 +300,11 @@ void reader_process_place(READER *reader, NET *net, xmlNode *node)
             place->place.marked = atoi(value);
         }
 
+        if (strcmp(attribute->name, BOUND_ATTRIBUTE) == 0)
+        {
+            place->place.bound = atoi(value);
+        }
+
         xmlFree(value);
 
         attribute = attribute->next;
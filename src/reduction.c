@@ -0,0 +1,321 @@
+/**
+ * @file reduction.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  stubborn set (partial order) reduction of the transitions expanded in a marking
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "reduction.h"
+
+/**
+ * @brief returns true if the transition is enabled in the marking
+ *
+ */
+int reduction_is_enabled(MODEL *model, const unsigned int *marking, int transition)
+{
+
+    for (int iArc = model->inputStart[transition]; iArc < model->inputStart[transition + 1]; iArc++)
+    {
+        if (marking[model->inputPlaces[iArc]] < (unsigned int)model->inputWeights[iArc])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief an input place of a disabled transition that holds too few tokens (the scapegoat) - the one with the
+ *        fewest producers is chosen
+ *
+ */
+int reduction_scapegoat(REDUCTION *reduction, const unsigned int *marking, int transition)
+{
+    MODEL *model = reduction->model;
+    int scapegoat = -1;
+
+    for (int iArc = model->inputStart[transition]; iArc < model->inputStart[transition + 1]; iArc++)
+    {
+        int place = model->inputPlaces[iArc];
+
+        if (marking[place] < (unsigned int)model->inputWeights[iArc] &&
+            (scapegoat < 0 || reduction->producerStart[place + 1] - reduction->producerStart[place] <
+                                  reduction->producerStart[scapegoat + 1] - reduction->producerStart[scapegoat]))
+        {
+            scapegoat = place;
+        }
+    }
+
+    return scapegoat;
+}
+
+/**
+ * @brief build the stubborn set closed from a seed - returns the number of enabled transitions (held in 'enabled')
+ *
+ */
+int reduction_close(REDUCTION *reduction, const unsigned int *marking, int seed, int *enabled, int *held, int *stack)
+{
+    MODEL *model = reduction->model;
+    int visibleHeld = FALSE;
+    int count = 0;
+    int top = 0;
+
+    memset(held, 0, sizeof(int) * model->transitions);
+
+    held[seed] = TRUE;
+    stack[top++] = seed;
+
+    while (top > 0)
+    {
+        int transition = stack[--top];
+
+        if (reduction_is_enabled(model, marking, transition))
+        {
+            enabled[count++] = transition;
+
+            for (int iConflict = reduction->conflictStart[transition];
+                 iConflict < reduction->conflictStart[transition + 1]; iConflict++)
+            {
+                if (!held[reduction->conflicts[iConflict]])
+                {
+                    held[reduction->conflicts[iConflict]] = TRUE;
+                    stack[top++] = reduction->conflicts[iConflict];
+                }
+            }
+
+            if (reduction->mode == SAFETY_REDUCTION && reduction->visible[transition] && !visibleHeld)
+            {
+                visibleHeld = TRUE;
+
+                for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+                {
+                    if (reduction->visible[iTransition] && !held[iTransition])
+                    {
+                        held[iTransition] = TRUE;
+                        stack[top++] = iTransition;
+                    }
+                }
+            }
+        }
+        else
+        {
+            int place = reduction_scapegoat(reduction, marking, transition);
+
+            for (int iProducer = reduction->producerStart[place]; iProducer < reduction->producerStart[place + 1];
+                 iProducer++)
+            {
+                if (!held[reduction->producers[iProducer]])
+                {
+                    held[reduction->producers[iProducer]] = TRUE;
+                    stack[top++] = reduction->producers[iProducer];
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief choose the enabled transitions of the smallest acceptable stubborn set found from the first few enabled
+ *        seeds (every set is acceptable if 'accept' is NULL)
+ *
+ */
+int reduction_select(REDUCTION *reduction, const unsigned int *marking, int *chosen, int *work,
+                     int (*accept)(void *data, const int *transitions, int count), void *data)
+{
+    MODEL *model = reduction->model;
+    int *enabled = work;
+    int *held = work + model->transitions;
+    int *stack = work + model->transitions * 2;
+    int best = 0;
+    int seeds = 0;
+
+    for (int iTransition = 0; iTransition < model->transitions && seeds < REDUCTION_SEEDS; iTransition++)
+    {
+        int count = 0;
+
+        if (!reduction_is_enabled(model, marking, iTransition))
+        {
+            continue;
+        }
+
+        seeds += 1;
+
+        count = reduction_close(reduction, marking, iTransition, enabled, held, stack);
+
+        if ((best == 0 || count < best) && (accept == NULL || accept(data, enabled, count)))
+        {
+            memcpy(chosen, enabled, sizeof(int) * count);
+
+            best = count;
+        }
+
+        if (best == 1)
+        {
+            break;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief build the producer rows (per place) from the change rows
+ *
+ */
+void reduction_compile_producers(REDUCTION *reduction)
+{
+    MODEL *model = reduction->model;
+    int *next = NULL;
+
+    reduction->producerStart = calloc(model->places + 1, sizeof(int));
+    reduction->producers = malloc(sizeof(int) * (model->changeStart[model->transitions] + 1));
+
+    for (int iChange = 0; iChange < model->changeStart[model->transitions]; iChange++)
+    {
+        if (model->changeValues[iChange] > 0)
+        {
+            reduction->producerStart[model->changePlaces[iChange] + 1] += 1;
+        }
+    }
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        reduction->producerStart[iPlace + 1] += reduction->producerStart[iPlace];
+    }
+
+    next = malloc(sizeof(int) * (model->places + 1));
+
+    memcpy(next, reduction->producerStart, sizeof(int) * (model->places + 1));
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        for (int iChange = model->changeStart[iTransition]; iChange < model->changeStart[iTransition + 1]; iChange++)
+        {
+            if (model->changeValues[iChange] > 0)
+            {
+                reduction->producers[next[model->changePlaces[iChange]]++] = iTransition;
+            }
+        }
+    }
+
+    free(next);
+}
+
+/**
+ * @brief build the conflict rows (per transition) - the consumers of each input place, without duplicates
+ *
+ */
+void reduction_compile_conflicts(REDUCTION *reduction)
+{
+    MODEL *model = reduction->model;
+    int *seen = malloc(sizeof(int) * (model->transitions + 1));
+    int capacity = 64;
+    int count = 0;
+
+    reduction->conflictStart = malloc(sizeof(int) * (model->transitions + 1));
+    reduction->conflicts = malloc(sizeof(int) * capacity);
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        seen[iTransition] = -1;
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        reduction->conflictStart[iTransition] = count;
+
+        for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1]; iArc++)
+        {
+            int place = model->inputPlaces[iArc];
+
+            for (int iConsumer = model->consumerStart[place]; iConsumer < model->consumerStart[place + 1]; iConsumer++)
+            {
+                int consumer = model->consumerTransitions[iConsumer];
+
+                if (consumer == iTransition || seen[consumer] == iTransition)
+                {
+                    continue;
+                }
+
+                if (count == capacity)
+                {
+                    capacity *= 2;
+                    reduction->conflicts = realloc(reduction->conflicts, sizeof(int) * capacity);
+                }
+
+                seen[consumer] = iTransition;
+                reduction->conflicts[count++] = consumer;
+            }
+        }
+    }
+
+    reduction->conflictStart[model->transitions] = count;
+
+    free(seen);
+}
+
+/**
+ * @brief release/free the reduction object
+ *
+ */
+void reduction_release(REDUCTION *reduction)
+{
+
+    free(reduction->conflictStart);
+    free(reduction->conflicts);
+    free(reduction->producerStart);
+    free(reduction->producers);
+    free(reduction->visible);
+
+    free(reduction);
+}
+
+/**
+ * @brief reduction constructor - the observed places decide the visible transitions (SAFETY_REDUCTION only)
+ *
+ */
+REDUCTION *create_reduction(MODEL *model, enum REDUCTION_MODE mode, const int *observed, int observedCount)
+{
+    REDUCTION *reduction = malloc(sizeof(REDUCTION));
+
+    reduction->model = model;
+    reduction->mode = mode;
+
+    reduction_compile_conflicts(reduction);
+    reduction_compile_producers(reduction);
+
+    reduction->visible = calloc(model->transitions + 1, sizeof(int));
+    reduction->visibleCount = 0;
+
+    for (int iTransition = 0; iTransition < model->transitions && mode == SAFETY_REDUCTION; iTransition++)
+    {
+        for (int iChange = model->changeStart[iTransition]; iChange < model->changeStart[iTransition + 1]; iChange++)
+        {
+            for (int iObserved = 0; iObserved < observedCount; iObserved++)
+            {
+                if (model->changePlaces[iChange] == observed[iObserved])
+                {
+                    reduction->visible[iTransition] = TRUE;
+                }
+            }
+        }
+
+        reduction->visibleCount += reduction->visible[iTransition];
+    }
+
+    reduction->select = reduction_select;
+    reduction->release = reduction_release;
+
+    return reduction;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file reduction.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - stubborn set (partial order) reduction of the transitions expanded in a marking
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef REDUCTION_H_INCLUDED
+#define REDUCTION_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a reduction
+ *
+ */
+#define TO_REDUCTION(reduction) ((REDUCTION *)(reduction))
+
+/**
+ * @brief the most enabled transitions tried as the seed of a stubborn set
+ *
+ */
+#define REDUCTION_SEEDS 8
+
+/**
+ * @brief the number of work entries select needs
+ *
+ */
+#define REDUCTION_WORK_SIZE(transitions) ((transitions) * 3 + 1)
+
+/**
+ * @brief what the reduction preserves
+ *
+ */
+enum REDUCTION_MODE
+{
+    DEADLOCK_REDUCTION = 0,
+    SAFETY_REDUCTION,
+    END_REDUCTION_MODES
+};
+
+/**
+ * @brief the reduction's interface - the dependency relation is computed once from the arcs: two transitions
+ *        conflict if they consume from a common place, and a place's producers are the transitions that add
+ *        to it. In SAFETY_REDUCTION mode a set that holds an enabled visible transition (one that changes an
+ *        observed place) holds them all - the explorer must also fully expand a state when a reduced successor
+ *        was already held (the cycle proviso)
+ *
+ */
+typedef struct _REDUCTION
+{
+
+    /**
+     * @brief choose the enabled transitions of a stubborn set for the marking - returns the number chosen (zero if
+     *        the marking is dead or no set was accepted); 'accept' (may be NULL) may reject a candidate set, and
+     *        'chosen' and 'work' are supplied by the caller so one reduction can be shared by several threads
+     *        (see REDUCTION_WORK_SIZE)
+     *
+     */
+    int (*select)(struct _REDUCTION *reduction, const unsigned int *marking, int *chosen, int *work,
+                  int (*accept)(void *data, const int *transitions, int count), void *data);
+
+    /**
+     * @brief release the reduction and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _REDUCTION *reduction);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief what the reduction preserves
+     *
+     */
+    enum REDUCTION_MODE mode;
+
+    /**
+     * @brief the transitions consuming from the input places of each transition (compressed rows)
+     *
+     */
+    int *conflictStart;
+    int *conflicts;
+
+    /**
+     * @brief the transitions adding tokens to each place (compressed rows)
+     *
+     */
+    int *producerStart;
+    int *producers;
+
+    /**
+     * @brief the visible transitions (SAFETY_REDUCTION only)
+     *
+     */
+    int *visible;
+    int visibleCount;
+
+} REDUCTION, *REDUCTION_P;
+
+extern REDUCTION *create_reduction(MODEL *model, enum REDUCTION_MODE mode, const int *observed, int observedCount);
+
+extern int reduction_is_enabled(MODEL *model, const unsigned int *marking, int transition);
+
+#endif // REDUCTION_H_INCLUDED
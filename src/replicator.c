@@ -0,0 +1,444 @@
+/**
+ * @file replicator.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  runs independent replications of a timed simulation of a compiled model on a pool of threads
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "explorer.h"
+#include "timed.h"
+#include "replicator.h"
+
+/**
+ * @brief the default seed the replications' seeds are derived from
+ *
+ */
+#define REPLICATOR_SEED 0x2545F4914F6CDD1DULL
+
+/**
+ * @brief the characters a transition's row may take besides the transition's name
+ *
+ */
+#define REPLICATOR_ROW_SIZE 128
+
+/**
+ * @brief private structure - the statistics a thread reduces its replications into (running means and sums of
+ *        squared deviations)
+ *
+ */
+typedef struct _REPLICATOR_STATISTICS
+{
+    long count;
+    long dead;
+    long zeno;
+    long events;
+
+    double *throughputMeans;
+    double *throughputSquares;
+    double *utilisationMeans;
+    double *utilisationSquares;
+
+    long *histograms;
+
+} REPLICATOR_STATISTICS, *REPLICATOR_STATISTICS_P;
+
+/**
+ * @brief private structure - the state shared by the threads during a run
+ *
+ */
+typedef struct _REPLICATOR_RUN
+{
+    REPLICATOR *replicator;
+
+    /**
+     * @brief the next replication to be run
+     *
+     */
+    atomic_long next;
+
+    long replications;
+    long long horizon;
+
+    FILE *csv;
+    pthread_mutex_t csvLock;
+
+} REPLICATOR_RUN, *REPLICATOR_RUN_P;
+
+/**
+ * @brief private structure - a thread's context
+ *
+ */
+typedef struct _REPLICATOR_WORKER
+{
+    REPLICATOR_RUN *run;
+    pthread_t thread;
+
+    TIMED_SIMULATOR *simulator;
+    REPLICATOR_STATISTICS statistics;
+
+    /**
+     * @brief the rows of the replication being written
+     *
+     */
+    char *rows;
+    size_t rowCapacity;
+
+} REPLICATOR_WORKER, *REPLICATOR_WORKER_P;
+
+/**
+ * @brief the seed of a replication (splitmix64 of the replicator's seed and the replication) - never zero
+ *
+ */
+unsigned long long replicator_seed(unsigned long long seed, long replication)
+{
+    unsigned long long value = seed + 0x9E3779B97F4A7C15ULL * (unsigned long long)(replication + 1);
+
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+
+    return value == 0 ? REPLICATOR_SEED : value;
+}
+
+/**
+ * @brief set up empty statistics
+ *
+ */
+void replicator_setup_statistics(REPLICATOR_STATISTICS *statistics, int transitions)
+{
+
+    statistics->count = 0;
+    statistics->dead = 0;
+    statistics->zeno = 0;
+    statistics->events = 0;
+
+    statistics->throughputMeans = calloc(transitions + 1, sizeof(double));
+    statistics->throughputSquares = calloc(transitions + 1, sizeof(double));
+    statistics->utilisationMeans = calloc(transitions + 1, sizeof(double));
+    statistics->utilisationSquares = calloc(transitions + 1, sizeof(double));
+    statistics->histograms = calloc((size_t)(transitions + 1) * REPLICATOR_BINS, sizeof(long));
+}
+
+/**
+ * @brief free the statistics' arrays
+ *
+ */
+void replicator_free_statistics(REPLICATOR_STATISTICS *statistics)
+{
+
+    free(statistics->throughputMeans);
+    free(statistics->throughputSquares);
+    free(statistics->utilisationMeans);
+    free(statistics->utilisationSquares);
+    free(statistics->histograms);
+}
+
+/**
+ * @brief add a value to a running mean and sum of squared deviations (Welford)
+ *
+ */
+void replicator_accumulate(double *mean, double *squares, long count, double value)
+{
+    double delta = value - *mean;
+
+    *mean += delta / count;
+    *squares += delta * (value - *mean);
+}
+
+/**
+ * @brief combine a running mean and sum of squared deviations with another's (Chan et al.)
+ *
+ */
+void replicator_combine(double *mean, double *squares, long count, double otherMean, double otherSquares,
+                        long otherCount)
+{
+    double delta = otherMean - *mean;
+    long total = count + otherCount;
+
+    if (otherCount == 0)
+    {
+        return;
+    }
+
+    *squares += otherSquares + delta * delta * ((double)count * otherCount / total);
+    *mean += delta * ((double)otherCount / total);
+}
+
+/**
+ * @brief add a replication's results to the thread's statistics - a zeno replication (stopped without time passing)
+ *        has no throughput or utilisation and is only counted
+ *
+ */
+void replicator_reduce(REPLICATOR_WORKER *worker)
+{
+    TIMED_SIMULATOR *simulator = worker->simulator;
+    REPLICATOR_STATISTICS *statistics = &worker->statistics;
+
+    statistics->events += simulator->events;
+
+    if (simulator->zeno)
+    {
+        statistics->zeno += 1;
+
+        return;
+    }
+
+    statistics->count += 1;
+    statistics->dead += simulator->dead ? 1 : 0;
+
+    for (int iTransition = 0; iTransition < simulator->model->transitions; iTransition++)
+    {
+        double utilisation = simulator->utilisation(simulator, iTransition);
+        int bin = (int)(utilisation * REPLICATOR_BINS);
+
+        bin = bin < REPLICATOR_BINS ? bin : REPLICATOR_BINS - 1;
+
+        replicator_accumulate(&statistics->throughputMeans[iTransition], &statistics->throughputSquares[iTransition],
+                              statistics->count, simulator->throughput(simulator, iTransition));
+        replicator_accumulate(&statistics->utilisationMeans[iTransition],
+                              &statistics->utilisationSquares[iTransition], statistics->count, utilisation);
+
+        statistics->histograms[iTransition * REPLICATOR_BINS + bin] += 1;
+    }
+}
+
+/**
+ * @brief write a replication's rows - they are formatted first so the file is locked once per replication
+ *
+ */
+void replicator_write(REPLICATOR_WORKER *worker, long replication)
+{
+    TIMED_SIMULATOR *simulator = worker->simulator;
+    MODEL *model = simulator->model;
+    size_t length = 0;
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        length += snprintf(worker->rows + length, worker->rowCapacity - length, "%ld,%lld,%d,%d,%s,%ld,%.9g,%.9g\n",
+                           replication, simulator->now, simulator->dead, simulator->zeno,
+                           model->transitionNames[iTransition], simulator->completions[iTransition], simulator->throughput(simulator, iTransition),
+                           simulator->utilisation(simulator, iTransition));
+    }
+
+    pthread_mutex_lock(&worker->run->csvLock);
+
+    fwrite(worker->rows, 1, length, worker->run->csv);
+
+    pthread_mutex_unlock(&worker->run->csvLock);
+}
+
+/**
+ * @brief a thread's main loop - run replications until none are left
+ *
+ */
+void *replicator_work(void *data)
+{
+    REPLICATOR_WORKER *worker = data;
+    REPLICATOR_RUN *run = worker->run;
+    TIMED_SIMULATOR *simulator = worker->simulator;
+    long replication = 0;
+
+    while ((replication = atomic_fetch_add(&run->next, 1)) < run->replications)
+    {
+        simulator->reset(simulator);
+        simulator->seed(simulator, replicator_seed(run->replicator->seed, replication));
+        simulator->run(simulator, run->horizon, 0);
+
+        replicator_reduce(worker);
+
+        if (run->csv != NULL)
+        {
+            replicator_write(worker, replication);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief combine the threads' statistics into the replicator's results
+ *
+ */
+void replicator_collect(REPLICATOR *replicator, REPLICATOR_WORKER *workers)
+{
+    int transitions = replicator->model->transitions;
+    REPLICATOR_STATISTICS total;
+
+    replicator_setup_statistics(&total, transitions);
+
+    for (int iThread = 0; iThread < replicator->threads; iThread++)
+    {
+        REPLICATOR_STATISTICS *statistics = &workers[iThread].statistics;
+
+        for (int iTransition = 0; iTransition < transitions; iTransition++)
+        {
+            replicator_combine(&total.throughputMeans[iTransition], &total.throughputSquares[iTransition],
+                               total.count, statistics->throughputMeans[iTransition],
+                               statistics->throughputSquares[iTransition], statistics->count);
+            replicator_combine(&total.utilisationMeans[iTransition], &total.utilisationSquares[iTransition],
+                               total.count, statistics->utilisationMeans[iTransition],
+                               statistics->utilisationSquares[iTransition], statistics->count);
+        }
+
+        for (int iBin = 0; iBin < transitions * REPLICATOR_BINS; iBin++)
+        {
+            total.histograms[iBin] += statistics->histograms[iBin];
+        }
+
+        total.count += statistics->count;
+        total.dead += statistics->dead;
+        total.zeno += statistics->zeno;
+        total.events += statistics->events;
+    }
+
+    replicator->replications = total.count + total.zeno;
+    replicator->dead = total.dead;
+    replicator->zeno = total.zeno;
+    replicator->events = total.events;
+
+    for (int iTransition = 0; iTransition < transitions; iTransition++)
+    {
+        replicator->throughputMeans[iTransition] = total.throughputMeans[iTransition];
+        replicator->utilisationMeans[iTransition] = total.utilisationMeans[iTransition];
+        replicator->throughputVariances[iTransition] =
+            total.count > 1 ? total.throughputSquares[iTransition] / (total.count - 1) : 0;
+        replicator->utilisationVariances[iTransition] =
+            total.count > 1 ? total.utilisationSquares[iTransition] / (total.count - 1) : 0;
+    }
+
+    memcpy(replicator->histograms, total.histograms, sizeof(long) * transitions * REPLICATOR_BINS);
+
+    replicator_free_statistics(&total);
+}
+
+/**
+ * @brief run the replications on the replicator's threads
+ *
+ */
+long replicator_run(REPLICATOR *replicator, long replications, long long horizon, FILE *csv)
+{
+    MODEL *model = replicator->model;
+    REPLICATOR_WORKER *workers = malloc(sizeof(REPLICATOR_WORKER) * replicator->threads);
+    REPLICATOR_RUN run;
+    double started = explorer_clock();
+    size_t rowCapacity = 1;
+
+    run.replicator = replicator;
+    run.replications = replications;
+    run.horizon = horizon;
+    run.csv = csv;
+
+    atomic_init(&run.next, 0);
+    pthread_mutex_init(&run.csvLock, NULL);
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        rowCapacity += strlen(model->transitionNames[iTransition]) + REPLICATOR_ROW_SIZE;
+    }
+
+    if (csv != NULL)
+    {
+        fprintf(csv, "replication,time,dead,zeno,transition,completions,throughput,utilisation\n");
+    }
+
+    for (int iThread = 0; iThread < replicator->threads; iThread++)
+    {
+        REPLICATOR_WORKER *worker = &workers[iThread];
+
+        worker->run = &run;
+        worker->simulator = create_timed_simulator(model);
+        worker->simulator->stochastic = replicator->stochastic;
+        worker->rows = malloc(rowCapacity);
+        worker->rowCapacity = rowCapacity;
+
+        replicator_setup_statistics(&worker->statistics, model->transitions);
+
+        pthread_create(&worker->thread, NULL, replicator_work, worker);
+    }
+
+    for (int iThread = 0; iThread < replicator->threads; iThread++)
+    {
+        pthread_join(workers[iThread].thread, NULL);
+    }
+
+    replicator_collect(replicator, workers);
+
+    for (int iThread = 0; iThread < replicator->threads; iThread++)
+    {
+        workers[iThread].simulator->release(workers[iThread].simulator);
+
+        replicator_free_statistics(&workers[iThread].statistics);
+
+        free(workers[iThread].rows);
+    }
+
+    pthread_mutex_destroy(&run.csvLock);
+
+    free(workers);
+
+    replicator->seconds = explorer_clock() - started;
+
+    return replicator->replications;
+}
+
+/**
+ * @brief release/free the replicator object
+ *
+ */
+void replicator_release(REPLICATOR *replicator)
+{
+
+    free(replicator->throughputMeans);
+    free(replicator->throughputVariances);
+    free(replicator->utilisationMeans);
+    free(replicator->utilisationVariances);
+    free(replicator->histograms);
+
+    free(replicator);
+}
+
+/**
+ * @brief replicator constructor
+ *
+ */
+REPLICATOR *create_replicator(MODEL *model, int threads)
+{
+    REPLICATOR *replicator = malloc(sizeof(REPLICATOR));
+    int transitions = model->transitions + 1;
+
+    replicator->model = model;
+    replicator->threads = threads < 1 ? 1 : threads;
+    replicator->seed = REPLICATOR_SEED;
+    replicator->stochastic = TRUE;
+
+    replicator->replications = 0;
+    replicator->dead = 0;
+    replicator->zeno = 0;
+    replicator->events = 0;
+    replicator->seconds = 0;
+
+    replicator->throughputMeans = calloc(transitions, sizeof(double));
+    replicator->throughputVariances = calloc(transitions, sizeof(double));
+    replicator->utilisationMeans = calloc(transitions, sizeof(double));
+    replicator->utilisationVariances = calloc(transitions, sizeof(double));
+    replicator->histograms = calloc((size_t)transitions * REPLICATOR_BINS, sizeof(long));
+
+    replicator->run = replicator_run;
+    replicator->release = replicator_release;
+
+    return replicator;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file replicator.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - runs independent replications of a timed simulation of a compiled model on a pool of threads
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef REPLICATOR_H_INCLUDED
+#define REPLICATOR_H_INCLUDED
+
+#include <stdio.h>
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a replicator
+ *
+ */
+#define TO_REPLICATOR(replicator) ((REPLICATOR *)(replicator))
+
+/**
+ * @brief the number of bins of a transition's utilisation histogram (over 0 .. 1)
+ *
+ */
+#define REPLICATOR_BINS 10
+
+/**
+ * @brief the replicator's interface - each thread owns a timed simulator and takes the next replication until
+ *        every one has been run; replication 'r' is seeded from the replicator's seed and 'r' alone, so the results
+ *        do not depend on the number of threads. The model is shared (read only) by the threads, and each thread
+ *        reduces its replications into its own statistics, which are combined once the threads are done
+ *
+ */
+typedef struct _REPLICATOR
+{
+
+    /**
+     * @brief run the replications, each up to the time 'horizon' - a row per transition of every replication is
+     *        written to 'csv' (may be NULL) as the replication completes; returns the number of replications run
+     *
+     */
+    long (*run)(struct _REPLICATOR *replicator, long replications, long long horizon, FILE *csv);
+
+    /**
+     * @brief release the replicator and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _REPLICATOR *replicator);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the number of threads
+     *
+     */
+    int threads;
+
+    /**
+     * @brief the seed the replications' seeds are derived from
+     *
+     */
+    unsigned long long seed;
+
+    /**
+     * @brief true if the durations are drawn at random (see the timed simulator)
+     *
+     */
+    int stochastic;
+
+    /**
+     * @brief the number of replications run, the number that stopped in a dead marking and the number that stopped
+     *        without time passing (zeno - see TIMED_ZENO_LIMIT, these are left out of the means and variances)
+     *
+     */
+    long replications;
+    long dead;
+    long zeno;
+
+    /**
+     * @brief the completions simulated by every replication
+     *
+     */
+    long events;
+
+    /**
+     * @brief the mean and (sample) variance of each transition's throughput and utilisation over the replications
+     *
+     */
+    double *throughputMeans;
+    double *throughputVariances;
+    double *utilisationMeans;
+    double *utilisationVariances;
+
+    /**
+     * @brief the number of replications in which each transition's utilisation fell in each bin
+     *        (transition * REPLICATOR_BINS + bin)
+     *
+     */
+    long *histograms;
+
+    /**
+     * @brief the time taken by the last run (in seconds)
+     *
+     */
+    double seconds;
+
+} REPLICATOR, *REPLICATOR_P;
+
+extern REPLICATOR *create_replicator(MODEL *model, int threads);
+
+#endif // REPLICATOR_H_INCLUDED
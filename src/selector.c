@@ -80,8 +80,7 @@ void selector_event_handler(EVENT *event, void *processor)
         {
             NODE *node = g_ptr_array_index(nodes, iNode);
 
-            node->edit(node, editor);
-            node->artifact.selected = TRUE;
+            node->operations->edit(node, editor);
             
             TO_SELECTOR(processor)->controller->mode = FINALISE;
         }
@@ -0,0 +1,1041 @@
+/**
+ * @file simplifier.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  reduces a compiled model by structural rules before it is analysed
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "explorer.h"
+#include "simplifier.h"
+
+/**
+ * @brief the longest name given to a fused transition
+ *
+ */
+#define SIMPLIFIER_NAME_SIZE 256
+
+/**
+ * @brief private structure - the arcs of a transition in one direction (sorted by place between passes)
+ *
+ */
+typedef struct _SIMPLIFIER_ARCS
+{
+    int count;
+    int capacity;
+    int *places;
+    int *weights;
+
+} SIMPLIFIER_ARCS, *SIMPLIFIER_ARCS_P;
+
+/**
+ * @brief private structure - a transition a place is joined to, and the tokens it consumes and produces
+ *
+ */
+typedef struct _SIMPLIFIER_LINK
+{
+    int transition;
+    int consumed;
+    int produced;
+
+} SIMPLIFIER_LINK, *SIMPLIFIER_LINK_P;
+
+/**
+ * @brief private structure - the links of every place (built at the start of a pass) and the places and transitions
+ *        changed during the pass (their links are out of date)
+ *
+ */
+typedef struct _SIMPLIFIER_PASS
+{
+    int *linkStart;
+    int *linkCount;
+    SIMPLIFIER_LINK *links;
+
+    int *placeTouched;
+    int *transitionTouched;
+
+} SIMPLIFIER_PASS, *SIMPLIFIER_PASS_P;
+
+/**
+ * @brief private structure - a place's hash (places with the same links have the same hash)
+ *
+ */
+typedef struct _SIMPLIFIER_HASH
+{
+    unsigned int hash;
+    int node;
+
+} SIMPLIFIER_HASH, *SIMPLIFIER_HASH_P;
+
+/**
+ * @brief add to the weight of an arc (the arc is added if there is none)
+ *
+ */
+void simplifier_add_arc(SIMPLIFIER_ARCS *arcs, int place, int weight)
+{
+
+    for (int iArc = 0; iArc < arcs->count; iArc++)
+    {
+        if (arcs->places[iArc] == place)
+        {
+            arcs->weights[iArc] += weight;
+
+            return;
+        }
+    }
+
+    if (arcs->count == arcs->capacity)
+    {
+        arcs->capacity = arcs->capacity * 2 + 4;
+        arcs->places = realloc(arcs->places, sizeof(int) * arcs->capacity);
+        arcs->weights = realloc(arcs->weights, sizeof(int) * arcs->capacity);
+    }
+
+    arcs->places[arcs->count] = place;
+    arcs->weights[arcs->count++] = weight;
+}
+
+/**
+ * @brief remove the arc to a place (if any)
+ *
+ */
+void simplifier_remove_arc(SIMPLIFIER_ARCS *arcs, int place)
+{
+
+    for (int iArc = 0; iArc < arcs->count; iArc++)
+    {
+        if (arcs->places[iArc] == place)
+        {
+            memmove(&arcs->places[iArc], &arcs->places[iArc + 1], sizeof(int) * (arcs->count - iArc - 1));
+            memmove(&arcs->weights[iArc], &arcs->weights[iArc + 1], sizeof(int) * (arcs->count - iArc - 1));
+
+            arcs->count -= 1;
+
+            return;
+        }
+    }
+}
+
+/**
+ * @brief sort the arcs by place
+ *
+ */
+void simplifier_sort_arcs(SIMPLIFIER_ARCS *arcs)
+{
+
+    for (int iArc = 1; iArc < arcs->count; iArc++)
+    {
+        int place = arcs->places[iArc];
+        int weight = arcs->weights[iArc];
+        int iSlot = iArc;
+
+        while (iSlot > 0 && arcs->places[iSlot - 1] > place)
+        {
+            arcs->places[iSlot] = arcs->places[iSlot - 1];
+            arcs->weights[iSlot] = arcs->weights[iSlot - 1];
+            iSlot -= 1;
+        }
+
+        arcs->places[iSlot] = place;
+        arcs->weights[iSlot] = weight;
+    }
+}
+
+/**
+ * @brief returns true if two (sorted) sets of arcs are equal
+ *
+ */
+int simplifier_equal_arcs(SIMPLIFIER_ARCS *first, SIMPLIFIER_ARCS *second)
+{
+
+    return first->count == second->count &&
+           memcmp(first->places, second->places, sizeof(int) * first->count) == 0 &&
+           memcmp(first->weights, second->weights, sizeof(int) * first->count) == 0;
+}
+
+/**
+ * @brief order hashes (then nodes)
+ *
+ */
+int simplifier_compare_hashes(const void *a, const void *b)
+{
+    const SIMPLIFIER_HASH *first = a;
+    const SIMPLIFIER_HASH *second = b;
+
+    if (first->hash != second->hash)
+    {
+        return first->hash < second->hash ? -1 : 1;
+    }
+
+    return first->node - second->node;
+}
+
+/**
+ * @brief mix a value into a hash
+ *
+ */
+unsigned int simplifier_mix(unsigned int hash, unsigned int value)
+{
+
+    return (hash ^ value) * 16777619u;
+}
+
+/**
+ * @brief remove a place - it is recorded so its tokens can be restored
+ *
+ */
+void simplifier_remove_place(SIMPLIFIER *simplifier, int place, enum SIMPLIFIER_FATE fate, int target, int offset)
+{
+
+    simplifier->placeFates[place] = fate;
+    simplifier->placeTargets[place] = target;
+    simplifier->placeOffsets[place] = offset;
+    simplifier->removed[simplifier->removedCount++] = place;
+}
+
+/**
+ * @brief remove a transition and its arcs
+ *
+ */
+void simplifier_remove_transition(SIMPLIFIER *simplifier, int transition, enum SIMPLIFIER_FATE fate, int target)
+{
+
+    simplifier->transitionFates[transition] = fate;
+    simplifier->transitionTargets[transition] = target;
+    simplifier->inputs[transition].count = 0;
+    simplifier->outputs[transition].count = 0;
+}
+
+/**
+ * @brief remove the transitions that can never fire - the places that can be marked are found first (a place is
+ *        marked initially or produced by a transition whose inputs can all be marked); returns the number removed
+ *
+ */
+int simplifier_dead_transitions(SIMPLIFIER *simplifier)
+{
+    MODEL *model = simplifier->model;
+    int *markable = calloc(model->places + 1, sizeof(int));
+    int *fireable = calloc(model->transitions + 1, sizeof(int));
+    int changed = TRUE;
+    int count = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        markable[iPlace] = simplifier->marking[iPlace] > 0;
+    }
+
+    while (changed)
+    {
+        changed = FALSE;
+
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            SIMPLIFIER_ARCS *inputs = &simplifier->inputs[iTransition];
+            int enabled = simplifier->transitionFates[iTransition] == KEPT_FATE && !fireable[iTransition];
+
+            for (int iArc = 0; iArc < inputs->count && enabled; iArc++)
+            {
+                enabled = markable[inputs->places[iArc]];
+            }
+
+            if (!enabled)
+            {
+                continue;
+            }
+
+            fireable[iTransition] = TRUE;
+            changed = TRUE;
+
+            for (int iArc = 0; iArc < simplifier->outputs[iTransition].count; iArc++)
+            {
+                markable[simplifier->outputs[iTransition].places[iArc]] = TRUE;
+            }
+        }
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        if (simplifier->transitionFates[iTransition] == KEPT_FATE && !fireable[iTransition])
+        {
+            simplifier_remove_transition(simplifier, iTransition, DEAD_FATE, -1);
+
+            count += 1;
+        }
+    }
+
+    free(markable);
+    free(fireable);
+
+    return count;
+}
+
+/**
+ * @brief remove the transitions with the same inputs and outputs as an earlier transition (the transitions are hashed
+ *        and only those with the same hash compared); returns the number removed
+ *
+ */
+int simplifier_duplicate_transitions(SIMPLIFIER *simplifier)
+{
+    MODEL *model = simplifier->model;
+    SIMPLIFIER_HASH *hashes = malloc(sizeof(SIMPLIFIER_HASH) * (model->transitions + 1));
+    int count = 0;
+    int kept = 0;
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        SIMPLIFIER_ARCS *inputs = &simplifier->inputs[iTransition];
+        SIMPLIFIER_ARCS *outputs = &simplifier->outputs[iTransition];
+        unsigned int hash = 2166136261u;
+
+        if (simplifier->transitionFates[iTransition] != KEPT_FATE)
+        {
+            continue;
+        }
+
+        for (int iArc = 0; iArc < inputs->count; iArc++)
+        {
+            hash = simplifier_mix(simplifier_mix(hash, inputs->places[iArc]), inputs->weights[iArc]);
+        }
+
+        hash = simplifier_mix(hash, 0xFFFFFFFFu);
+
+        for (int iArc = 0; iArc < outputs->count; iArc++)
+        {
+            hash = simplifier_mix(simplifier_mix(hash, outputs->places[iArc]), outputs->weights[iArc]);
+        }
+
+        hashes[kept].hash = hash;
+        hashes[kept++].node = iTransition;
+    }
+
+    qsort(hashes, kept, sizeof(SIMPLIFIER_HASH), simplifier_compare_hashes);
+
+    for (int iFirst = 0; iFirst < kept; iFirst++)
+    {
+        int first = hashes[iFirst].node;
+
+        for (int iSecond = iFirst + 1; iSecond < kept && hashes[iSecond].hash == hashes[iFirst].hash; iSecond++)
+        {
+            int second = hashes[iSecond].node;
+
+            if (simplifier->transitionFates[first] == KEPT_FATE && simplifier->transitionFates[second] == KEPT_FATE &&
+                simplifier_equal_arcs(&simplifier->inputs[first], &simplifier->inputs[second]) &&
+                simplifier_equal_arcs(&simplifier->outputs[first], &simplifier->outputs[second]))
+            {
+                simplifier_remove_transition(simplifier, second, DUPLICATE_FATE, first);
+
+                count += 1;
+            }
+        }
+    }
+
+    free(hashes);
+
+    return count;
+}
+
+/**
+ * @brief build the links of every place - a transition is linked once however it is joined to the place
+ *
+ */
+void simplifier_link(SIMPLIFIER *simplifier, SIMPLIFIER_PASS *pass)
+{
+    MODEL *model = simplifier->model;
+    int total = 0;
+
+    memset(pass->linkCount, 0, sizeof(int) * (model->places + 1));
+    memset(pass->placeTouched, 0, sizeof(int) * (model->places + 1));
+    memset(pass->transitionTouched, 0, sizeof(int) * (model->transitions + 1));
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        for (int iArc = 0; iArc < simplifier->inputs[iTransition].count; iArc++)
+        {
+            pass->linkCount[simplifier->inputs[iTransition].places[iArc]] += 1;
+        }
+
+        for (int iArc = 0; iArc < simplifier->outputs[iTransition].count; iArc++)
+        {
+            pass->linkCount[simplifier->outputs[iTransition].places[iArc]] += 1;
+        }
+    }
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        pass->linkStart[iPlace] = total;
+        total += pass->linkCount[iPlace];
+        pass->linkCount[iPlace] = 0;
+    }
+
+    pass->links = realloc(pass->links, sizeof(SIMPLIFIER_LINK) * (total + 1));
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        for (int iFlow = 0; iFlow < END_FLOW_TYPES; iFlow++)
+        {
+            SIMPLIFIER_ARCS *arcs = iFlow == INPUT_FLOW ? &simplifier->inputs[iTransition]
+                                                        : &simplifier->outputs[iTransition];
+
+            for (int iArc = 0; iArc < arcs->count; iArc++)
+            {
+                int place = arcs->places[iArc];
+                SIMPLIFIER_LINK *link = &pass->links[pass->linkStart[place] + pass->linkCount[place] - 1];
+
+                // the transitions are visited in order, so a transition's links to a place are adjacent
+                if (pass->linkCount[place] == 0 || link->transition != iTransition)
+                {
+                    link = &pass->links[pass->linkStart[place] + pass->linkCount[place]++];
+
+                    link->transition = iTransition;
+                    link->consumed = 0;
+                    link->produced = 0;
+                }
+
+                if (iFlow == INPUT_FLOW)
+                {
+                    link->consumed += arcs->weights[iArc];
+                }
+                else
+                {
+                    link->produced += arcs->weights[iArc];
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief mark a place and the transitions linked to it as changed
+ *
+ */
+void simplifier_touch_place(SIMPLIFIER_PASS *pass, int place)
+{
+
+    pass->placeTouched[place] = TRUE;
+
+    for (int iLink = pass->linkStart[place]; iLink < pass->linkStart[place] + pass->linkCount[place]; iLink++)
+    {
+        pass->transitionTouched[pass->links[iLink].transition] = TRUE;
+    }
+}
+
+/**
+ * @brief returns true if the place or a transition linked to it changed during the pass
+ *
+ */
+int simplifier_is_touched(SIMPLIFIER_PASS *pass, int place)
+{
+
+    if (pass->placeTouched[place])
+    {
+        return TRUE;
+    }
+
+    for (int iLink = pass->linkStart[place]; iLink < pass->linkStart[place] + pass->linkCount[place]; iLink++)
+    {
+        if (pass->transitionTouched[pass->links[iLink].transition])
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief remove a place from the working net (its arcs are removed)
+ *
+ */
+void simplifier_detach_place(SIMPLIFIER *simplifier, SIMPLIFIER_PASS *pass, int place)
+{
+
+    for (int iLink = pass->linkStart[place]; iLink < pass->linkStart[place] + pass->linkCount[place]; iLink++)
+    {
+        simplifier_remove_arc(&simplifier->inputs[pass->links[iLink].transition], place);
+        simplifier_remove_arc(&simplifier->outputs[pass->links[iLink].transition], place);
+    }
+
+    simplifier_touch_place(pass, place);
+}
+
+/**
+ * @brief remove the places that never change and hold enough tokens for each transition consuming from them (only
+ *        self-loops) - an isolated place is constant; returns the number removed
+ *
+ */
+int simplifier_constant_places(SIMPLIFIER *simplifier, SIMPLIFIER_PASS *pass)
+{
+    MODEL *model = simplifier->model;
+    int count = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        int constant = simplifier->placeFates[iPlace] == KEPT_FATE && !simplifier_is_touched(pass, iPlace);
+
+        for (int iLink = pass->linkStart[iPlace]; iLink < pass->linkStart[iPlace] + pass->linkCount[iPlace] && constant;
+             iLink++)
+        {
+            SIMPLIFIER_LINK *link = &pass->links[iLink];
+
+            constant = link->consumed == link->produced && link->consumed <= simplifier->marking[iPlace];
+        }
+
+        if (constant)
+        {
+            simplifier_detach_place(simplifier, pass, iPlace);
+            simplifier_remove_place(simplifier, iPlace, CONSTANT_FATE, -1, simplifier->marking[iPlace]);
+
+            count += 1;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief returns true if two places have the same links
+ *
+ */
+int simplifier_equal_links(SIMPLIFIER_PASS *pass, int first, int second)
+{
+
+    return pass->linkCount[first] == pass->linkCount[second] &&
+           memcmp(&pass->links[pass->linkStart[first]], &pass->links[pass->linkStart[second]],
+                  sizeof(SIMPLIFIER_LINK) * pass->linkCount[first]) == 0;
+}
+
+/**
+ * @brief remove the places with the same producers and consumers (and weights) as another - the place holding fewer
+ *        tokens is kept (it disables whenever the other would); returns the number removed
+ *
+ */
+int simplifier_duplicate_places(SIMPLIFIER *simplifier, SIMPLIFIER_PASS *pass)
+{
+    MODEL *model = simplifier->model;
+    SIMPLIFIER_HASH *hashes = malloc(sizeof(SIMPLIFIER_HASH) * (model->places + 1));
+    int count = 0;
+    int kept = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        unsigned int hash = 2166136261u;
+
+        // an isolated place is constant
+        if (simplifier->placeFates[iPlace] != KEPT_FATE || pass->linkCount[iPlace] == 0)
+        {
+            continue;
+        }
+
+        for (int iLink = pass->linkStart[iPlace]; iLink < pass->linkStart[iPlace] + pass->linkCount[iPlace]; iLink++)
+        {
+            hash = simplifier_mix(hash, pass->links[iLink].transition);
+            hash = simplifier_mix(simplifier_mix(hash, pass->links[iLink].consumed), pass->links[iLink].produced);
+        }
+
+        hashes[kept].hash = hash;
+        hashes[kept++].node = iPlace;
+    }
+
+    qsort(hashes, kept, sizeof(SIMPLIFIER_HASH), simplifier_compare_hashes);
+
+    for (int iFirst = 0; iFirst < kept; iFirst++)
+    {
+        for (int iSecond = iFirst + 1; iSecond < kept && hashes[iSecond].hash == hashes[iFirst].hash; iSecond++)
+        {
+            int first = hashes[iFirst].node;
+            int second = hashes[iSecond].node;
+
+            if (simplifier->placeFates[first] != KEPT_FATE || simplifier->placeFates[second] != KEPT_FATE ||
+                simplifier_is_touched(pass, first) || simplifier_is_touched(pass, second) ||
+                !simplifier_equal_links(pass, first, second))
+            {
+                continue;
+            }
+
+            if (simplifier->marking[second] < simplifier->marking[first])
+            {
+                int swap = first;
+
+                first = second;
+                second = swap;
+            }
+
+            simplifier_detach_place(simplifier, pass, second);
+            simplifier_remove_place(simplifier, second, DUPLICATE_FATE, first,
+                                    simplifier->marking[second] - simplifier->marking[first]);
+
+            // the kept place's transitions lost an arc
+            simplifier_touch_place(pass, first);
+
+            count += 1;
+        }
+    }
+
+    free(hashes);
+
+    return count;
+}
+
+/**
+ * @brief merge the places either side of a transition whose only input (consumed by it alone) and only output are
+ *        single arcs of weight one - the transition is removed (it fires whenever its input is marked); returns the
+ *        number removed
+ *
+ */
+int simplifier_series_places(SIMPLIFIER *simplifier, SIMPLIFIER_PASS *pass)
+{
+    MODEL *model = simplifier->model;
+    int count = 0;
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        SIMPLIFIER_ARCS *inputs = &simplifier->inputs[iTransition];
+        SIMPLIFIER_ARCS *outputs = &simplifier->outputs[iTransition];
+        int input = inputs->count == 1 ? inputs->places[0] : -1;
+        int output = outputs->count == 1 ? outputs->places[0] : -1;
+
+        if (simplifier->transitionFates[iTransition] != KEPT_FATE || input < 0 || output < 0 || input == output ||
+            inputs->weights[0] != 1 || outputs->weights[0] != 1 || pass->transitionTouched[iTransition] ||
+            simplifier_is_touched(pass, input) || simplifier_is_touched(pass, output))
+        {
+            continue;
+        }
+
+        // the transition must be the input's only consumer
+        for (int iLink = pass->linkStart[input]; iLink < pass->linkStart[input] + pass->linkCount[input] && input >= 0;
+             iLink++)
+        {
+            if (pass->links[iLink].consumed > 0 && pass->links[iLink].transition != iTransition)
+            {
+                input = -1;
+            }
+        }
+
+        if (input < 0)
+        {
+            continue;
+        }
+
+        simplifier_touch_place(pass, input);
+        simplifier_touch_place(pass, output);
+
+        // the input's producers produce to the output instead
+        for (int iLink = pass->linkStart[input]; iLink < pass->linkStart[input] + pass->linkCount[input]; iLink++)
+        {
+            SIMPLIFIER_LINK *link = &pass->links[iLink];
+
+            if (link->produced > 0)
+            {
+                simplifier_remove_arc(&simplifier->outputs[link->transition], input);
+                simplifier_add_arc(&simplifier->outputs[link->transition], output, link->produced);
+            }
+        }
+
+        simplifier->marking[output] += simplifier->marking[input];
+        simplifier->marking[input] = 0;
+
+        simplifier_remove_transition(simplifier, iTransition, MERGED_FATE, -1);
+        simplifier_remove_place(simplifier, input, MERGED_FATE, output, 0);
+
+        count += 1;
+    }
+
+    return count;
+}
+
+/**
+ * @brief fuse a transition with the only consumer of an unmarked place it alone produces (by a single arc of weight
+ *        one), when the place is the consumer's only input and the consumer produces something - the place and the
+ *        consumer are removed and the producer produces the consumer's outputs; returns the number removed
+ *
+ */
+int simplifier_series_transitions(SIMPLIFIER *simplifier, SIMPLIFIER_PASS *pass)
+{
+    MODEL *model = simplifier->model;
+    int count = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        SIMPLIFIER_LINK *first = &pass->links[pass->linkStart[iPlace]];
+        SIMPLIFIER_LINK *second = first + 1;
+        int producer = -1;
+        int consumer = -1;
+
+        if (simplifier->placeFates[iPlace] != KEPT_FATE || simplifier->marking[iPlace] != 0 ||
+            pass->linkCount[iPlace] != 2 || simplifier_is_touched(pass, iPlace))
+        {
+            continue;
+        }
+
+        if (first->consumed == 0 && first->produced == 1 && second->consumed == 1 && second->produced == 0)
+        {
+            producer = first->transition;
+            consumer = second->transition;
+        }
+        else if (second->consumed == 0 && second->produced == 1 && first->consumed == 1 && first->produced == 0)
+        {
+            producer = second->transition;
+            consumer = first->transition;
+        }
+
+        // a consumer producing nothing would hide the place growing without bound
+        if (producer < 0 || simplifier->inputs[consumer].count != 1 || simplifier->outputs[consumer].count == 0)
+        {
+            continue;
+        }
+
+        simplifier_touch_place(pass, iPlace);
+
+        for (int iArc = 0; iArc < simplifier->outputs[consumer].count; iArc++)
+        {
+            simplifier_touch_place(pass, simplifier->outputs[consumer].places[iArc]);
+        }
+
+        simplifier_remove_arc(&simplifier->outputs[producer], iPlace);
+
+        for (int iArc = 0; iArc < simplifier->outputs[consumer].count; iArc++)
+        {
+            simplifier_add_arc(&simplifier->outputs[producer], simplifier->outputs[consumer].places[iArc],
+                               simplifier->outputs[consumer].weights[iArc]);
+        }
+
+        // the consumer's sequence follows the producer's
+        simplifier->nextFused[simplifier->lastFused[producer]] = consumer;
+        simplifier->lastFused[producer] = simplifier->lastFused[consumer];
+
+        simplifier_remove_transition(simplifier, consumer, FUSED_FATE, producer);
+        simplifier_remove_place(simplifier, iPlace, FUSED_FATE, producer, 0);
+
+        count += 1;
+    }
+
+    return count;
+}
+
+/**
+ * @brief the name of a fused transition - the names of its sequence joined by '.'
+ *
+ */
+void simplifier_sequence_name(SIMPLIFIER *simplifier, int transition, char *name)
+{
+    MODEL *model = simplifier->model;
+    size_t length = 0;
+
+    name[0] = '\0';
+
+    for (int iFused = transition; iFused >= 0; iFused = simplifier->nextFused[iFused])
+    {
+        const char *part = model->transitionNames[iFused] != NULL ? model->transitionNames[iFused] : "?";
+
+        if (length + strlen(part) + 2 >= SIMPLIFIER_NAME_SIZE)
+        {
+            break;
+        }
+
+        length += snprintf(name + length, SIMPLIFIER_NAME_SIZE - length, "%s%s", iFused == transition ? "" : ".",
+                           part);
+    }
+}
+
+/**
+ * @brief build the reduced net from the working net - the places and transitions kept are numbered in order
+ *
+ */
+void simplifier_build(SIMPLIFIER *simplifier)
+{
+    MODEL *model = simplifier->model;
+    char *name = malloc(SIMPLIFIER_NAME_SIZE);
+    int places = 0;
+    int transitions = 0;
+    int fused = 0;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        simplifier->placeImages[iPlace] = simplifier->placeFates[iPlace] == KEPT_FATE ? places++ : -1;
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        simplifier->transitionImages[iTransition] =
+            simplifier->transitionFates[iTransition] == KEPT_FATE ? transitions++ : -1;
+    }
+
+    simplifier->reduced = create_model(places, transitions);
+    simplifier->sequenceStart = realloc(simplifier->sequenceStart, sizeof(int) * (transitions + 1));
+    simplifier->sequenceTransitions = realloc(simplifier->sequenceTransitions, sizeof(int) * (model->transitions + 1));
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        if (simplifier->placeImages[iPlace] >= 0)
+        {
+            simplifier->reduced->setPlace(simplifier->reduced, simplifier->placeImages[iPlace],
+                                          model->placeNames[iPlace], simplifier->marking[iPlace]);
+            simplifier->reduced->setBound(simplifier->reduced, simplifier->placeImages[iPlace], model->bounds[iPlace]);
+        }
+    }
+
+    // a place that took a merged place's tokens may hold more than its declared bound
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        int target = simplifier->placeFates[iPlace] == MERGED_FATE ? simplifier->placeTargets[iPlace] : -1;
+
+        if (target >= 0 && simplifier->placeImages[target] >= 0)
+        {
+            simplifier->reduced->setBound(simplifier->reduced, simplifier->placeImages[target], 0);
+        }
+    }
+
+    simplifier->sequenceStart[0] = 0;
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        int image = simplifier->transitionImages[iTransition];
+        int duration = 0;
+
+        if (image < 0)
+        {
+            continue;
+        }
+
+        for (int iFused = iTransition; iFused >= 0; iFused = simplifier->nextFused[iFused])
+        {
+            simplifier->sequenceTransitions[fused++] = iFused;
+            duration += model->durations[iFused];
+        }
+
+        simplifier->sequenceStart[image + 1] = fused;
+
+        simplifier_sequence_name(simplifier, iTransition, name);
+
+        simplifier->reduced->setTransition(simplifier->reduced, image, name, duration);
+
+        for (int iArc = 0; iArc < simplifier->inputs[iTransition].count; iArc++)
+        {
+            simplifier->reduced->connect(simplifier->reduced,
+                                         simplifier->placeImages[simplifier->inputs[iTransition].places[iArc]], image,
+                                         simplifier->inputs[iTransition].weights[iArc], INPUT_FLOW);
+        }
+
+        for (int iArc = 0; iArc < simplifier->outputs[iTransition].count; iArc++)
+        {
+            simplifier->reduced->connect(simplifier->reduced,
+                                         simplifier->placeImages[simplifier->outputs[iTransition].places[iArc]], image,
+                                         simplifier->outputs[iTransition].weights[iArc], OUTPUT_FLOW);
+        }
+    }
+
+    simplifier->reduced->compile(simplifier->reduced);
+
+    free(name);
+}
+
+/**
+ * @brief apply the rules until none applies, then build the reduced net
+ *
+ */
+MODEL *simplifier_simplify(SIMPLIFIER *simplifier)
+{
+    MODEL *model = simplifier->model;
+    SIMPLIFIER_PASS pass;
+    double started = explorer_clock();
+    int changed = TRUE;
+
+    pass.linkStart = malloc(sizeof(int) * (model->places + 1));
+    pass.linkCount = malloc(sizeof(int) * (model->places + 1));
+    pass.links = NULL;
+    pass.placeTouched = malloc(sizeof(int) * (model->places + 1));
+    pass.transitionTouched = malloc(sizeof(int) * (model->transitions + 1));
+
+    while (changed)
+    {
+        int applied[END_SIMPLIFIER_RULES];
+
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            simplifier_sort_arcs(&simplifier->inputs[iTransition]);
+            simplifier_sort_arcs(&simplifier->outputs[iTransition]);
+        }
+
+        applied[DEAD_TRANSITION_RULE] = simplifier_dead_transitions(simplifier);
+        applied[DUPLICATE_TRANSITION_RULE] = simplifier_duplicate_transitions(simplifier);
+
+        simplifier_link(simplifier, &pass);
+
+        applied[CONSTANT_PLACE_RULE] = simplifier_constant_places(simplifier, &pass);
+        applied[DUPLICATE_PLACE_RULE] = simplifier_duplicate_places(simplifier, &pass);
+        applied[SERIES_PLACE_RULE] = simplifier_series_places(simplifier, &pass);
+        applied[SERIES_TRANSITION_RULE] = simplifier_series_transitions(simplifier, &pass);
+
+        changed = FALSE;
+
+        for (int iRule = 0; iRule < END_SIMPLIFIER_RULES; iRule++)
+        {
+            simplifier->applied[iRule] += applied[iRule];
+            changed = changed || applied[iRule] > 0;
+        }
+    }
+
+    simplifier_build(simplifier);
+
+    free(pass.linkStart);
+    free(pass.linkCount);
+    free(pass.links);
+    free(pass.placeTouched);
+    free(pass.transitionTouched);
+
+    simplifier->seconds = explorer_clock() - started;
+
+    return simplifier->reduced;
+}
+
+/**
+ * @brief the original marking of a reduced marking - the removed places are restored latest first, so a duplicate's
+ *        target is restored before it
+ *
+ */
+void simplifier_restore(SIMPLIFIER *simplifier, const unsigned int *reduced, unsigned int *marking)
+{
+    MODEL *model = simplifier->model;
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        marking[iPlace] = simplifier->placeImages[iPlace] >= 0 ? reduced[simplifier->placeImages[iPlace]] : 0;
+    }
+
+    for (int iRemoved = simplifier->removedCount - 1; iRemoved >= 0; iRemoved--)
+    {
+        int place = simplifier->removed[iRemoved];
+
+        switch (simplifier->placeFates[place])
+        {
+        case DUPLICATE_FATE:
+            marking[place] = marking[simplifier->placeTargets[place]] + simplifier->placeOffsets[place];
+            break;
+        case CONSTANT_FATE:
+            marking[place] = simplifier->placeOffsets[place];
+            break;
+        default:
+            // a merged place's tokens were moved on, a fused place's consumed at once
+            marking[place] = 0;
+            break;
+        }
+    }
+}
+
+/**
+ * @brief release/free the simplifier object
+ *
+ */
+void simplifier_release(SIMPLIFIER *simplifier)
+{
+
+    if (simplifier->reduced != NULL)
+    {
+        simplifier->reduced->release(simplifier->reduced);
+    }
+
+    for (int iTransition = 0; iTransition < simplifier->model->transitions; iTransition++)
+    {
+        free(simplifier->inputs[iTransition].places);
+        free(simplifier->inputs[iTransition].weights);
+        free(simplifier->outputs[iTransition].places);
+        free(simplifier->outputs[iTransition].weights);
+    }
+
+    free(simplifier->inputs);
+    free(simplifier->outputs);
+    free(simplifier->marking);
+    free(simplifier->nextFused);
+    free(simplifier->lastFused);
+    free(simplifier->removed);
+    free(simplifier->placeImages);
+    free(simplifier->transitionImages);
+    free(simplifier->placeFates);
+    free(simplifier->placeTargets);
+    free(simplifier->transitionFates);
+    free(simplifier->transitionTargets);
+    free(simplifier->placeOffsets);
+    free(simplifier->sequenceStart);
+    free(simplifier->sequenceTransitions);
+
+    free(simplifier);
+}
+
+/**
+ * @brief simplifier constructor - the working net is a copy of the model
+ *
+ */
+SIMPLIFIER *create_simplifier(MODEL *model)
+{
+    SIMPLIFIER *simplifier = malloc(sizeof(SIMPLIFIER));
+    int places = model->places + 1;
+    int transitions = model->transitions + 1;
+
+    simplifier->model = model;
+    simplifier->reduced = NULL;
+    simplifier->seconds = 0;
+
+    memset(simplifier->applied, 0, sizeof(simplifier->applied));
+
+    simplifier->inputs = calloc(transitions, sizeof(SIMPLIFIER_ARCS));
+    simplifier->outputs = calloc(transitions, sizeof(SIMPLIFIER_ARCS));
+    simplifier->marking = malloc(sizeof(int) * places);
+    simplifier->nextFused = malloc(sizeof(int) * transitions);
+    simplifier->lastFused = malloc(sizeof(int) * transitions);
+    simplifier->removed = malloc(sizeof(int) * places);
+    simplifier->removedCount = 0;
+
+    simplifier->placeImages = malloc(sizeof(int) * places);
+    simplifier->transitionImages = malloc(sizeof(int) * transitions);
+    simplifier->placeFates = calloc(places, sizeof(enum SIMPLIFIER_FATE));
+    simplifier->placeTargets = malloc(sizeof(int) * places);
+    simplifier->transitionFates = calloc(transitions, sizeof(enum SIMPLIFIER_FATE));
+    simplifier->transitionTargets = malloc(sizeof(int) * transitions);
+    simplifier->placeOffsets = calloc(places, sizeof(int));
+    simplifier->sequenceStart = NULL;
+    simplifier->sequenceTransitions = NULL;
+
+    memcpy(simplifier->marking, model->marking, sizeof(int) * model->places);
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        simplifier->placeImages[iPlace] = iPlace;
+        simplifier->placeTargets[iPlace] = -1;
+    }
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        simplifier->transitionImages[iTransition] = iTransition;
+        simplifier->transitionTargets[iTransition] = -1;
+        simplifier->nextFused[iTransition] = -1;
+        simplifier->lastFused[iTransition] = iTransition;
+
+        for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1]; iArc++)
+        {
+            simplifier_add_arc(&simplifier->inputs[iTransition], model->inputPlaces[iArc], model->inputWeights[iArc]);
+        }
+
+        for (int iArc = model->outputStart[iTransition]; iArc < model->outputStart[iTransition + 1]; iArc++)
+        {
+            simplifier_add_arc(&simplifier->outputs[iTransition], model->outputPlaces[iArc],
+                               model->outputWeights[iArc]);
+        }
+    }
+
+    simplifier->simplify = simplifier_simplify;
+    simplifier->restore = simplifier_restore;
+    simplifier->release = simplifier_release;
+
+    return simplifier;
+}
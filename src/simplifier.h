@@ -0,0 +1,188 @@
+/**
+ * @file simplifier.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - reduces a compiled model by structural rules before it is analysed
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SIMPLIFIER_H_INCLUDED
+#define SIMPLIFIER_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a simplifier
+ *
+ */
+#define TO_SIMPLIFIER(simplifier) ((SIMPLIFIER *)(simplifier))
+
+/**
+ * @brief the reduction rules (Berthelot) - each removes places or transitions
+ *
+ */
+enum SIMPLIFIER_RULE
+{
+    DEAD_TRANSITION_RULE = 0,
+    DUPLICATE_TRANSITION_RULE,
+    CONSTANT_PLACE_RULE,
+    DUPLICATE_PLACE_RULE,
+    SERIES_PLACE_RULE,
+    SERIES_TRANSITION_RULE,
+    END_SIMPLIFIER_RULES
+};
+
+/**
+ * @brief what became of a place or transition of the original net
+ *
+ */
+enum SIMPLIFIER_FATE
+{
+    KEPT_FATE = 0,
+    /**
+     * @brief a transition that can never fire (a place it consumes from can never be marked)
+     *
+     */
+    DEAD_FATE,
+    /**
+     * @brief a transition with the same inputs and outputs as its target, or a place with the same producers and
+     *        consumers as its target (its tokens are the target's plus its offset)
+     *
+     */
+    DUPLICATE_FATE,
+    /**
+     * @brief a place that never changes and never disables a transition (only self-loops) - its tokens are its offset
+     *
+     */
+    CONSTANT_FATE,
+    /**
+     * @brief a place whose only consumer moves its tokens to the target (the consumer is silent) - or the silent
+     *        transition, which is removed
+     *
+     */
+    MERGED_FATE,
+    /**
+     * @brief a place between a transition (the target) and its only consumer, which is fused into the target
+     *
+     */
+    FUSED_FATE,
+    END_SIMPLIFIER_FATES
+};
+
+/**
+ * @brief the simplifier's interface - the rules are applied until none applies:
+ *        - dead transitions: a transition consuming from a place that can never be marked is removed
+ *        - duplicate transitions: a transition with the same inputs and outputs as another is removed
+ *        - constant places: a place with only self-loops holding enough tokens for each is removed
+ *        - duplicate places: of two places with the same producers and consumers, the one with more tokens is removed
+ *        - series places: a transition whose only input 'p' (consumed by it alone) and only output 'q' are single
+ *          arcs is removed and 'p' is merged into 'q'
+ *        - series transitions: an unmarked place 'p' produced by 't' alone and consumed by 'u' alone (whose only input
+ *          is 'p', and which has an output) is removed and 'u' is fused into 't' (firing 't' fires 'u')
+ *        The reduced net's reachable markings are those of the original in which no merged place holds a token and no
+ *        fused place is marked (mapped by restore), so dead markings and bounds are preserved - durations are not
+ *        (a fused transition takes the sum)
+ *
+ */
+typedef struct _SIMPLIFIER
+{
+
+    /**
+     * @brief apply the rules and build the reduced net - returns the reduced net (released with the simplifier)
+     *
+     */
+    MODEL *(*simplify)(struct _SIMPLIFIER *simplifier);
+
+    /**
+     * @brief the original marking of a reduced marking (a reachable marking of the original if the reduced marking is
+     *        reachable)
+     *
+     */
+    void (*restore)(struct _SIMPLIFIER *simplifier, const unsigned int *reduced, unsigned int *marking);
+
+    /**
+     * @brief release the simplifier and the reduced net, and deallocate resources (the original is not released)
+     *
+     */
+    void (*release)(struct _SIMPLIFIER *simplifier);
+
+    /**
+     * @brief the original and the reduced net (NULL until simplified)
+     *
+     */
+    MODEL *model;
+    MODEL *reduced;
+
+    /**
+     * @brief the number of times each rule was applied
+     *
+     */
+    int applied[END_SIMPLIFIER_RULES];
+
+    /**
+     * @brief the place (or transition) of the reduced net each original place (or transition) is (-1 if removed)
+     *
+     */
+    int *placeImages;
+    int *transitionImages;
+
+    /**
+     * @brief what became of each original place (or transition) and the original place (or transition) it became
+     *        part of (-1 if none)
+     *
+     */
+    enum SIMPLIFIER_FATE *placeFates;
+    int *placeTargets;
+    enum SIMPLIFIER_FATE *transitionFates;
+    int *transitionTargets;
+
+    /**
+     * @brief the tokens a duplicate place holds more than its target, or a constant place holds
+     *
+     */
+    int *placeOffsets;
+
+    /**
+     * @brief the original transitions fired by each reduced transition, in order - sequenceStart[t] ..
+     *        sequenceStart[t + 1]
+     *
+     */
+    int *sequenceStart;
+    int *sequenceTransitions;
+
+    /**
+     * @brief the time taken by the last reduction (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief private (the working net - each original transition's inputs and outputs, each place's tokens)
+     *
+     */
+    struct _SIMPLIFIER_ARCS *inputs;
+    struct _SIMPLIFIER_ARCS *outputs;
+    int *marking;
+
+    /**
+     * @brief private (the next transition of a fused sequence and the last, -1 if none)
+     *
+     */
+    int *nextFused;
+    int *lastFused;
+
+    /**
+     * @brief private (the places in the order they were removed)
+     *
+     */
+    int *removed;
+    int removedCount;
+
+} SIMPLIFIER, *SIMPLIFIER_P;
+
+extern SIMPLIFIER *create_simplifier(MODEL *model);
+
+#endif // SIMPLIFIER_H_INCLUDED
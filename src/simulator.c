@@ -0,0 +1,285 @@
+/**
+ * @file simulator.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  plays the token game on a compiled model
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "simulator.h"
+
+/**
+ * @brief the default seed of the random generator
+ *
+ */
+#define SIMULATOR_SEED 0x9E3779B97F4A7C15ULL
+
+/**
+ * @brief the next random number (xorshift64*) - the state must not be zero
+ *
+ */
+unsigned long long simulator_next_random(unsigned long long *state)
+{
+    unsigned long long value = *state;
+
+    value ^= value >> 12;
+    value ^= value << 25;
+    value ^= value >> 27;
+
+    *state = value;
+
+    return value * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief add a transition to the enabled transitions
+ *
+ */
+void simulator_enable(SIMULATOR *simulator, int transition)
+{
+
+    simulator->position[transition] = simulator->enabledCount;
+    simulator->enabled[simulator->enabledCount++] = transition;
+
+    if (simulator->listener != NULL)
+    {
+        simulator->listener(simulator->listenerData, transition, TRUE);
+    }
+}
+
+/**
+ * @brief remove a transition from the enabled transitions (the last enabled transition fills the gap)
+ *
+ */
+void simulator_disable(SIMULATOR *simulator, int transition)
+{
+    int last = simulator->enabled[--simulator->enabledCount];
+
+    simulator->enabled[simulator->position[transition]] = last;
+    simulator->position[last] = simulator->position[transition];
+    simulator->position[transition] = -1;
+
+    if (simulator->listener != NULL)
+    {
+        simulator->listener(simulator->listenerData, transition, FALSE);
+    }
+}
+
+/**
+ * @brief count the unsatisfied input arcs of every transition and rebuild the enabled transitions
+ *
+ */
+void simulator_recount(SIMULATOR *simulator)
+{
+    MODEL *model = simulator->model;
+
+    simulator->enabledCount = 0;
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        simulator->unsatisfied[iTransition] = 0;
+        simulator->position[iTransition] = -1;
+
+        for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1]; iArc++)
+        {
+            if (simulator->marking[model->inputPlaces[iArc]] < model->inputWeights[iArc])
+            {
+                simulator->unsatisfied[iTransition] += 1;
+            }
+        }
+
+        if (simulator->unsatisfied[iTransition] == 0)
+        {
+            simulator->position[iTransition] = simulator->enabledCount;
+            simulator->enabled[simulator->enabledCount++] = iTransition;
+        }
+    }
+}
+
+/**
+ * @brief is the transition enabled in the current marking
+ *
+ */
+int simulator_is_enabled(SIMULATOR *simulator, int transition)
+{
+
+    return simulator->position[transition] >= 0;
+}
+
+/**
+ * @brief apply the transition's change to the marking (the transition must be enabled) - only the consumers
+ *        of the changed places are revisited
+ *
+ */
+void simulator_apply(SIMULATOR *simulator, int transition)
+{
+    MODEL *model = simulator->model;
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        int place = model->changePlaces[iChange];
+        int before = simulator->marking[place];
+        int after = before + model->changeValues[iChange];
+
+        simulator->marking[place] = after;
+
+        for (int iArc = model->consumerStart[place]; iArc < model->consumerStart[place + 1]; iArc++)
+        {
+            int consumer = model->consumerTransitions[iArc];
+            int weight = model->consumerWeights[iArc];
+
+            if (before >= weight && after < weight)
+            {
+                if (simulator->unsatisfied[consumer]++ == 0)
+                {
+                    simulator_disable(simulator, consumer);
+                }
+            }
+            else if (before < weight && after >= weight)
+            {
+                if (--simulator->unsatisfied[consumer] == 0)
+                {
+                    simulator_enable(simulator, consumer);
+                }
+            }
+        }
+    }
+
+    simulator->fired += 1;
+}
+
+/**
+ * @brief fire the transition if it is enabled
+ *
+ */
+int simulator_fire(SIMULATOR *simulator, int transition)
+{
+
+    if (transition < 0 || transition >= simulator->model->transitions || !simulator_is_enabled(simulator, transition))
+    {
+        return FALSE;
+    }
+
+    simulator_apply(simulator, transition);
+
+    return TRUE;
+}
+
+/**
+ * @brief fire transitions chosen at random from those enabled
+ *
+ */
+long simulator_run(SIMULATOR *simulator, long steps)
+{
+    long iStep;
+
+    for (iStep = 0; iStep < steps && simulator->enabledCount > 0; iStep++)
+    {
+        simulator_apply(simulator,
+                        simulator->enabled[simulator_next_random(&simulator->random) % simulator->enabledCount]);
+    }
+
+    return iStep;
+}
+
+/**
+ * @brief seed the random generator
+ *
+ */
+void simulator_seed(SIMULATOR *simulator, unsigned long long seed)
+{
+
+    simulator->random = seed == 0 ? SIMULATOR_SEED : seed;
+}
+
+/**
+ * @brief restore the initial marking
+ *
+ */
+void simulator_reset(SIMULATOR *simulator)
+{
+
+    memcpy(simulator->marking, simulator->model->marking, sizeof(int) * simulator->model->places);
+
+    simulator->fired = 0;
+
+    simulator_recount(simulator);
+
+    if (simulator->listener != NULL)
+    {
+        for (int iTransition = 0; iTransition < simulator->model->transitions; iTransition++)
+        {
+            simulator->listener(simulator->listenerData, iTransition, simulator->position[iTransition] >= 0);
+        }
+    }
+}
+
+/**
+ * @brief register a listener and tell it the current state of every transition
+ *
+ */
+void simulator_listen(SIMULATOR *simulator, void (*listener)(void *data, int transition, int enabled), void *data)
+{
+
+    simulator->listener = listener;
+    simulator->listenerData = data;
+
+    for (int iTransition = 0; listener != NULL && iTransition < simulator->model->transitions; iTransition++)
+    {
+        listener(data, iTransition, simulator->position[iTransition] >= 0);
+    }
+}
+
+/**
+ * @brief release/free the simulator object
+ *
+ */
+void simulator_release(SIMULATOR *simulator)
+{
+
+    free(simulator->marking);
+    free(simulator->enabled);
+    free(simulator->position);
+    free(simulator->unsatisfied);
+
+    free(simulator);
+}
+
+/**
+ * @brief simulator constructor
+ *
+ */
+SIMULATOR *create_simulator(MODEL *model)
+{
+    SIMULATOR *simulator = malloc(sizeof(SIMULATOR));
+
+    simulator->model = model;
+
+    simulator->marking = malloc(sizeof(int) * (model->places + 1));
+    simulator->enabled = malloc(sizeof(int) * (model->transitions + 1));
+    simulator->position = malloc(sizeof(int) * (model->transitions + 1));
+    simulator->unsatisfied = malloc(sizeof(int) * (model->transitions + 1));
+
+    simulator->listener = NULL;
+    simulator->listenerData = NULL;
+
+    simulator->isEnabled = simulator_is_enabled;
+    simulator->fire = simulator_fire;
+    simulator->run = simulator_run;
+    simulator->seed = simulator_seed;
+    simulator->reset = simulator_reset;
+    simulator->listen = simulator_listen;
+    simulator->release = simulator_release;
+
+    simulator->seed(simulator, 0);
+    simulator->reset(simulator);
+
+    return simulator;
+}
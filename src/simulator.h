@@ -0,0 +1,135 @@
+/**
+ * @file simulator.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - plays the token game on a compiled model
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SIMULATOR_H_INCLUDED
+#define SIMULATOR_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a simulator
+ *
+ */
+#define TO_SIMULATOR(simulator) ((SIMULATOR *)(simulator))
+
+/**
+ * @brief the simulator's interface - the marking starts as the model's initial marking
+ *
+ */
+typedef struct _SIMULATOR
+{
+
+    /**
+     * @brief returns true if the transition is enabled in the current marking, false otherwise
+     *
+     */
+    int (*isEnabled)(struct _SIMULATOR *simulator, int transition);
+
+    /**
+     * @brief fire the transition if it is enabled - returns true if the transition fired, false otherwise
+     *
+     */
+    int (*fire)(struct _SIMULATOR *simulator, int transition);
+
+    /**
+     * @brief fire up to 'steps' transitions, each chosen at random from those enabled - returns the number fired
+     *        (less than 'steps' if a dead marking is reached)
+     *
+     */
+    long (*run)(struct _SIMULATOR *simulator, long steps);
+
+    /**
+     * @brief seed the random choice of transitions
+     *
+     */
+    void (*seed)(struct _SIMULATOR *simulator, unsigned long long seed);
+
+    /**
+     * @brief restore the initial marking
+     *
+     */
+    void (*reset)(struct _SIMULATOR *simulator);
+
+    /**
+     * @brief register a listener called whenever a transition becomes enabled or disabled
+     *        (the listener is called at once for every transition with its current state)
+     *
+     */
+    void (*listen)(struct _SIMULATOR *simulator, void (*listener)(void *data, int transition, int enabled), void *data);
+
+    /**
+     * @brief release the simulator and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _SIMULATOR *simulator);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the current marking (one entry per place)
+     *
+     */
+    int *marking;
+
+    /**
+     * @brief the number of transitions fired since the last reset
+     *
+     */
+    long fired;
+
+    /**
+     * @brief the transitions enabled in the current marking (in no particular order)
+     *
+     */
+    int *enabled;
+
+    /**
+     * @brief the number of transitions enabled in the current marking
+     *
+     */
+    int enabledCount;
+
+    /**
+     * @brief private (the index of each transition within 'enabled', -1 if the transition is not enabled)
+     *
+     */
+    int *position;
+
+    /**
+     * @brief private (the number of input arcs of each transition not satisfied by the current marking)
+     *
+     */
+    int *unsatisfied;
+
+    /**
+     * @brief private (the listener and its data)
+     *
+     */
+    void (*listener)(void *data, int transition, int enabled);
+    void *listenerData;
+
+    /**
+     * @brief private (the random generator's state)
+     *
+     */
+    unsigned long long random;
+
+} SIMULATOR, *SIMULATOR_P;
+
+extern SIMULATOR *create_simulator(MODEL *model);
+
+extern unsigned long long simulator_next_random(unsigned long long *state);
+
+#endif // SIMULATOR_H_INCLUDED
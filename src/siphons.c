@@ -0,0 +1,711 @@
+/**
+ * @file siphons.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  the minimal siphons and traps of a compiled model and the siphon-trap (Commoner) property
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "explorer.h"
+#include "siphons.h"
+
+/**
+ * @brief private structure - how a kind of set is closed: each place of the set is guarded by transitions, each of
+ *        which must be supported by a place of the set (for siphons a place's producers must consume from the set,
+ *        for traps a place's consumers must produce into it); a place supports transitions and a transition guards
+ *        places (the converse relations)
+ *
+ */
+typedef struct _SIPHONS_RELATION
+{
+    int *guardStart;
+    int *guards;
+    int *supportStart;
+    int *supports;
+    int *supportedStart;
+    int *supported;
+    int *guardedStart;
+    int *guarded;
+
+} SIPHONS_RELATION, *SIPHONS_RELATION_P;
+
+/**
+ * @brief private structure - the problems waiting to be searched, each the places allowed and the places required
+ *
+ */
+typedef struct _SIPHONS_PROBLEMS
+{
+    unsigned long long *sets;
+    int count;
+    int capacity;
+
+} SIPHONS_PROBLEMS, *SIPHONS_PROBLEMS_P;
+
+/**
+ * @brief the relation closing a kind of set
+ *
+ */
+SIPHONS_RELATION siphons_relation(SIPHONS *siphons, enum SIPHON_KIND kind)
+{
+    MODEL *model = siphons->model;
+    SIPHONS_RELATION relation;
+
+    relation.supportStart = kind == SIPHON_SETS ? model->inputStart : model->outputStart;
+    relation.supports = kind == SIPHON_SETS ? model->inputPlaces : model->outputPlaces;
+    relation.guardedStart = kind == SIPHON_SETS ? model->outputStart : model->inputStart;
+    relation.guarded = kind == SIPHON_SETS ? model->outputPlaces : model->inputPlaces;
+
+    relation.guardStart = kind == SIPHON_SETS ? siphons->producerStart : model->consumerStart;
+    relation.guards = kind == SIPHON_SETS ? siphons->producers : model->consumerTransitions;
+    relation.supportedStart = kind == SIPHON_SETS ? model->consumerStart : siphons->producerStart;
+    relation.supported = kind == SIPHON_SETS ? model->consumerTransitions : siphons->producers;
+
+    return relation;
+}
+
+/**
+ * @brief returns true if a place is in a set
+ *
+ */
+int siphons_has(const unsigned long long *set, int place)
+{
+
+    return (set[place / 64] & (1ULL << (place % 64))) != 0;
+}
+
+/**
+ * @brief returns true if a set has no places
+ *
+ */
+int siphons_is_empty(SIPHONS *siphons, const unsigned long long *set)
+{
+
+    for (int iWord = 0; iWord < siphons->words; iWord++)
+    {
+        if (set[iWord] != 0)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief returns true if every place of the subset is in the set
+ *
+ */
+int siphons_contains(SIPHONS *siphons, const unsigned long long *set, const unsigned long long *subset)
+{
+
+    for (int iWord = 0; iWord < siphons->words; iWord++)
+    {
+        if (subset[iWord] & ~set[iWord])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief the places of a set (in order) - returns the number of places
+ *
+ */
+int siphons_members(SIPHONS *siphons, const unsigned long long *set, int *members)
+{
+    int count = 0;
+
+    for (int iWord = 0; iWord < siphons->words; iWord++)
+    {
+        unsigned long long word = set[iWord];
+
+        while (word != 0)
+        {
+            members[count++] = iWord * 64 + __builtin_ctzll(word);
+            word &= word - 1;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief remove a place from a set and queue it
+ *
+ */
+void siphons_remove(SIPHONS *siphons, unsigned long long *set, int place, int *tail)
+{
+
+    set[place / 64] &= ~(1ULL << (place % 64));
+    siphons->queue[(*tail)++] = place;
+}
+
+/**
+ * @brief shrink a set to the largest set it holds that is closed under the relation (the maximal siphon, or trap) -
+ *        a place is removed while one of its guards has no support left in the set; only the transitions around
+ *        the set are counted
+ *
+ */
+void siphons_maximal(SIPHONS *siphons, const SIPHONS_RELATION *relation, unsigned long long *set)
+{
+    int *members = siphons->queue + siphons->model->places;
+    int count = siphons_members(siphons, set, members);
+    int head = 0;
+    int tail = 0;
+
+    siphons->stamp += 1;
+
+    for (int iMember = 0; iMember < count; iMember++)
+    {
+        for (int iGuard = relation->guardStart[members[iMember]]; iGuard < relation->guardStart[members[iMember] + 1];
+             iGuard++)
+        {
+            int transition = relation->guards[iGuard];
+
+            if (siphons->stamps[transition] != siphons->stamp)
+            {
+                siphons->stamps[transition] = siphons->stamp;
+                siphons->remaining[transition] = 0;
+
+                for (int iSupport = relation->supportStart[transition];
+                     iSupport < relation->supportStart[transition + 1]; iSupport++)
+                {
+                    siphons->remaining[transition] += siphons_has(set, relation->supports[iSupport]);
+                }
+            }
+        }
+    }
+
+    for (int iMember = 0; iMember < count; iMember++)
+    {
+        for (int iGuard = relation->guardStart[members[iMember]]; iGuard < relation->guardStart[members[iMember] + 1];
+             iGuard++)
+        {
+            if (siphons->remaining[relation->guards[iGuard]] == 0)
+            {
+                siphons_remove(siphons, set, members[iMember], &tail);
+
+                break;
+            }
+        }
+    }
+
+    // a removed place no longer supports its transitions - those left without support remove the places they guard
+    while (head < tail)
+    {
+        int place = siphons->queue[head++];
+
+        for (int iSupported = relation->supportedStart[place]; iSupported < relation->supportedStart[place + 1];
+             iSupported++)
+        {
+            int transition = relation->supported[iSupported];
+
+            if (siphons->stamps[transition] != siphons->stamp || --siphons->remaining[transition] != 0)
+            {
+                continue;
+            }
+
+            for (int iGuarded = relation->guardedStart[transition]; iGuarded < relation->guardedStart[transition + 1];
+                 iGuarded++)
+            {
+                if (siphons_has(set, relation->guarded[iGuarded]))
+                {
+                    siphons_remove(siphons, set, relation->guarded[iGuarded], &tail);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief grow a closed set from the seed places within a closed set - each guard without support is supported by the
+ *        first of its places in the closed set
+ *
+ */
+void siphons_grow(SIPHONS *siphons, const SIPHONS_RELATION *relation, const unsigned long long *closed,
+                  unsigned long long *set)
+{
+    int tail = siphons_members(siphons, set, siphons->queue);
+    int head = 0;
+
+    while (head < tail)
+    {
+        int place = siphons->queue[head++];
+
+        for (int iGuard = relation->guardStart[place]; iGuard < relation->guardStart[place + 1]; iGuard++)
+        {
+            int transition = relation->guards[iGuard];
+            int chosen = -1;
+
+            for (int iSupport = relation->supportStart[transition]; iSupport < relation->supportStart[transition + 1];
+                 iSupport++)
+            {
+                if (siphons_has(set, relation->supports[iSupport]))
+                {
+                    chosen = -1;
+
+                    break;
+                }
+
+                if (chosen < 0 && siphons_has(closed, relation->supports[iSupport]))
+                {
+                    chosen = relation->supports[iSupport];
+                }
+            }
+
+            if (chosen >= 0)
+            {
+                set[chosen / 64] |= 1ULL << (chosen % 64);
+                siphons->queue[tail++] = chosen;
+            }
+        }
+    }
+}
+
+/**
+ * @brief shrink a closed set holding the required places to a minimal one - a place not required is dropped if the
+ *        largest closed set without it still holds the required places (and is not empty); one pass suffices as the
+ *        closed sets only shrink
+ *
+ */
+void siphons_minimise(SIPHONS *siphons, const SIPHONS_RELATION *relation, unsigned long long *set,
+                      const unsigned long long *required, unsigned long long *trial, int *candidates)
+{
+    int count = siphons_members(siphons, set, candidates);
+
+    for (int iCandidate = 0; iCandidate < count; iCandidate++)
+    {
+        int place = candidates[iCandidate];
+
+        if (!siphons_has(set, place) || siphons_has(required, place))
+        {
+            continue;
+        }
+
+        memcpy(trial, set, sizeof(unsigned long long) * siphons->words);
+        trial[place / 64] &= ~(1ULL << (place % 64));
+
+        siphons_maximal(siphons, relation, trial);
+
+        if (siphons_contains(siphons, trial, required) && !siphons_is_empty(siphons, trial))
+        {
+            memcpy(set, trial, sizeof(unsigned long long) * siphons->words);
+        }
+    }
+}
+
+/**
+ * @brief returns true if a closed set holds no smaller closed set (none is left once any place is removed)
+ *
+ */
+int siphons_is_minimal(SIPHONS *siphons, const SIPHONS_RELATION *relation, const unsigned long long *set,
+                       unsigned long long *trial, int *candidates)
+{
+    int count = siphons_members(siphons, set, candidates);
+
+    for (int iCandidate = 0; iCandidate < count; iCandidate++)
+    {
+        memcpy(trial, set, sizeof(unsigned long long) * siphons->words);
+        trial[candidates[iCandidate] / 64] &= ~(1ULL << (candidates[iCandidate] % 64));
+
+        siphons_maximal(siphons, relation, trial);
+
+        if (!siphons_is_empty(siphons, trial))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief add a problem - the places allowed and the places required
+ *
+ */
+void siphons_push(SIPHONS *siphons, SIPHONS_PROBLEMS *problems, const unsigned long long *allowed,
+                  const unsigned long long *required)
+{
+
+    if (problems->count == problems->capacity)
+    {
+        problems->capacity = problems->capacity * 2 + 16;
+        problems->sets = realloc(problems->sets, sizeof(unsigned long long) * 2 * siphons->words * problems->capacity);
+    }
+
+    memcpy(problems->sets + 2 * siphons->words * problems->count, allowed, sizeof(unsigned long long) * siphons->words);
+    memcpy(problems->sets + 2 * siphons->words * problems->count + siphons->words, required,
+           sizeof(unsigned long long) * siphons->words);
+
+    problems->count += 1;
+}
+
+/**
+ * @brief hold a minimal set, the maximal trap it holds and whether the trap is marked - the capacities are of the
+ *        members, the traps and the sets
+ *
+ */
+void siphons_record(SIPHONS *siphons, const unsigned long long *set, unsigned long long *trap, int *capacities)
+{
+    SIPHONS_RELATION relation = siphons_relation(siphons, TRAP_SETS);
+    int size = 0;
+    int trapSize = 0;
+
+    memcpy(trap, set, sizeof(unsigned long long) * siphons->words);
+
+    if (siphons->kind == SIPHON_SETS)
+    {
+        siphons_maximal(siphons, &relation, trap);
+    }
+
+    if (siphons->start[siphons->count] + siphons->model->places > capacities[0])
+    {
+        capacities[0] = capacities[0] * 2 + siphons->model->places;
+        siphons->members = realloc(siphons->members, sizeof(int) * capacities[0]);
+    }
+
+    if (siphons->trapStart[siphons->count] + siphons->model->places > capacities[1])
+    {
+        capacities[1] = capacities[1] * 2 + siphons->model->places;
+        siphons->traps = realloc(siphons->traps, sizeof(int) * capacities[1]);
+    }
+
+    if (siphons->count + 2 > capacities[2])
+    {
+        capacities[2] = capacities[2] * 2 + 16;
+        siphons->start = realloc(siphons->start, sizeof(int) * capacities[2]);
+        siphons->trapStart = realloc(siphons->trapStart, sizeof(int) * capacities[2]);
+        siphons->marked = realloc(siphons->marked, sizeof(int) * capacities[2]);
+    }
+
+    size = siphons_members(siphons, set, siphons->members + siphons->start[siphons->count]);
+    trapSize = siphons_members(siphons, trap, siphons->traps + siphons->trapStart[siphons->count]);
+
+    siphons->marked[siphons->count] = FALSE;
+
+    for (int iPlace = 0; iPlace < trapSize; iPlace++)
+    {
+        if (siphons->model->marking[siphons->traps[siphons->trapStart[siphons->count] + iPlace]] > 0)
+        {
+            siphons->marked[siphons->count] = TRUE;
+        }
+    }
+
+    siphons->unmarkedCount += siphons->marked[siphons->count] ? 0 : 1;
+
+    siphons->start[siphons->count + 1] = siphons->start[siphons->count] + size;
+    siphons->trapStart[siphons->count + 1] = siphons->trapStart[siphons->count] + trapSize;
+    siphons->count += 1;
+}
+
+/**
+ * @brief compute the minimal sets - each problem (allowed, required) is solved by a minimal set holding the required
+ *        places (recorded if it is minimal outright) and split by the places of that set not required: the i-th
+ *        excludes its place and requires those before it, so every other minimal set belongs to exactly one problem;
+ *        a set that is not minimal outright holds a minimal set, and the problem is split by its places instead
+ *
+ */
+int siphons_compute(SIPHONS *siphons, int limit)
+{
+    SIPHONS_RELATION relation = siphons_relation(siphons, siphons->kind);
+    int words = siphons->words;
+    unsigned long long *sets = calloc(7 * words, sizeof(unsigned long long));
+    unsigned long long *allowed = sets;
+    unsigned long long *required = sets + words;
+    unsigned long long *set = sets + 2 * words;
+    unsigned long long *trial = sets + 3 * words;
+    unsigned long long *part = sets + 4 * words;
+    unsigned long long *trap = sets + 5 * words;
+    unsigned long long *none = sets + 6 * words;
+    unsigned long long *split = NULL;
+    int *candidates = malloc(sizeof(int) * (siphons->model->places + 1));
+    int capacities[3] = {0, 0, 0};
+    SIPHONS_PROBLEMS problems = {NULL, 0, 0};
+    double started = explorer_clock();
+
+    siphons->count = 0;
+    siphons->unmarkedCount = 0;
+    siphons->problems = 0;
+    siphons->complete = TRUE;
+    siphons->start[0] = 0;
+    siphons->trapStart[0] = 0;
+
+    for (int iPlace = 0; iPlace < siphons->model->places; iPlace++)
+    {
+        allowed[iPlace / 64] |= 1ULL << (iPlace % 64);
+    }
+
+    siphons_push(siphons, &problems, allowed, required);
+
+    while (problems.count > 0)
+    {
+        int count = 0;
+
+        if (limit > 0 && siphons->problems >= limit)
+        {
+            siphons->complete = FALSE;
+
+            break;
+        }
+
+        problems.count -= 1;
+        siphons->problems += 1;
+
+        memcpy(allowed, problems.sets + 2 * words * problems.count, sizeof(unsigned long long) * 2 * words);
+
+        // the largest closed set allowed must hold the required places (and the first problem any place)
+        siphons_maximal(siphons, &relation, allowed);
+
+        if (!siphons_contains(siphons, allowed, required) || siphons_is_empty(siphons, allowed))
+        {
+            continue;
+        }
+
+        // if the required places hold a closed set any minimal set holding them is that set, so they must be it
+        memcpy(set, required, sizeof(unsigned long long) * words);
+
+        siphons_maximal(siphons, &relation, set);
+
+        if (!siphons_is_empty(siphons, set))
+        {
+            if (siphons_contains(siphons, set, required) &&
+                siphons_is_minimal(siphons, &relation, required, trial, candidates))
+            {
+                siphons_record(siphons, required, trap, capacities);
+            }
+
+            continue;
+        }
+
+        memcpy(set, required, sizeof(unsigned long long) * words);
+
+        if (siphons_is_empty(siphons, required))
+        {
+            siphons_members(siphons, allowed, candidates);
+
+            set[candidates[0] / 64] |= 1ULL << (candidates[0] % 64);
+        }
+
+        siphons_grow(siphons, &relation, allowed, set);
+        siphons_minimise(siphons, &relation, set, required, trial, candidates);
+
+        split = set;
+
+        if (siphons_is_empty(siphons, required) || siphons_is_minimal(siphons, &relation, set, trial, candidates))
+        {
+            siphons_record(siphons, set, trap, capacities);
+        }
+        else
+        {
+            // the set holds a smaller closed set (left in the trial) - a minimal set of the problem cannot hold all of
+            // a minimal one of those, so the problem is split by its places instead (none if they are all required)
+            siphons_minimise(siphons, &relation, trial, none, trap, candidates);
+
+            split = trial;
+        }
+
+        // restore the allowed places of the problem being split
+        memcpy(allowed, problems.sets + 2 * words * problems.count, sizeof(unsigned long long) * words);
+        memcpy(part, required, sizeof(unsigned long long) * words);
+
+        count = siphons_members(siphons, split, candidates);
+
+        for (int iCandidate = 0; iCandidate < count; iCandidate++)
+        {
+            int place = candidates[iCandidate];
+
+            if (siphons_has(required, place))
+            {
+                continue;
+            }
+
+            allowed[place / 64] &= ~(1ULL << (place % 64));
+
+            siphons_push(siphons, &problems, allowed, part);
+
+            allowed[place / 64] |= 1ULL << (place % 64);
+            part[place / 64] |= 1ULL << (place % 64);
+        }
+    }
+
+    free(problems.sets);
+    free(candidates);
+    free(sets);
+
+    siphons->seconds = explorer_clock() - started;
+
+    return siphons->complete;
+}
+
+/**
+ * @brief returns true if every arc of the net has weight one
+ *
+ */
+int siphons_is_ordinary(MODEL *model)
+{
+
+    for (int iArc = 0; iArc < model->inputStart[model->transitions]; iArc++)
+    {
+        if (model->inputWeights[iArc] != 1)
+        {
+            return FALSE;
+        }
+    }
+
+    for (int iArc = 0; iArc < model->outputStart[model->transitions]; iArc++)
+    {
+        if (model->outputWeights[iArc] != 1)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief returns true if the consumers of each place all have the same input places (extended free choice)
+ *
+ */
+int siphons_is_free_choice(SIPHONS *siphons)
+{
+    MODEL *model = siphons->model;
+    int *marks = calloc(model->places + 1, sizeof(int));
+    int freeChoice = TRUE;
+
+    for (int iPlace = 0; iPlace < model->places && freeChoice; iPlace++)
+    {
+        int first = 0;
+
+        if (model->consumerStart[iPlace + 1] - model->consumerStart[iPlace] < 2)
+        {
+            continue;
+        }
+
+        // mark the input places of the first consumer, the others must have the same
+        first = model->consumerTransitions[model->consumerStart[iPlace]];
+
+        for (int iInput = model->inputStart[first]; iInput < model->inputStart[first + 1]; iInput++)
+        {
+            marks[model->inputPlaces[iInput]] = iPlace + 1;
+        }
+
+        for (int iConsumer = model->consumerStart[iPlace] + 1;
+             iConsumer < model->consumerStart[iPlace + 1] && freeChoice; iConsumer++)
+        {
+            int transition = model->consumerTransitions[iConsumer];
+
+            freeChoice = model->inputStart[transition + 1] - model->inputStart[transition] ==
+                         model->inputStart[first + 1] - model->inputStart[first];
+
+            for (int iInput = model->inputStart[transition]; iInput < model->inputStart[transition + 1]; iInput++)
+            {
+                freeChoice = freeChoice && marks[model->inputPlaces[iInput]] == iPlace + 1;
+            }
+        }
+    }
+
+    free(marks);
+
+    return freeChoice;
+}
+
+/**
+ * @brief release/free the siphons object
+ *
+ */
+void siphons_release(SIPHONS *siphons)
+{
+
+    free(siphons->start);
+    free(siphons->members);
+    free(siphons->trapStart);
+    free(siphons->traps);
+    free(siphons->marked);
+
+    free(siphons->producerStart);
+    free(siphons->producers);
+    free(siphons->stamps);
+    free(siphons->remaining);
+    free(siphons->queue);
+
+    free(siphons);
+}
+
+/**
+ * @brief siphons constructor
+ *
+ */
+SIPHONS *create_siphons(MODEL *model, enum SIPHON_KIND kind)
+{
+    SIPHONS *siphons = malloc(sizeof(SIPHONS));
+    int *next = NULL;
+
+    siphons->model = model;
+    siphons->kind = kind;
+    siphons->words = model->places / 64 + 1;
+
+    // the producers of each place (the model holds the consumers)
+    siphons->producerStart = calloc(model->places + 1, sizeof(int));
+    siphons->producers = malloc(sizeof(int) * (model->outputStart[model->transitions] + 1));
+
+    for (int iArc = 0; iArc < model->outputStart[model->transitions]; iArc++)
+    {
+        siphons->producerStart[model->outputPlaces[iArc] + 1] += 1;
+    }
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        siphons->producerStart[iPlace + 1] += siphons->producerStart[iPlace];
+    }
+
+    next = malloc(sizeof(int) * (model->places + 1));
+    memcpy(next, siphons->producerStart, sizeof(int) * (model->places + 1));
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        for (int iArc = model->outputStart[iTransition]; iArc < model->outputStart[iTransition + 1]; iArc++)
+        {
+            siphons->producers[next[model->outputPlaces[iArc]]++] = iTransition;
+        }
+    }
+
+    free(next);
+
+    siphons->stamps = calloc(model->transitions + 1, sizeof(int));
+    siphons->stamp = 0;
+    siphons->remaining = calloc(model->transitions + 1, sizeof(int));
+    siphons->queue = malloc(sizeof(int) * (2 * model->places + 1));
+
+    siphons->count = 0;
+    siphons->start = calloc(1, sizeof(int));
+    siphons->members = NULL;
+    siphons->trapStart = calloc(1, sizeof(int));
+    siphons->traps = NULL;
+    siphons->marked = NULL;
+    siphons->unmarkedCount = 0;
+
+    siphons->ordinary = siphons_is_ordinary(model);
+    siphons->freeChoice = siphons_is_free_choice(siphons);
+
+    siphons->complete = FALSE;
+    siphons->problems = 0;
+    siphons->seconds = 0;
+
+    siphons->compute = siphons_compute;
+    siphons->release = siphons_release;
+
+    return siphons;
+}
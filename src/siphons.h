@@ -0,0 +1,135 @@
+/**
+ * @file siphons.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - the minimal siphons and traps of a compiled model and the siphon-trap (Commoner) property
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SIPHONS_H_INCLUDED
+#define SIPHONS_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a set of siphons
+ *
+ */
+#define TO_SIPHONS(siphons) ((SIPHONS *)(siphons))
+
+/**
+ * @brief the place sets found - siphons (every transition producing into the set consumes from it, so an unmarked
+ *        siphon stays unmarked) or traps (every transition consuming from the set produces into it, so a marked trap
+ *        stays marked)
+ *
+ */
+enum SIPHON_KIND
+{
+    SIPHON_SETS = 0,
+    TRAP_SETS,
+    END_SIPHON_KINDS
+};
+
+/**
+ * @brief the siphons' interface - the minimal sets are enumerated without the state space by partitioning the search
+ *        (Cordone, Ferrarini and Piroddi): a problem is the places allowed and the places required; the maximal set
+ *        within the allowed places (found by removing places until none is left unguarded) is grown from the required
+ *        places and shrunk to a minimal set, and the problem is split into one problem per place of that set not
+ *        required - the place is excluded and the places before it required. Sets are bit sets (place 'p' is bit
+ *        'p % 64' of word 'p / 64'). For siphons, the maximal trap held in each siphon is found too: if each is
+ *        marked, no siphon can be emptied, so an ordinary net has no dead marking, and an (extended) free choice net
+ *        is live (Commoner)
+ *
+ */
+typedef struct _SIPHONS
+{
+
+    /**
+     * @brief compute the minimal sets - stops once 'limit' problems are searched (0 is no limit), returns true if
+     *        every minimal set was found, false otherwise (those found are minimal)
+     *
+     */
+    int (*compute)(struct _SIPHONS *siphons, int limit);
+
+    /**
+     * @brief release the siphons and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _SIPHONS *siphons);
+
+    /**
+     * @brief the compiled net and the sets found
+     *
+     */
+    MODEL *model;
+    enum SIPHON_KIND kind;
+
+    /**
+     * @brief the minimal sets - the places of set 'i' are held in members[start[i]] .. members[start[i + 1]]
+     *
+     */
+    int count;
+    int *start;
+    int *members;
+
+    /**
+     * @brief the maximal trap held in each set - traps[trapStart[i]] .. traps[trapStart[i + 1]] (a trap's is itself)
+     *        and true if it is marked initially
+     *
+     */
+    int *trapStart;
+    int *traps;
+    int *marked;
+
+    /**
+     * @brief the sets whose maximal trap is not marked initially (for siphons - each could be emptied)
+     *
+     */
+    int unmarkedCount;
+
+    /**
+     * @brief true if every arc has weight one, and true if transitions sharing an input place have the same input
+     *        places (extended free choice)
+     *
+     */
+    int ordinary;
+    int freeChoice;
+
+    /**
+     * @brief true if the last computation was complete, and the problems searched
+     *
+     */
+    int complete;
+    long problems;
+
+    /**
+     * @brief the time taken by the last computation (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief private (the words of a set, the transitions producing into each place and a mark per transition)
+     *
+     */
+    int words;
+    int *producerStart;
+    int *producers;
+    int *stamps;
+    int stamp;
+
+    /**
+     * @brief private (per transition - its places left in the set, and the places removed from the set)
+     *
+     */
+    int *remaining;
+    int *queue;
+
+} SIPHONS, *SIPHONS_P;
+
+extern SIPHONS *create_siphons(MODEL *model, enum SIPHON_KIND kind);
+
+#endif // SIPHONS_H_INCLUDED
@@ -0,0 +1,231 @@
+/**
+ * @file store.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  an open addressing (linear probing) hash set of states held contiguously
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "store.h"
+
+/**
+ * @brief hash a state (murmur3 style mixing of each word)
+ *
+ */
+unsigned int store_hash(const unsigned int *state, int width)
+{
+    unsigned int hash = 0x811C9DC5u ^ (unsigned int)width;
+
+    for (int iWord = 0; iWord < width; iWord++)
+    {
+        unsigned int word = state[iWord] * 0xCC9E2D51u;
+
+        word = (word << 15) | (word >> 17);
+        hash ^= word * 0x1B873593u;
+        hash = ((hash << 13) | (hash >> 19)) * 5 + 0xE6546B64u;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/**
+ * @brief the memory held by the store (the states, their hashes and the table)
+ *
+ */
+size_t store_bytes(STORE *store)
+{
+
+    return sizeof(unsigned int) * (size_t)store->capacity * (store->width + 1) + sizeof(int) * ((size_t)store->mask + 1);
+}
+
+/**
+ * @brief find the slot holding the state or the empty slot where it belongs
+ *
+ */
+unsigned int store_probe(STORE *store, const unsigned int *state, unsigned int hash)
+{
+    unsigned int slot = hash & store->mask;
+
+    while (store->slots[slot] != 0)
+    {
+        int index = store->slots[slot] - 1;
+
+        if (store->hashes[index] == hash &&
+            memcmp(store->states + (size_t)index * store->width, state, sizeof(unsigned int) * store->width) == 0)
+        {
+            break;
+        }
+
+        slot = (slot + 1) & store->mask;
+    }
+
+    return slot;
+}
+
+/**
+ * @brief double the table and re-insert the states (the hashes are kept, so no state is rehashed)
+ *
+ */
+void store_grow(STORE *store)
+{
+    unsigned int size = (store->mask + 1) * 2;
+
+    free(store->slots);
+
+    store->slots = calloc(size, sizeof(int));
+    store->mask = size - 1;
+
+    for (int iState = 0; iState < store->count; iState++)
+    {
+        unsigned int slot = store->hashes[iState] & store->mask;
+
+        while (store->slots[slot] != 0)
+        {
+            slot = (slot + 1) & store->mask;
+        }
+
+        store->slots[slot] = iState + 1;
+    }
+}
+
+/**
+ * @brief insert a state (with a known hash) if it is not already held
+ *
+ */
+int store_insert_hashed(STORE *store, const unsigned int *state, unsigned int hash, int *created)
+{
+    unsigned int slot = store_probe(store, state, hash);
+
+    if (store->slots[slot] != 0)
+    {
+        if (created != NULL)
+        {
+            *created = 0;
+        }
+
+        return store->slots[slot] - 1;
+    }
+
+    if (store->count == store->capacity)
+    {
+        store->capacity *= 2;
+        store->states = realloc(store->states,
+                                sizeof(unsigned int) * (size_t)store->capacity * (store->width > 0 ? store->width : 1));
+        store->hashes = realloc(store->hashes, sizeof(unsigned int) * (size_t)store->capacity);
+    }
+
+    memcpy(store->states + (size_t)store->count * store->width, state, sizeof(unsigned int) * store->width);
+
+    store->hashes[store->count] = hash;
+    store->slots[slot] = store->count + 1;
+    store->count += 1;
+
+    // keep the load factor at or below a half
+    if ((unsigned int)store->count * 2 > store->mask + 1)
+    {
+        store_grow(store);
+    }
+
+    if (created != NULL)
+    {
+        *created = 1;
+    }
+
+    return store->count - 1;
+}
+
+/**
+ * @brief insert a state if it is not already held
+ *
+ */
+int store_insert(STORE *store, const unsigned int *state, int *created)
+{
+
+    return store_insert_hashed(store, state, store_hash(state, store->width), created);
+}
+
+/**
+ * @brief find the index of a state
+ *
+ */
+int store_find(STORE *store, const unsigned int *state)
+{
+    unsigned int slot = store_probe(store, state, store_hash(state, store->width));
+
+    return store->slots[slot] - 1;
+}
+
+/**
+ * @brief get the state held at the index
+ *
+ */
+const unsigned int *store_get(STORE *store, int index)
+{
+
+    return store->states + (size_t)index * store->width;
+}
+
+/**
+ * @brief remove all the states
+ *
+ */
+void store_clear(STORE *store)
+{
+
+    memset(store->slots, 0, sizeof(int) * (store->mask + 1));
+
+    store->count = 0;
+}
+
+/**
+ * @brief release/free the store object
+ *
+ */
+void store_release(STORE *store)
+{
+
+    free(store->states);
+    free(store->hashes);
+    free(store->slots);
+
+    free(store);
+}
+
+/**
+ * @brief store constructor
+ *
+ */
+STORE *create_store(int width)
+{
+    STORE *store = malloc(sizeof(STORE));
+
+    store->width = width;
+    store->count = 0;
+    store->capacity = STORE_INITIAL_SLOTS / 2;
+
+    store->states = malloc(sizeof(unsigned int) * (size_t)store->capacity * (width > 0 ? width : 1));
+    store->hashes = malloc(sizeof(unsigned int) * (size_t)store->capacity);
+    store->slots = calloc(STORE_INITIAL_SLOTS, sizeof(int));
+    store->mask = STORE_INITIAL_SLOTS - 1;
+
+    store->insert = store_insert;
+    store->insertHashed = store_insert_hashed;
+    store->find = store_find;
+    store->get = store_get;
+    store->clear = store_clear;
+    store->release = store_release;
+
+    return store;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file store.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - an open addressing hash set of states (markings) held contiguously
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef STORE_H_INCLUDED
+#define STORE_H_INCLUDED
+
+#include <stddef.h>
+
+/**
+ * @brief casts an object to a store
+ *
+ */
+#define TO_STORE(store) ((STORE *)(store))
+
+/**
+ * @brief the initial number of slots in the table (a power of two)
+ *
+ */
+#define STORE_INITIAL_SLOTS 1024
+
+/**
+ * @brief the store's interface - each state is a fixed number of words and is identified by
+ *        the order it was inserted (0, 1, 2 ...)
+ *
+ */
+typedef struct _STORE
+{
+
+    /**
+     * @brief insert a state if it is not already held - returns the state's index (created is set to
+     *        true if the state was inserted, false if it was already held - created may be NULL)
+     *
+     */
+    int (*insert)(struct _STORE *store, const unsigned int *state, int *created);
+
+    /**
+     * @brief insert a state whose hash is known (see store_hash) - as insert
+     *
+     */
+    int (*insertHashed)(struct _STORE *store, const unsigned int *state, unsigned int hash, int *created);
+
+    /**
+     * @brief returns the index of a state, -1 if the state is not held
+     *
+     */
+    int (*find)(struct _STORE *store, const unsigned int *state);
+
+    /**
+     * @brief returns the state held at the index
+     *
+     */
+    const unsigned int *(*get)(struct _STORE *store, int index);
+
+    /**
+     * @brief remove all the states
+     *
+     */
+    void (*clear)(struct _STORE *store);
+
+    /**
+     * @brief release the store and deallocate resources
+     *
+     */
+    void (*release)(struct _STORE *store);
+
+    /**
+     * @brief the number of words in a state
+     *
+     */
+    int width;
+
+    /**
+     * @brief the number of states held
+     *
+     */
+    int count;
+
+    /**
+     * @brief private (the states - 'width' words each, in the order inserted)
+     *
+     */
+    unsigned int *states;
+    int capacity;
+
+    /**
+     * @brief private (the hash of each state)
+     *
+     */
+    unsigned int *hashes;
+
+    /**
+     * @brief private (the table - the index + 1 of the state in each slot, zero if the slot is empty)
+     *
+     */
+    int *slots;
+    unsigned int mask;
+
+} STORE, *STORE_P;
+
+extern STORE *create_store(int width);
+
+extern unsigned int store_hash(const unsigned int *state, int width);
+
+extern size_t store_bytes(STORE *store);
+
+#endif // STORE_H_INCLUDED
@@ -0,0 +1,546 @@
+/**
+ * @file symbolic.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  symbolic reachability of a compiled model (chaining over the transitions of a decision diagram)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "diagram.h"
+#include "explorer.h"
+#include "symbolic.h"
+
+/**
+ * @brief private structure - a place's position while the places are ordered
+ *
+ */
+typedef struct _SYMBOLIC_POSITION
+{
+    double position;
+    int place;
+
+} SYMBOLIC_POSITION, *SYMBOLIC_POSITION_P;
+
+/**
+ * @brief order positions (then places)
+ *
+ */
+int symbolic_compare_positions(const void *a, const void *b)
+{
+    const SYMBOLIC_POSITION *first = a;
+    const SYMBOLIC_POSITION *second = b;
+
+    if (first->position != second->position)
+    {
+        return first->position < second->position ? -1 : 1;
+    }
+
+    return first->place - second->place;
+}
+
+/**
+ * @brief the total span of the transitions - the levels between the lowest and highest place each touches
+ *
+ */
+long symbolic_span(SYMBOLIC *symbolic, const int *levels)
+{
+    MODEL *model = symbolic->model;
+    long span = 0;
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        int lowest = model->places;
+        int highest = -1;
+
+        for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1]; iArc++)
+        {
+            lowest = levels[model->inputPlaces[iArc]] < lowest ? levels[model->inputPlaces[iArc]] : lowest;
+            highest = levels[model->inputPlaces[iArc]] > highest ? levels[model->inputPlaces[iArc]] : highest;
+        }
+
+        for (int iArc = model->outputStart[iTransition]; iArc < model->outputStart[iTransition + 1]; iArc++)
+        {
+            lowest = levels[model->outputPlaces[iArc]] < lowest ? levels[model->outputPlaces[iArc]] : lowest;
+            highest = levels[model->outputPlaces[iArc]] > highest ? levels[model->outputPlaces[iArc]] : highest;
+        }
+
+        span += highest >= lowest ? highest - lowest : 0;
+    }
+
+    return span;
+}
+
+/**
+ * @brief order the places (FORCE) - each pass moves a place to the mean centre of gravity of the transitions touching
+ *        it and ranks the places by their new positions, the order with the least span is kept
+ *
+ */
+void symbolic_order(SYMBOLIC *symbolic)
+{
+    MODEL *model = symbolic->model;
+    SYMBOLIC_POSITION *positions = malloc(sizeof(SYMBOLIC_POSITION) * (model->places + 1));
+    double *sums = malloc(sizeof(double) * (model->places + 1));
+    int *counts = malloc(sizeof(int) * (model->places + 1));
+    int *levels = malloc(sizeof(int) * (model->places + 1));
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        levels[iPlace] = iPlace;
+        symbolic->levels[iPlace] = iPlace;
+    }
+
+    symbolic->fileSpan = symbolic_span(symbolic, levels);
+    symbolic->span = symbolic->fileSpan;
+
+    for (int iPass = 0; iPass < SYMBOLIC_ORDER_PASSES && symbolic->span > 0; iPass++)
+    {
+        long span = 0;
+
+        for (int iPlace = 0; iPlace < model->places; iPlace++)
+        {
+            sums[iPlace] = 0;
+            counts[iPlace] = 0;
+        }
+
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            int arcs = model->inputStart[iTransition + 1] - model->inputStart[iTransition] +
+                       model->outputStart[iTransition + 1] - model->outputStart[iTransition];
+            double gravity = 0;
+
+            for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1]; iArc++)
+            {
+                gravity += levels[model->inputPlaces[iArc]];
+            }
+
+            for (int iArc = model->outputStart[iTransition]; iArc < model->outputStart[iTransition + 1]; iArc++)
+            {
+                gravity += levels[model->outputPlaces[iArc]];
+            }
+
+            gravity = arcs > 0 ? gravity / arcs : 0;
+
+            for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1]; iArc++)
+            {
+                sums[model->inputPlaces[iArc]] += gravity;
+                counts[model->inputPlaces[iArc]] += 1;
+            }
+
+            for (int iArc = model->outputStart[iTransition]; iArc < model->outputStart[iTransition + 1]; iArc++)
+            {
+                sums[model->outputPlaces[iArc]] += gravity;
+                counts[model->outputPlaces[iArc]] += 1;
+            }
+        }
+
+        // a place no transition touches keeps its position
+        for (int iPlace = 0; iPlace < model->places; iPlace++)
+        {
+            positions[iPlace].position = counts[iPlace] > 0 ? sums[iPlace] / counts[iPlace] : levels[iPlace];
+            positions[iPlace].place = iPlace;
+        }
+
+        qsort(positions, model->places, sizeof(SYMBOLIC_POSITION), symbolic_compare_positions);
+
+        for (int iLevel = 0; iLevel < model->places; iLevel++)
+        {
+            levels[positions[iLevel].place] = iLevel;
+        }
+
+        span = symbolic_span(symbolic, levels);
+
+        if (span >= symbolic->span)
+        {
+            break;
+        }
+
+        symbolic->span = span;
+        memcpy(symbolic->levels, levels, sizeof(int) * model->places);
+    }
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        symbolic->order[symbolic->levels[iPlace]] = iPlace;
+    }
+
+    free(positions);
+    free(sums);
+    free(counts);
+    free(levels);
+}
+
+/**
+ * @brief set up the transition to be fired - the places it touches, what it needs from and adds to each
+ *
+ */
+void symbolic_prepare(SYMBOLIC *symbolic, int transition, int touch)
+{
+    MODEL *model = symbolic->model;
+
+    symbolic->lowest = model->places;
+
+    for (int iArc = model->inputStart[transition]; iArc < model->inputStart[transition + 1]; iArc++)
+    {
+        int level = symbolic->levels[model->inputPlaces[iArc]];
+
+        symbolic->touched[level] = touch;
+        symbolic->need[level] = touch ? model->inputWeights[iArc] : 0;
+        symbolic->lowest = level < symbolic->lowest ? level : symbolic->lowest;
+    }
+
+    for (int iChange = model->changeStart[transition]; iChange < model->changeStart[transition + 1]; iChange++)
+    {
+        int level = symbolic->levels[model->changePlaces[iChange]];
+
+        symbolic->touched[level] = touch;
+        symbolic->delta[level] = touch ? model->changeValues[iChange] : 0;
+        symbolic->lowest = level < symbolic->lowest ? level : symbolic->lowest;
+    }
+}
+
+/**
+ * @brief the markings reached by firing the prepared transition from a set of markings
+ *
+ */
+int symbolic_fire(SYMBOLIC *symbolic, int transition, int node)
+{
+    DIAGRAM *diagram = symbolic->diagram;
+    int operation = DIAGRAM_CLIENT_OPERATION + transition;
+    int level = node == DIAGRAM_EMPTY ? DIAGRAM_TERMINAL_LEVEL : diagram->nodeLevels[node];
+    int *children = NULL;
+    int result = 0;
+
+    // the levels below the lowest place touched are unchanged
+    if (level < symbolic->lowest)
+    {
+        return node;
+    }
+
+    // the node limit was reached - the firing is abandoned
+    if (!symbolic->complete)
+    {
+        return DIAGRAM_EMPTY;
+    }
+
+    if ((result = diagram->lookup(diagram, operation, node, 0)) >= 0)
+    {
+        return result;
+    }
+
+    children = symbolic->scratch[level];
+
+    for (int iValue = 0; iValue < diagram->domains[level]; iValue++)
+    {
+        children[iValue] = DIAGRAM_EMPTY;
+    }
+
+    for (int iValue = 0; iValue < diagram->domains[level]; iValue++)
+    {
+        int child = diagram->child(diagram, node, iValue);
+        int value = iValue;
+        int fired = 0;
+
+        if (child == DIAGRAM_EMPTY)
+        {
+            continue;
+        }
+
+        if (symbolic->touched[level])
+        {
+            if (iValue < symbolic->need[level])
+            {
+                continue;
+            }
+
+            value = iValue + symbolic->delta[level];
+        }
+
+        fired = symbolic_fire(symbolic, transition, child);
+
+        if (fired == DIAGRAM_EMPTY)
+        {
+            continue;
+        }
+
+        // the transition is enabled in some of the markings - but the place can't hold the result
+        if (value >= diagram->domains[level])
+        {
+            symbolic->overflow = symbolic->order[level];
+            symbolic->overflowTokens = value > symbolic->overflowTokens ? value : symbolic->overflowTokens;
+
+            continue;
+        }
+
+        children[value] = diagram->unite(diagram, children[value], fired);
+    }
+
+    result = diagram->node(diagram, level, children);
+
+    if (symbolic->limit > 0 && diagram->nodes > symbolic->limit)
+    {
+        symbolic->complete = FALSE;
+
+        return DIAGRAM_EMPTY;
+    }
+
+    diagram->remember(diagram, operation, node, 0, result);
+
+    return result;
+}
+
+/**
+ * @brief the set holding only the initial marking
+ *
+ */
+int symbolic_initial(SYMBOLIC *symbolic)
+{
+    MODEL *model = symbolic->model;
+    DIAGRAM *diagram = symbolic->diagram;
+    int node = DIAGRAM_ONE;
+
+    for (int iLevel = 0; iLevel < model->places; iLevel++)
+    {
+        int *children = symbolic->scratch[iLevel];
+
+        for (int iValue = 0; iValue < diagram->domains[iLevel]; iValue++)
+        {
+            children[iValue] = DIAGRAM_EMPTY;
+        }
+
+        children[model->marking[symbolic->order[iLevel]]] = node;
+
+        node = diagram->node(diagram, iLevel, children);
+    }
+
+    return node;
+}
+
+/**
+ * @brief (re)create the diagram for the current bounds
+ *
+ */
+void symbolic_create_diagram(SYMBOLIC *symbolic)
+{
+    MODEL *model = symbolic->model;
+    int *domains = malloc(sizeof(int) * (model->places + 1));
+
+    if (symbolic->diagram != NULL)
+    {
+        symbolic->peak = symbolic->diagram->peak > symbolic->peak ? symbolic->diagram->peak : symbolic->peak;
+        symbolic->diagram->release(symbolic->diagram);
+    }
+
+    for (int iLevel = 0; iLevel < model->places; iLevel++)
+    {
+        domains[iLevel] = symbolic->bounds[symbolic->order[iLevel]] + 1;
+
+        free(symbolic->scratch[iLevel]);
+        symbolic->scratch[iLevel] = malloc(sizeof(int) * domains[iLevel]);
+    }
+
+    symbolic->diagram = create_diagram(model->places, domains);
+
+    free(domains);
+}
+
+/**
+ * @brief chain the transitions until no new marking is found (or the node limit is reached) - returns false if a
+ *        place overflowed its bound
+ *
+ */
+int symbolic_chain(SYMBOLIC *symbolic)
+{
+    MODEL *model = symbolic->model;
+    DIAGRAM *diagram = symbolic->diagram;
+    int threshold = SYMBOLIC_COLLECTION_THRESHOLD;
+    int roots[2] = {DIAGRAM_EMPTY, DIAGRAM_EMPTY};
+
+    // the garbage is collected before the limit is reached
+    if (symbolic->limit > 0)
+    {
+        threshold = symbolic->limit / 2 < threshold ? symbolic->limit / 2 : threshold;
+    }
+
+    symbolic->overflow = -1;
+    symbolic->overflowTokens = 0;
+    symbolic->reachable = symbolic_initial(symbolic);
+
+    while (roots[0] != symbolic->reachable)
+    {
+        roots[0] = symbolic->reachable;
+        symbolic->iterations += 1;
+
+        for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+        {
+            int fired = 0;
+
+            symbolic_prepare(symbolic, iTransition, TRUE);
+
+            fired = symbolic_fire(symbolic, iTransition, symbolic->reachable);
+
+            symbolic_prepare(symbolic, iTransition, FALSE);
+
+            // the markings found so far are kept
+            if (!symbolic->complete)
+            {
+                return TRUE;
+            }
+
+            symbolic->reachable = diagram->unite(diagram, symbolic->reachable, fired);
+
+            if (symbolic->overflow >= 0)
+            {
+                return FALSE;
+            }
+
+            if (diagram->nodes > threshold)
+            {
+                roots[1] = symbolic->reachable;
+
+                diagram->collect(diagram, roots, 2);
+
+                symbolic->reachable = roots[1];
+                threshold = diagram->nodes * 2 > threshold ? diagram->nodes * 2 : threshold;
+
+                if (symbolic->limit > 0)
+                {
+                    threshold = threshold < symbolic->limit ? threshold : symbolic->limit;
+                }
+            }
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief build the set of reachable markings - the bound of a place that overflows is widened and the chaining
+ *        restarted
+ *
+ */
+int symbolic_explore(SYMBOLIC *symbolic, int limit)
+{
+    double started = explorer_clock();
+    int roots[1];
+
+    symbolic->iterations = 0;
+    symbolic->restarts = 0;
+    symbolic->unbounded = -1;
+    symbolic->peak = 0;
+    symbolic->limit = limit;
+    symbolic->complete = TRUE;
+
+    symbolic_order(symbolic);
+    symbolic_create_diagram(symbolic);
+
+    while (!symbolic_chain(symbolic))
+    {
+        int bound = symbolic->bounds[symbolic->overflow] * 2;
+
+        bound = symbolic->overflowTokens > bound ? symbolic->overflowTokens : bound;
+
+        if (bound > SYMBOLIC_MAXIMUM_BOUND)
+        {
+            symbolic->unbounded = symbolic->overflow;
+
+            break;
+        }
+
+        symbolic->bounds[symbolic->overflow] = bound;
+        symbolic->restarts += 1;
+
+        symbolic_create_diagram(symbolic);
+    }
+
+    roots[0] = symbolic->reachable;
+
+    symbolic->diagram->collect(symbolic->diagram, roots, 1);
+
+    symbolic->reachable = roots[0];
+    symbolic->states = symbolic->diagram->count(symbolic->diagram, symbolic->reachable);
+    symbolic->nodes = symbolic->diagram->nodes;
+    symbolic->peak = symbolic->diagram->peak > symbolic->peak ? symbolic->diagram->peak : symbolic->peak;
+    symbolic->seconds = explorer_clock() - started;
+
+    return symbolic->complete && symbolic->unbounded < 0;
+}
+
+/**
+ * @brief release/free the symbolic explorer object
+ *
+ */
+void symbolic_release(SYMBOLIC *symbolic)
+{
+
+    if (symbolic->diagram != NULL)
+    {
+        symbolic->diagram->release(symbolic->diagram);
+    }
+
+    for (int iPlace = 0; iPlace < symbolic->model->places; iPlace++)
+    {
+        free(symbolic->scratch[iPlace]);
+    }
+
+    free(symbolic->scratch);
+    free(symbolic->bounds);
+    free(symbolic->order);
+    free(symbolic->levels);
+    free(symbolic->need);
+    free(symbolic->delta);
+    free(symbolic->touched);
+
+    free(symbolic);
+}
+
+/**
+ * @brief symbolic explorer constructor
+ *
+ */
+SYMBOLIC *create_symbolic(MODEL *model)
+{
+    SYMBOLIC *symbolic = malloc(sizeof(SYMBOLIC));
+
+    symbolic->model = model;
+    symbolic->diagram = NULL;
+    symbolic->reachable = DIAGRAM_EMPTY;
+
+    symbolic->states = 0;
+    symbolic->nodes = 0;
+    symbolic->peak = 0;
+    symbolic->iterations = 0;
+    symbolic->restarts = 0;
+    symbolic->unbounded = -1;
+    symbolic->complete = FALSE;
+    symbolic->seconds = 0;
+    symbolic->limit = 0;
+    symbolic->span = 0;
+    symbolic->fileSpan = 0;
+
+    symbolic->bounds = malloc(sizeof(int) * (model->places + 1));
+    symbolic->order = malloc(sizeof(int) * (model->places + 1));
+    symbolic->levels = malloc(sizeof(int) * (model->places + 1));
+    symbolic->need = calloc(model->places + 1, sizeof(int));
+    symbolic->delta = calloc(model->places + 1, sizeof(int));
+    symbolic->touched = calloc(model->places + 1, sizeof(int));
+    symbolic->scratch = calloc(model->places + 1, sizeof(int *));
+
+    for (int iPlace = 0; iPlace < model->places; iPlace++)
+    {
+        int bound = model->bounds[iPlace] > model->marking[iPlace] ? model->bounds[iPlace] : model->marking[iPlace];
+
+        symbolic->bounds[iPlace] = bound < 1 ? 1 : bound;
+    }
+
+    symbolic->explore = symbolic_explore;
+    symbolic->release = symbolic_release;
+
+    return symbolic;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file symbolic.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - symbolic reachability of a compiled model (chaining over the transitions of a decision diagram)
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef SYMBOLIC_H_INCLUDED
+#define SYMBOLIC_H_INCLUDED
+
+#include "model.h"
+#include "diagram.h"
+
+/**
+ * @brief casts an object to a symbolic explorer
+ *
+ */
+#define TO_SYMBOLIC(symbolic) ((SYMBOLIC *)(symbolic))
+
+/**
+ * @brief the largest bound a place is widened to before the place is taken to be unbounded
+ *
+ */
+#define SYMBOLIC_MAXIMUM_BOUND 1023
+
+/**
+ * @brief the number of nodes held before the first garbage collection
+ *
+ */
+#define SYMBOLIC_COLLECTION_THRESHOLD (1 << 20)
+
+/**
+ * @brief the most passes made ordering the places (the passes stop once the span stops shrinking)
+ *
+ */
+#define SYMBOLIC_ORDER_PASSES 64
+
+/**
+ * @brief the symbolic explorer's interface - place order[l] is level 'l' of the diagram with the values
+ *        0 .. bounds[order[l]]; a place's bound is its declared bound (or its initial marking, at least 1) and is
+ *        widened, and the exploration restarted, if a firing exceeds it. The places are ordered before exploring
+ *        (FORCE, Aloul, Markov and Sakallah): each pass moves every place to the mean centre of gravity of the
+ *        transitions touching it, so the places a transition touches end up close together (its span - the levels
+ *        between its lowest and highest place - is short); the order with the least total span is kept
+ *
+ */
+typedef struct _SYMBOLIC
+{
+
+    /**
+     * @brief build the set of reachable markings - stops once the diagram holds more than 'limit' nodes (0 is no
+     *        limit), returns true if the set is complete, false if the limit was reached or a place exceeded
+     *        SYMBOLIC_MAXIMUM_BOUND (see 'unbounded')
+     *
+     */
+    int (*explore)(struct _SYMBOLIC *symbolic, int limit);
+
+    /**
+     * @brief release the symbolic explorer and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _SYMBOLIC *symbolic);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the diagram holding the reachable markings
+     *
+     */
+    DIAGRAM *diagram;
+
+    /**
+     * @brief the set of reachable markings (a node of the diagram)
+     *
+     */
+    int reachable;
+
+    /**
+     * @brief the bound of each place
+     *
+     */
+    int *bounds;
+
+    /**
+     * @brief the place at each level and the level of each place
+     *
+     */
+    int *order;
+    int *levels;
+
+    /**
+     * @brief the total span of the transitions in the order found and in the file's order
+     *
+     */
+    long span;
+    long fileSpan;
+
+    /**
+     * @brief the number of reachable markings, the nodes representing them and the most nodes held at once
+     *
+     */
+    double states;
+    int nodes;
+    int peak;
+
+    /**
+     * @brief the number of passes over the transitions and the number of restarts (bound widenings)
+     *
+     */
+    int iterations;
+    int restarts;
+
+    /**
+     * @brief true if the last exploration was complete (false if the node limit was reached)
+     *
+     */
+    int complete;
+
+    /**
+     * @brief the place that exceeded SYMBOLIC_MAXIMUM_BOUND (-1 if none did)
+     *
+     */
+    int unbounded;
+
+    /**
+     * @brief the time taken by the last exploration (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief private (the tokens the transition being fired needs from and adds to the place at each level, whether
+     *        it touches the place, and the lowest level it touches)
+     *
+     */
+    int *need;
+    int *delta;
+    int *touched;
+    int lowest;
+
+    /**
+     * @brief private (the place that overflowed while firing and the tokens it would have held, -1 if none did)
+     *
+     */
+    int overflow;
+    int overflowTokens;
+
+    /**
+     * @brief private (the children being built at each level)
+     *
+     */
+    int **scratch;
+
+    /**
+     * @brief private (the node limit of the exploration)
+     *
+     */
+    int limit;
+
+} SYMBOLIC, *SYMBOLIC_P;
+
+extern SYMBOLIC *create_symbolic(MODEL *model);
+
+#endif // SYMBOLIC_H_INCLUDED
@@ -0,0 +1,458 @@
+/**
+ * @file timed.c
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  a timed (discrete event) simulation of a compiled model using the transitions' durations
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "model.h"
+#include "simulator.h"
+#include "store.h"
+#include "codec.h"
+#include "reduction.h"
+#include "explorer.h"
+#include "timed.h"
+
+/**
+ * @brief the default seed of the random generator
+ *
+ */
+#define TIMED_SEED 0x9E3779B97F4A7C15ULL
+
+/**
+ * @brief meld two heaps - returns the root (the earlier completion, the lower transition if they are due together)
+ *
+ */
+int timed_meld(TIMED_SIMULATOR *simulator, int first, int second)
+{
+
+    if (first < 0)
+    {
+        return second;
+    }
+
+    if (second < 0)
+    {
+        return first;
+    }
+
+    if (simulator->due[second] < simulator->due[first] ||
+        (simulator->due[second] == simulator->due[first] && second < first))
+    {
+        int swap = first;
+
+        first = second;
+        second = swap;
+    }
+
+    simulator->sibling[second] = simulator->child[first];
+    simulator->child[first] = second;
+
+    return first;
+}
+
+/**
+ * @brief remove the root of the heap - its children are melded in pairs left to right, then the pairs right to left
+ *
+ */
+void timed_pop(TIMED_SIMULATOR *simulator)
+{
+    int pairs = -1;
+    int node = simulator->child[simulator->root];
+
+    simulator->child[simulator->root] = -1;
+
+    while (node >= 0)
+    {
+        int first = node;
+        int second = simulator->sibling[first];
+        int pair = 0;
+
+        node = second >= 0 ? simulator->sibling[second] : -1;
+
+        simulator->sibling[first] = -1;
+
+        if (second >= 0)
+        {
+            simulator->sibling[second] = -1;
+        }
+
+        pair = timed_meld(simulator, first, second);
+
+        // the pairs are chained (latest first) through their sibling
+        simulator->sibling[pair] = pairs;
+        pairs = pair;
+    }
+
+    simulator->root = -1;
+
+    while (pairs >= 0)
+    {
+        int next = simulator->sibling[pairs];
+
+        simulator->sibling[pairs] = -1;
+        simulator->root = timed_meld(simulator, simulator->root, pairs);
+
+        pairs = next;
+    }
+}
+
+/**
+ * @brief add a transition to the enabled transitions
+ *
+ */
+void timed_enable(TIMED_SIMULATOR *simulator, int transition)
+{
+
+    simulator->position[transition] = simulator->enabledCount;
+    simulator->enabled[simulator->enabledCount++] = transition;
+}
+
+/**
+ * @brief remove a transition from the enabled transitions (the last enabled transition fills the gap)
+ *
+ */
+void timed_disable(TIMED_SIMULATOR *simulator, int transition)
+{
+    int last = simulator->enabled[--simulator->enabledCount];
+
+    simulator->enabled[simulator->position[transition]] = last;
+    simulator->position[last] = simulator->position[transition];
+    simulator->position[transition] = -1;
+}
+
+/**
+ * @brief count a transition's unsatisfied condition - it is disabled by the first
+ *
+ */
+void timed_unsatisfy(TIMED_SIMULATOR *simulator, int transition)
+{
+
+    if (simulator->unsatisfied[transition]++ == 0)
+    {
+        timed_disable(simulator, transition);
+    }
+}
+
+/**
+ * @brief remove a transition's unsatisfied condition - it is enabled by the last
+ *
+ */
+void timed_satisfy(TIMED_SIMULATOR *simulator, int transition)
+{
+
+    if (--simulator->unsatisfied[transition] == 0)
+    {
+        timed_enable(simulator, transition);
+    }
+}
+
+/**
+ * @brief add tokens to (or remove tokens from) a place - only the place's consumers are revisited
+ *
+ */
+void timed_add(TIMED_SIMULATOR *simulator, int place, int tokens)
+{
+    MODEL *model = simulator->model;
+    int before = simulator->marking[place];
+    int after = before + tokens;
+
+    simulator->marking[place] = after;
+
+    for (int iArc = model->consumerStart[place]; iArc < model->consumerStart[place + 1]; iArc++)
+    {
+        int weight = model->consumerWeights[iArc];
+
+        if (before >= weight && after < weight)
+        {
+            timed_unsatisfy(simulator, model->consumerTransitions[iArc]);
+        }
+        else if (before < weight && after >= weight)
+        {
+            timed_satisfy(simulator, model->consumerTransitions[iArc]);
+        }
+    }
+}
+
+/**
+ * @brief the duration of a firing - fixed, or drawn from a geometric distribution with the transition's duration as
+ *        its mean (a duration of zero or one is always fixed)
+ *
+ */
+long long timed_duration(TIMED_SIMULATOR *simulator, int transition)
+{
+    int duration = simulator->model->durations[transition];
+    double uniform = 0;
+    long long drawn = 0;
+
+    if (duration <= 1 || !simulator->stochastic)
+    {
+        return duration > 0 ? duration : 0;
+    }
+
+    // uniform in (0, 1]
+    uniform = ((simulator_next_random(&simulator->random) >> 11) + 1) * (1.0 / 9007199254740992.0);
+
+    drawn = (long long)ceil(log(uniform) * simulator->scales[transition]);
+
+    return drawn < 1 ? 1 : drawn;
+}
+
+/**
+ * @brief start an enabled transition - its input tokens are held until it completes
+ *
+ */
+void timed_start(TIMED_SIMULATOR *simulator, int transition)
+{
+    MODEL *model = simulator->model;
+
+    timed_unsatisfy(simulator, transition);
+
+    for (int iArc = model->inputStart[transition]; iArc < model->inputStart[transition + 1]; iArc++)
+    {
+        timed_add(simulator, model->inputPlaces[iArc], -model->inputWeights[iArc]);
+    }
+
+    simulator->started[transition] = simulator->now;
+    simulator->due[transition] = simulator->now + timed_duration(simulator, transition);
+
+    simulator->root = timed_meld(simulator, simulator->root, transition);
+}
+
+/**
+ * @brief complete the transition at the root of the heap - its output tokens are produced
+ *
+ */
+void timed_complete(TIMED_SIMULATOR *simulator)
+{
+    MODEL *model = simulator->model;
+    int transition = simulator->root;
+
+    timed_pop(simulator);
+
+    for (int iArc = model->outputStart[transition]; iArc < model->outputStart[transition + 1]; iArc++)
+    {
+        timed_add(simulator, model->outputPlaces[iArc], model->outputWeights[iArc]);
+    }
+
+    simulator->completions[transition] += 1;
+    simulator->busy[transition] += simulator->now - simulator->started[transition];
+    simulator->started[transition] = -1;
+    simulator->events += 1;
+
+    timed_satisfy(simulator, transition);
+}
+
+/**
+ * @brief run the simulation - every completion due at a time is made before the enabled transitions start
+ *
+ */
+long timed_run(TIMED_SIMULATOR *simulator, long long horizon, long events)
+{
+    double started = explorer_clock();
+    long first = simulator->events;
+    long instant = 0;
+
+    simulator->dead = FALSE;
+    simulator->zeno = FALSE;
+
+    while (events <= 0 || simulator->events - first < events)
+    {
+        while (simulator->enabledCount > 0)
+        {
+            timed_start(simulator,
+                        simulator->enabled[simulator_next_random(&simulator->random) % simulator->enabledCount]);
+        }
+
+        if (simulator->root < 0)
+        {
+            simulator->dead = TRUE;
+
+            break;
+        }
+
+        if (simulator->due[simulator->root] > horizon)
+        {
+            simulator->now = horizon > simulator->now ? horizon : simulator->now;
+
+            break;
+        }
+
+        // the completions made without time passing
+        instant = simulator->due[simulator->root] > simulator->now ? 0 : instant;
+
+        simulator->now = simulator->due[simulator->root];
+
+        while (simulator->root >= 0 && simulator->due[simulator->root] == simulator->now)
+        {
+            timed_complete(simulator);
+
+            instant += 1;
+        }
+
+        if (instant >= TIMED_ZENO_LIMIT)
+        {
+            simulator->zeno = TRUE;
+
+            break;
+        }
+    }
+
+    simulator->seconds += explorer_clock() - started;
+
+    return simulator->events - first;
+}
+
+/**
+ * @brief the firings of the transition per time unit
+ *
+ */
+double timed_throughput(TIMED_SIMULATOR *simulator, int transition)
+{
+
+    return simulator->now > 0 ? (double)simulator->completions[transition] / simulator->now : 0;
+}
+
+/**
+ * @brief the fraction of the time the transition was in flight - a transition still in flight counts up to now
+ *
+ */
+double timed_utilisation(TIMED_SIMULATOR *simulator, int transition)
+{
+    long long busy = simulator->busy[transition];
+
+    if (simulator->started[transition] >= 0)
+    {
+        busy += simulator->now - simulator->started[transition];
+    }
+
+    return simulator->now > 0 ? (double)busy / simulator->now : 0;
+}
+
+/**
+ * @brief seed the random generator
+ *
+ */
+void timed_seed(TIMED_SIMULATOR *simulator, unsigned long long seed)
+{
+
+    simulator->random = seed == 0 ? TIMED_SEED : seed;
+}
+
+/**
+ * @brief restore the initial marking at time zero
+ *
+ */
+void timed_reset(TIMED_SIMULATOR *simulator)
+{
+    MODEL *model = simulator->model;
+
+    memcpy(simulator->marking, model->marking, sizeof(int) * model->places);
+
+    simulator->now = 0;
+    simulator->events = 0;
+    simulator->dead = FALSE;
+    simulator->zeno = FALSE;
+    simulator->seconds = 0;
+    simulator->enabledCount = 0;
+    simulator->root = -1;
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        simulator->completions[iTransition] = 0;
+        simulator->busy[iTransition] = 0;
+        simulator->started[iTransition] = -1;
+        simulator->child[iTransition] = -1;
+        simulator->sibling[iTransition] = -1;
+        simulator->unsatisfied[iTransition] = 0;
+        simulator->position[iTransition] = -1;
+
+        for (int iArc = model->inputStart[iTransition]; iArc < model->inputStart[iTransition + 1]; iArc++)
+        {
+            if (simulator->marking[model->inputPlaces[iArc]] < model->inputWeights[iArc])
+            {
+                simulator->unsatisfied[iTransition] += 1;
+            }
+        }
+
+        if (simulator->unsatisfied[iTransition] == 0)
+        {
+            timed_enable(simulator, iTransition);
+        }
+    }
+}
+
+/**
+ * @brief release/free the timed simulator object
+ *
+ */
+void timed_release(TIMED_SIMULATOR *simulator)
+{
+
+    free(simulator->marking);
+    free(simulator->completions);
+    free(simulator->busy);
+    free(simulator->enabled);
+    free(simulator->position);
+    free(simulator->unsatisfied);
+    free(simulator->started);
+    free(simulator->due);
+    free(simulator->child);
+    free(simulator->sibling);
+    free(simulator->scales);
+
+    free(simulator);
+}
+
+/**
+ * @brief timed simulator constructor
+ *
+ */
+TIMED_SIMULATOR *create_timed_simulator(MODEL *model)
+{
+    TIMED_SIMULATOR *simulator = malloc(sizeof(TIMED_SIMULATOR));
+    int transitions = model->transitions + 1;
+
+    simulator->model = model;
+
+    simulator->marking = malloc(sizeof(int) * (model->places + 1));
+    simulator->completions = malloc(sizeof(long) * transitions);
+    simulator->busy = malloc(sizeof(long long) * transitions);
+    simulator->enabled = malloc(sizeof(int) * transitions);
+    simulator->position = malloc(sizeof(int) * transitions);
+    simulator->unsatisfied = malloc(sizeof(int) * transitions);
+    simulator->started = malloc(sizeof(long long) * transitions);
+    simulator->due = malloc(sizeof(long long) * transitions);
+    simulator->child = malloc(sizeof(int) * transitions);
+    simulator->sibling = malloc(sizeof(int) * transitions);
+    simulator->scales = malloc(sizeof(double) * transitions);
+
+    simulator->stochastic = FALSE;
+
+    for (int iTransition = 0; iTransition < model->transitions; iTransition++)
+    {
+        int duration = model->durations[iTransition];
+
+        simulator->scales[iTransition] = duration > 1 ? 1.0 / log(1.0 - 1.0 / duration) : 0;
+    }
+
+    simulator->run = timed_run;
+    simulator->throughput = timed_throughput;
+    simulator->utilisation = timed_utilisation;
+    simulator->seed = timed_seed;
+    simulator->reset = timed_reset;
+    simulator->release = timed_release;
+
+    simulator->seed(simulator, 0);
+    simulator->reset(simulator);
+
+    return simulator;
+}
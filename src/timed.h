@@ -0,0 +1,172 @@
+/**
+ * @file timed.h
+ * @author Dr. Neil Brittliff (brittliff.org)
+ * @brief  prototype - a timed (discrete event) simulation of a compiled model using the transitions' durations
+ * @version 0.1
+ * @date 2025-01-18
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#ifndef TIMED_H_INCLUDED
+#define TIMED_H_INCLUDED
+
+#include "model.h"
+
+/**
+ * @brief casts an object to a timed simulator
+ *
+ */
+#define TO_TIMED_SIMULATOR(simulator) ((TIMED_SIMULATOR *)(simulator))
+
+/**
+ * @brief the most completions simulated at one instant before the run is stopped as zeno (transitions of duration
+ *        zero firing forever without time passing)
+ *
+ */
+#define TIMED_ZENO_LIMIT (1 << 20)
+
+/**
+ * @brief the timed simulator's interface - an enabled transition starts at once (one chosen at random if several are
+ *        enabled), consuming its input tokens, and completes 'duration' time units later, producing its output
+ *        tokens; a transition has a single server (it is not enabled while in flight). The pending completions are
+ *        held in a pairing heap (a transition is its own heap node). A stochastic simulator draws each firing's
+ *        duration from a geometric distribution whose mean is the transition's duration (the discrete time
+ *        analogue of an exponential delay)
+ *
+ */
+typedef struct _TIMED_SIMULATOR
+{
+
+    /**
+     * @brief run until the time passes 'horizon', 'events' completions have been simulated (0 is no limit), no
+     *        transition is enabled or in flight, or the time stops passing (zeno) - returns the number of completions
+     *        simulated
+     *
+     */
+    long (*run)(struct _TIMED_SIMULATOR *simulator, long long horizon, long events);
+
+    /**
+     * @brief the mean number of firings of the transition per time unit since the last reset
+     *
+     */
+    double (*throughput)(struct _TIMED_SIMULATOR *simulator, int transition);
+
+    /**
+     * @brief the fraction of the time the transition was in flight since the last reset
+     *
+     */
+    double (*utilisation)(struct _TIMED_SIMULATOR *simulator, int transition);
+
+    /**
+     * @brief seed the random choice of transitions
+     *
+     */
+    void (*seed)(struct _TIMED_SIMULATOR *simulator, unsigned long long seed);
+
+    /**
+     * @brief restore the initial marking at time zero and clear the statistics
+     *
+     */
+    void (*reset)(struct _TIMED_SIMULATOR *simulator);
+
+    /**
+     * @brief release the simulator and deallocate resources (the model is not released)
+     *
+     */
+    void (*release)(struct _TIMED_SIMULATOR *simulator);
+
+    /**
+     * @brief the compiled net
+     *
+     */
+    MODEL *model;
+
+    /**
+     * @brief the current marking (one entry per place - the tokens of transitions in flight are not held)
+     *
+     */
+    int *marking;
+
+    /**
+     * @brief true if the durations are drawn at random (see above), false if they are fixed
+     *
+     */
+    int stochastic;
+
+    /**
+     * @brief the current time
+     *
+     */
+    long long now;
+
+    /**
+     * @brief the number of completions since the last reset
+     *
+     */
+    long events;
+
+    /**
+     * @brief true if the simulation stopped in a dead marking (nothing enabled and nothing in flight)
+     *
+     */
+    int dead;
+
+    /**
+     * @brief true if the simulation stopped because TIMED_ZENO_LIMIT completions were made without time passing
+     *
+     */
+    int zeno;
+
+    /**
+     * @brief the time taken by the runs since the last reset (in seconds)
+     *
+     */
+    double seconds;
+
+    /**
+     * @brief the completions of each transition and the time it spent in flight (up to its last completion)
+     *
+     */
+    long *completions;
+    long long *busy;
+
+    /**
+     * @brief private (the enabled transitions, the index of each within 'enabled' and the number of input arcs of
+     *        each not satisfied - plus one while the transition is in flight)
+     *
+     */
+    int *enabled;
+    int enabledCount;
+    int *position;
+    int *unsatisfied;
+
+    /**
+     * @brief private (the pending completions - the heap's root, the time each transition started (-1 unless it
+     *        is in flight) and completes, its first child and its next sibling, -1 if none)
+     *
+     */
+    int root;
+    long long *started;
+    long long *due;
+    int *child;
+    int *sibling;
+
+    /**
+     * @brief private (the scale of each transition's geometric distribution - 1 / log(1 - 1 / duration))
+     *
+     */
+    double *scales;
+
+    /**
+     * @brief private (the random generator's state)
+     *
+     */
+    unsigned long long random;
+
+} TIMED_SIMULATOR, *TIMED_SIMULATOR_P;
+
+extern TIMED_SIMULATOR *create_timed_simulator(MODEL *model);
+
+#endif // TIMED_H_INCLUDED
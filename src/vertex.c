@@ -37,6 +37,7 @@
 #include "artifact.h"
 #include "controller.h"
 #include "net.h"
+#include "pool.h"
 
 /**
  * @brief copy the point
@@ -44,7 +45,15 @@
  */
 void vertex_set_point(VERTEX *vertex, POINT *point)
 {
+    POINT previous;
+
+    copy_point(&vertex->point, &previous);   
     copy_point(point, &vertex->point);   
+
+    if (vertex->arc != NULL)
+    {
+        vertex->arc->net->reshape(vertex->arc->net, vertex->arc, vertex, &previous);
+    }
 }
 
 /**
@@ -53,26 +62,36 @@ void vertex_set_point(VERTEX *vertex, POINT *point)
  */
 void vertex_release(VERTEX *vertex)
 {
-    g_free(vertex);
+
+    vertex->net->vertexPool->free(vertex->net->vertexPool, vertex);
 }
 
+/**
+ * @brief the vertex operations
+ *
+ */
+const VERTEX_OPERATIONS vertex_operations = {
+    .release = vertex_release,
+    .setPoint = vertex_set_point};
+
 /**
  * @brief vertex constructor
  *
  */
-VERTEX *create_vertex(enum POSITION position, POINT * point)
+VERTEX *create_vertex(enum POSITION position, POINT * point, NET *net)
 {
-    VERTEX *vertex = g_malloc(sizeof(VERTEX));
+    VERTEX *vertex = net->vertexPool->allocate(net->vertexPool);
 
     vertex->position = position;
+    vertex->arc = NULL;
+    vertex->net = net;
     
     vertex->artifact.state = INACTIVE;
     vertex->artifact.selected = FALSE;
     
     copy_point(point, &vertex->point);   
 
-    vertex->release = vertex_release;    
-    vertex->setPoint = vertex_set_point;    
+    vertex->operations = &vertex_operations;
 
     return vertex;
 }
\ No newline at end of file
@@ -29,6 +29,19 @@ enum POSITION
 
 };
 
+struct _VERTEX;
+
+/**
+ * @brief the operations of a vertex (one constant table shared by all the vertices)
+ *
+ */
+typedef struct _VERTEX_OPERATIONS {
+
+    void (*release)(struct _VERTEX * vertex);
+    void (*setPoint)(struct _VERTEX * vertex, POINT * point);
+
+} VERTEX_OPERATIONS, *VERTEX_OPERATIONS_P;
+
 typedef struct _VERTEX {
 
     /**
@@ -40,11 +53,26 @@ typedef struct _VERTEX {
 
     enum POSITION position;
 
-    void (*release)(struct _VERTEX * vertex);
-    void (*setPoint)(struct _VERTEX * vertex, POINT * point);
+    /**
+     * @brief the arc that owns the vertex
+     *
+     */
+    struct _ARC * arc;
+
+    /**
+     * @brief the net that holds the vertex's storage
+     *
+     */
+    struct _NET * net;
+
+    /**
+     * @brief the vertex's operations (shared by all the vertices)
+     *
+     */
+    const struct _VERTEX_OPERATIONS * operations;
  
 } VERTEX, *VERTEX_P;
 
-extern VERTEX * create_vertex(enum POSITION position, POINT * point);
+extern VERTEX * create_vertex(enum POSITION position, POINT * point, struct _NET * net);
 
 #endif // VERTEX_H_INCLUDED
\ No newline at end of file
@@ -37,6 +37,7 @@
 #include "controller.h"
 
 #include "net.h"
+#include "loader.h"
 
 #include "connector.h"
 #include "mover.h"
@@ -67,9 +68,9 @@ void writer_arc_iterator(gpointer arc, gpointer writer)
 
     xmlTextWriterStartElement(TO_WRITER(writer)->writer, BAD_CAST ARC_ELEMENT);
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, SOURCE_ATTRIBUTE, "%s",
-                                      TO_ARC(arc)->source->generate(TO_ARC(arc)->source, sizeof(buffer), buffer));
+                                      TO_ARC(arc)->source->operations->generate(TO_ARC(arc)->source, sizeof(buffer), buffer));
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, TARGET_ATTRIBUTE, "%s",
-                                      TO_ARC(arc)->target->generate(TO_ARC(arc)->target, sizeof(buffer), buffer));
+                                      TO_ARC(arc)->target->operations->generate(TO_ARC(arc)->target, sizeof(buffer), buffer));
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, WEIGHT_ATTRIBUTE, "%d", (int)TO_ARC(arc)->weight);
 
     g_ptr_array_foreach(TO_ARC(arc)->vertices,
@@ -90,6 +91,7 @@ void writer_place_iterator(gpointer node, gpointer writer)
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, NODE_NAME_ATTRIBUTE, "%s", TO_NODE(node)->name->str);
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, NODE_ALIGNMENT_ATTRIBUTE, "%d", TO_NODE(node)->alignment);
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, TOKENS_ATTRIBUTE, "%d", (int)TO_PLACE(node).marked);
+    xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, BOUND_ATTRIBUTE, "%d", TO_PLACE(node).bound);
 
     xmlTextWriterStartElement(TO_WRITER(writer)->writer, BAD_CAST GRAPHICS_ELEMENT);
 
@@ -111,6 +113,8 @@ void writer_transition_iterator(gpointer node, gpointer writer)
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, NODE_ID_ATTRIBUTE, "%d", (int)TO_NODE(node)->id);
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, NODE_NAME_ATTRIBUTE, "%s", TO_NODE(node)->name->str);
     xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, NODE_ALIGNMENT_ATTRIBUTE, "%d", TO_NODE(node)->alignment);
+    xmlTextWriterWriteFormatAttribute(TO_WRITER(writer)->writer, DURATION_ATTRIBUTE, "%d",
+                                      TO_NODE(node)->transition.duration);
 
     xmlTextWriterStartElement(TO_WRITER(writer)->writer, BAD_CAST GRAPHICS_ELEMENT);
 